@@ -0,0 +1,125 @@
+#include "algorithms/graphs/bfs/bfs.h"
+#include "algorithms/graphs/csr_graph/csr_graph.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <numeric>
+#include <random>
+#include <vector>
+
+namespace {
+namespace bfs = algorithms::graphs::bfs;
+namespace csr = algorithms::graphs::csr_graph;
+
+constexpr int64_t kEdgeFactor = 16;
+constexpr size_t kRoots = 16;
+
+// Graph500 Kronecker (R-MAT) graph with 2^scale vertices and 16 * 2^scale
+// undirected edges, stored with both directions of each edge. Each edge picks its
+// endpoints one bit at a time with quadrant probabilities A = 0.57, B = C = 0.19,
+// D = 0.05, which gives a skewed degree distribution and a diameter of a few hops,
+// like social graphs. Ids are then permuted so that degree does not follow id.
+// Self-loops are dropped; duplicate edges are kept, as in Graph500.
+struct Kronecker {
+    csr::CsrGraph<> g;
+    std::vector<int32_t> roots; // kRoots vertices with at least one edge
+    std::vector<int64_t> edges; // undirected edges in the component of each root
+
+    static const Kronecker& get(int scale) {
+        static std::map<int, Kronecker> cache;
+        auto [it, inserted] = cache.try_emplace(scale);
+        if (inserted) {
+            it->second.build(scale);
+        }
+        return it->second;
+    }
+
+  private:
+    void build(int scale) {
+        std::mt19937_64 rng(static_cast<uint64_t>(scale));
+        const int32_t n = int32_t{1} << scale;
+        std::vector<int32_t> perm(static_cast<size_t>(n));
+        std::iota(perm.begin(), perm.end(), 0);
+        std::shuffle(perm.begin(), perm.end(), rng);
+
+        // Quadrant thresholds out of 2^32: A, A + B, A + B + C.
+        constexpr uint64_t kA = 2448131359;   // 0.57
+        constexpr uint64_t kAB = 3264175145;  // 0.76
+        constexpr uint64_t kABC = 4080218931; // 0.95
+        std::vector<csr::CsrEdge<>> arcs;
+        arcs.reserve(static_cast<size_t>(2 * kEdgeFactor * n));
+        for (int64_t e = 0; e < kEdgeFactor * n; ++e) {
+            int32_t u = 0;
+            int32_t v = 0;
+            for (int bit = 0; bit < scale; ++bit) {
+                const uint64_t r = rng() >> 32;
+                u = (u << 1) | static_cast<int32_t>(r >= kAB);
+                v = (v << 1) | static_cast<int32_t>((r >= kA && r < kAB) || r >= kABC);
+            }
+            u = perm[static_cast<size_t>(u)];
+            v = perm[static_cast<size_t>(v)];
+            if (u != v) {
+                arcs.push_back({u, v});
+                arcs.push_back({v, u});
+            }
+        }
+        g = csr::csr_from_edges(n, arcs);
+
+        std::uniform_int_distribution<int32_t> pick(0, n - 1);
+        while (roots.size() < kRoots) {
+            const int32_t r = pick(rng);
+            if (g.degree(r) > 0) {
+                roots.push_back(r);
+            }
+        }
+        // Traversed edges per search, Graph500 style: edges of the root's component.
+        for (int32_t r : roots) {
+            const auto res = bfs::bfs_from(g, r);
+            int64_t arcs_reached = 0;
+            for (int32_t v : res.order) {
+                arcs_reached += g.degree(v);
+            }
+            edges.push_back(arcs_reached / 2);
+        }
+    }
+};
+} // namespace
+
+// Plain queue-based BFS (top-down only).
+static void BM_BfsFrom(benchmark::State& st) {
+    const auto& k = Kronecker::get(static_cast<int>(st.range(0)));
+    size_t i = 0;
+    int64_t edges = 0;
+    for (auto _ : st) {
+        auto res = bfs::bfs_from(k.g, k.roots[i]);
+        benchmark::DoNotOptimize(res);
+        edges += k.edges[i];
+        i = (i + 1) % kRoots;
+    }
+    st.SetItemsProcessed(edges);
+}
+
+// Direction-optimizing BFS; the graph is undirected, so it is its own transpose.
+static void BM_BfsDirectionOptimizing(benchmark::State& st) {
+    const auto& k = Kronecker::get(static_cast<int>(st.range(0)));
+    size_t i = 0;
+    int64_t edges = 0;
+    for (auto _ : st) {
+        auto res = bfs::bfs_direction_optimizing(k.g, k.g, k.roots[i]);
+        benchmark::DoNotOptimize(res);
+        edges += k.edges[i];
+        i = (i + 1) % kRoots;
+    }
+    st.SetItemsProcessed(edges);
+}
+
+// Every root once.
+#define KRONECKER_SCALES                                                                           \
+    ->Arg(18)->Arg(20)->Arg(22)->Iterations(kRoots)->Unit(benchmark::kMillisecond)
+
+BENCHMARK(BM_BfsFrom) KRONECKER_SCALES;
+BENCHMARK(BM_BfsDirectionOptimizing) KRONECKER_SCALES;
+
+BENCHMARK_MAIN();
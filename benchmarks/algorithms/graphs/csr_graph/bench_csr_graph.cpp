@@ -0,0 +1,257 @@
+#include "algorithms/graphs/bfs/bfs.h"
+#include "algorithms/graphs/csr_graph/csr_file.h"
+#include "algorithms/graphs/csr_graph/csr_graph.h"
+#include "algorithms/graphs/dijkstra/dijkstra.h"
+#include "algorithms/graphs/kosaraju_scc/kosaraju_scc.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <charconv>
+#include <cstdint>
+#include <cstdio>
+#include <filesystem>
+#include <map>
+#include <random>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+namespace {
+namespace bfs = algorithms::graphs::bfs;
+namespace csr = algorithms::graphs::csr_graph;
+namespace dijkstra = algorithms::graphs::dijkstra;
+namespace scc = algorithms::graphs::kosaraju_scc;
+
+constexpr int kAvgDegree = 8;
+
+// Random directed graph with n vertices and kAvgDegree * n arcs whose endpoints
+// are uniform, added in random order as an edge-list loader would. Both
+// representations hold the same arcs in the same per-vertex order, so every
+// algorithm does exactly the same work on them.
+template <typename Adj, typename MakeArc> Adj make_adjacency(int32_t n, MakeArc make_arc) {
+    std::mt19937 rng(12345);
+    Adj g(static_cast<size_t>(n));
+    const int64_t m = int64_t{kAvgDegree} * n;
+    for (int64_t i = 0; i < m; ++i) {
+        const auto u = static_cast<size_t>(rng() % static_cast<uint32_t>(n));
+        g[u].push_back(make_arc(rng));
+    }
+    return g;
+}
+
+// Graphs are generated once per size and kind. The unweighted ones are dropped
+// before the weighted ones are built: a 10M-vertex adjacency list and its CSR
+// copy already take about 2 GB together.
+struct Unweighted {
+    bfs::AdjList adj;
+    csr::CsrGraph<> csr;
+
+    static std::map<int32_t, Unweighted>& all() {
+        static std::map<int32_t, Unweighted> cache;
+        return cache;
+    }
+
+    static const Unweighted& get(int32_t n) {
+        auto [it, inserted] = all().try_emplace(n);
+        if (inserted) {
+            it->second.adj = make_adjacency<bfs::AdjList>(n, [n](std::mt19937& rng) {
+                return static_cast<int32_t>(rng() % static_cast<uint32_t>(n));
+            });
+            it->second.csr = csr::csr_from_adjacency(it->second.adj);
+        }
+        return it->second;
+    }
+};
+
+struct Weighted {
+    dijkstra::Graph adj;
+    dijkstra::CsrGraph csr;
+
+    static const Weighted& get(int32_t n) {
+        static std::map<int32_t, Weighted> cache;
+        Unweighted::all().clear();
+        auto [it, inserted] = cache.try_emplace(n);
+        if (inserted) {
+            it->second.adj = make_adjacency<dijkstra::Graph>(n, [n](std::mt19937& rng) {
+                return dijkstra::Edge{static_cast<int32_t>(rng() % static_cast<uint32_t>(n)),
+                                      static_cast<int32_t>(rng() % 1000 + 1)};
+            });
+            it->second.csr = csr::csr_from_adjacency(it->second.adj);
+        }
+        return it->second;
+    }
+};
+
+// Text edge list ("from to" per line) of a graph like make_adjacency's, and its
+// binary CSR conversion, written once per size to the temp directory.
+struct EdgeListFiles {
+    std::string text;
+    std::string csr;
+    int64_t edges = 0;
+
+    static const EdgeListFiles& get(int32_t n) {
+        static std::map<int32_t, EdgeListFiles> cache;
+        auto [it, inserted] = cache.try_emplace(n);
+        if (inserted) {
+            const auto dir = std::filesystem::temp_directory_path();
+            const auto stem = "bench_csr_graph_" + std::to_string(n);
+            it->second.text = (dir / (stem + ".txt")).string();
+            it->second.csr = (dir / (stem + ".csr")).string();
+            std::mt19937 rng(12345);
+            std::FILE* f = std::fopen(it->second.text.c_str(), "w");
+            const int64_t m = int64_t{kAvgDegree} * n;
+            for (int64_t i = 0; i < m; ++i) {
+                const auto u = static_cast<uint32_t>(rng() % static_cast<uint32_t>(n));
+                const auto v = static_cast<uint32_t>(rng() % static_cast<uint32_t>(n));
+                std::fprintf(f, "%u %u\n", u, v);
+            }
+            std::fclose(f);
+            it->second.edges = csr::convert_edge_list<void>(it->second.text, it->second.csr)->edges;
+        }
+        return it->second;
+    }
+};
+
+// What loading looks like without the binary format: read the text, parse it
+// with std::from_chars and push_back into an adjacency list that grows as ids
+// appear.
+bfs::AdjList load_text_adjacency(const std::string& path) {
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    std::fseek(f, 0, SEEK_END);
+    std::string text(static_cast<size_t>(std::ftell(f)), '\0');
+    std::fseek(f, 0, SEEK_SET);
+    const size_t read = std::fread(text.data(), 1, text.size(), f);
+    std::fclose(f);
+    text.resize(read);
+
+    bfs::AdjList g;
+    const char* p = text.data();
+    const char* end = p + text.size();
+    while (p < end) {
+        int32_t u = 0;
+        int32_t v = 0;
+        p = std::from_chars(p, end, u).ptr + 1;
+        p = std::from_chars(p, end, v).ptr + 1;
+        const auto needed = static_cast<size_t>(std::max(u, v)) + 1;
+        if (g.size() < needed) {
+            g.resize(needed);
+        }
+        g[static_cast<size_t>(u)].push_back(v);
+    }
+    return g;
+}
+
+struct AdjListRep {};
+struct CsrRep {};
+
+template <typename Rep, typename Cache> const auto& pick(const Cache& cache) {
+    if constexpr (std::is_same_v<Rep, CsrRep>) {
+        return cache.csr;
+    } else {
+        return cache.adj;
+    }
+}
+} // namespace
+
+template <typename Rep> static void BM_Bfs(benchmark::State& st) {
+    const auto& cache = Unweighted::get(static_cast<int32_t>(st.range(0)));
+    const auto& g = pick<Rep>(cache);
+    for (auto _ : st) {
+        auto res = bfs::bfs_from(g, 0);
+        benchmark::DoNotOptimize(res);
+    }
+    st.SetItemsProcessed(st.iterations() * cache.csr.edges());
+}
+
+template <typename Rep> static void BM_Dijkstra(benchmark::State& st) {
+    const auto& cache = Weighted::get(static_cast<int32_t>(st.range(0)));
+    const auto& g = pick<Rep>(cache);
+    for (auto _ : st) {
+        auto dist = dijkstra::dijkstra_queue(g, 0);
+        benchmark::DoNotOptimize(dist);
+    }
+    st.SetItemsProcessed(st.iterations() * cache.csr.edges());
+}
+
+template <typename Rep> static void BM_Scc(benchmark::State& st) {
+    const auto& cache = Unweighted::get(static_cast<int32_t>(st.range(0)));
+    const auto& g = pick<Rep>(cache);
+    for (auto _ : st) {
+        auto res = scc::kosaraju_scc(g);
+        benchmark::DoNotOptimize(res);
+    }
+    st.SetItemsProcessed(st.iterations() * cache.csr.edges());
+}
+
+// Building the CSR copy from an adjacency list (one-off conversion cost).
+static void BM_BuildCsr(benchmark::State& st) {
+    const auto& cache = Unweighted::get(static_cast<int32_t>(st.range(0)));
+    for (auto _ : st) {
+        auto g = csr::csr_from_adjacency(cache.adj);
+        benchmark::DoNotOptimize(g);
+    }
+    st.SetItemsProcessed(st.iterations() * cache.csr.edges());
+}
+
+// Text file -> adjacency list, the load path the binary format replaces.
+static void BM_LoadTextAdjList(benchmark::State& st) {
+    const auto& files = EdgeListFiles::get(static_cast<int32_t>(st.range(0)));
+    for (auto _ : st) {
+        auto g = load_text_adjacency(files.text);
+        benchmark::DoNotOptimize(g);
+    }
+    st.SetItemsProcessed(st.iterations() * files.edges);
+}
+
+// Text file -> binary CSR file (one-off conversion).
+static void BM_ConvertEdgeList(benchmark::State& st) {
+    const auto& files = EdgeListFiles::get(static_cast<int32_t>(st.range(0)));
+    for (auto _ : st) {
+        auto stats = csr::convert_edge_list<void>(files.text, files.csr);
+        benchmark::DoNotOptimize(stats);
+    }
+    st.SetItemsProcessed(st.iterations() * files.edges);
+}
+
+// Binary CSR file -> CsrGraph view.
+template <csr::CsrVerify Verify> static void BM_LoadCsr(benchmark::State& st) {
+    const auto& files = EdgeListFiles::get(static_cast<int32_t>(st.range(0)));
+    for (auto _ : st) {
+        auto g = csr::load_csr<void>(files.csr, Verify);
+        benchmark::DoNotOptimize(g);
+    }
+    st.SetItemsProcessed(st.iterations() * files.edges);
+}
+
+// Load without verification plus one BFS: the pages are read during the traversal.
+static void BM_LoadCsrAndBfs(benchmark::State& st) {
+    const auto& files = EdgeListFiles::get(static_cast<int32_t>(st.range(0)));
+    for (auto _ : st) {
+        auto res = bfs::bfs_from(*csr::load_csr<void>(files.csr, csr::CsrVerify::kHeaderOnly), 0);
+        benchmark::DoNotOptimize(res);
+    }
+    st.SetItemsProcessed(st.iterations() * files.edges);
+}
+
+// Loading benchmarks first: they keep nothing in memory but the files.
+#define GRAPH_SIZES ->Arg(1'000'000)->Arg(10'000'000)->Unit(benchmark::kMillisecond)
+
+BENCHMARK(BM_LoadTextAdjList) GRAPH_SIZES;
+BENCHMARK(BM_ConvertEdgeList) GRAPH_SIZES;
+BENCHMARK(BM_LoadCsr<csr::CsrVerify::kHeaderOnly>)
+    ->Arg(1'000'000)
+    ->Arg(10'000'000)
+    ->Unit(benchmark::kMicrosecond);
+BENCHMARK(BM_LoadCsr<csr::CsrVerify::kFull>) GRAPH_SIZES;
+BENCHMARK(BM_LoadCsrAndBfs) GRAPH_SIZES;
+
+// Then unweighted benchmarks: the weighted graphs replace them in memory.
+BENCHMARK(BM_Bfs<AdjListRep>) GRAPH_SIZES;
+BENCHMARK(BM_Bfs<CsrRep>) GRAPH_SIZES;
+BENCHMARK(BM_Scc<AdjListRep>) GRAPH_SIZES;
+BENCHMARK(BM_Scc<CsrRep>) GRAPH_SIZES;
+BENCHMARK(BM_BuildCsr) GRAPH_SIZES;
+BENCHMARK(BM_Dijkstra<AdjListRep>) GRAPH_SIZES;
+BENCHMARK(BM_Dijkstra<CsrRep>) GRAPH_SIZES;
+
+BENCHMARK_MAIN();
@@ -0,0 +1,193 @@
+#include "data_structures/associative/ordered_map/ordered_map.h"
+#include "data_structures/associative/ordered_map/persistent_ordered_map.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <functional>
+#include <random>
+#include <vector>
+
+namespace om = ds::ordered_map;
+
+namespace {
+using PlainMap  = om::OrderedMap<std::uint64_t, std::uint64_t>;
+using RankedMap = om::OrderedMap<std::uint64_t, std::uint64_t, std::less<>, om::SubtreeSize>;
+using PersistentMap = om::PersistentOrderedMap<std::uint64_t, std::uint64_t>;
+using ArenaMap  = om::OrderedMap<std::uint64_t, std::uint64_t, std::less<>, om::NoAugment,
+                                 om::ArenaAllocator>;
+
+std::vector<std::uint64_t> random_keys(std::size_t n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<std::uint64_t> keys(n);
+    for (auto& k : keys)
+        k = rng();
+    return keys;
+}
+} // namespace
+
+// Build cost: how much the subtree-size bookkeeping adds to insert.
+template <typename MapT> static void BM_Insert(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        MapT m;
+        for (auto k : keys)
+            m.insert(k, k);
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Leaderboard loop: one score update followed by one "k-th smallest" query.
+static void BM_UpdateSelect_Augmented(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    RankedMap m;
+    for (auto k : random_keys(n, 2))
+        m.insert(k, k);
+    std::mt19937_64 rng(3);
+    for (auto _ : state) {
+        m.insert(rng(), 0);
+        benchmark::DoNotOptimize(m.select(rng() % m.size()));
+    }
+}
+
+// Fallback: keys kept in a vector, sorted on demand and indexed.
+static void BM_UpdateSelect_SortScan(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto keys = random_keys(n, 2);
+    std::mt19937_64 rng(3);
+    for (auto _ : state) {
+        keys.push_back(rng());
+        std::sort(keys.begin(), keys.end());
+        benchmark::DoNotOptimize(keys[rng() % keys.size()]);
+    }
+}
+
+// "Rank of key" and "how many in [a, b)" on a static set.
+static void BM_RankRange_Augmented(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    RankedMap m;
+    for (auto k : random_keys(n, 4))
+        m.insert(k, k);
+    std::mt19937_64 rng(5);
+    for (auto _ : state) {
+        auto a = rng(), b = rng();
+        benchmark::DoNotOptimize(m.rank(a));
+        benchmark::DoNotOptimize(m.count_in_range(std::min(a, b), std::max(a, b)));
+    }
+}
+
+static void BM_RankRange_Scan(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    const auto keys = random_keys(n, 4);
+    std::mt19937_64 rng(5);
+    for (auto _ : state) {
+        auto a = rng(), b = rng();
+        auto lo = std::min(a, b), hi = std::max(a, b);
+        benchmark::DoNotOptimize(
+            std::count_if(keys.begin(), keys.end(), [a](auto k) { return k < a; }));
+        benchmark::DoNotOptimize(std::count_if(keys.begin(), keys.end(),
+                                               [lo, hi](auto k) { return lo <= k && k < hi; }));
+    }
+}
+
+// Copy of a fully built map (copy_tree): one allocation per node vs arena carving.
+template <typename MapT> static void BM_Copy(benchmark::State& state) {
+    MapT m;
+    for (auto k : random_keys(static_cast<std::size_t>(state.range(0)), 1))
+        m.insert(k, k);
+    for (auto _ : state) {
+        MapT c(m);
+        benchmark::DoNotOptimize(c.size());
+        state.PauseTiming();
+        c.clear();
+        state.ResumeTiming();
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Teardown only: clear() on a fully built map.
+template <typename MapT> static void BM_Clear(benchmark::State& state) {
+    const auto keys = random_keys(static_cast<std::size_t>(state.range(0)), 1);
+    for (auto _ : state) {
+        state.PauseTiming();
+        MapT m;
+        for (auto k : keys)
+            m.insert(k, k);
+        state.ResumeTiming();
+        m.clear();
+        benchmark::DoNotOptimize(m.size());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// Lookups after a churny build: erase half, reinsert new keys (free-list reuse).
+template <typename MapT> static void BM_FindAfterChurn(benchmark::State& state) {
+    const auto n = static_cast<std::size_t>(state.range(0));
+    auto keys = random_keys(n, 6);
+    MapT m;
+    for (auto k : keys)
+        m.insert(k, k);
+    std::mt19937_64 rng(7);
+    for (std::size_t i = 0; i < n; i += 2) {
+        m.erase(keys[i]);
+        keys[i] = rng();
+        m.insert(keys[i], keys[i]);
+    }
+    std::size_t i = 0;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(m.find(keys[i]));
+        i = (i + 7919) % n;
+    }
+}
+
+// Versioned index: take a snapshot for readers, then apply a batch of
+// state.range(1) writes. OrderedMap has to deep-copy; the persistent map
+// shares the tree and copies only the touched paths.
+template <typename MapT> static void BM_SnapshotMutate(benchmark::State& state) {
+    const auto n     = static_cast<std::size_t>(state.range(0));
+    const auto batch = static_cast<int>(state.range(1));
+    auto keys        = random_keys(n, 8);
+    MapT m;
+    for (auto k : keys)
+        m.insert(k, k);
+    std::mt19937_64 rng(9);
+    std::size_t i = 0;
+    for (auto _ : state) {
+        MapT snap(m);
+        for (int b = 0; b < batch; ++b) {
+            m.erase(keys[i]);
+            keys[i] = rng();
+            m.insert(keys[i], keys[i]);
+            i = (i + 1) % n;
+        }
+        benchmark::DoNotOptimize(snap.size());
+    }
+    state.SetItemsProcessed(state.iterations() * batch);
+}
+
+BENCHMARK(BM_Insert<PlainMap>)->Arg(1 << 16);
+BENCHMARK(BM_Insert<RankedMap>)->Arg(1 << 16);
+BENCHMARK(BM_Insert<PersistentMap>)->Arg(1 << 16);
+BENCHMARK(BM_SnapshotMutate<PlainMap>)->Args({1 << 12, 16})->Args({1 << 16, 16})->Args({1 << 16, 1024});
+BENCHMARK(BM_SnapshotMutate<PersistentMap>)
+    ->Args({1 << 12, 16})
+    ->Args({1 << 16, 16})
+    ->Args({1 << 16, 1024});
+BENCHMARK(BM_Insert<ArenaMap>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Insert<PlainMap>)->Arg(1 << 20);
+BENCHMARK(BM_Copy<PlainMap>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Copy<ArenaMap>)->Arg(1 << 16)->Arg(1 << 20);
+// Each iteration rebuilds untimed, so pin the iteration count.
+BENCHMARK(BM_Clear<PlainMap>)->Arg(1 << 16)->Iterations(50);
+BENCHMARK(BM_Clear<ArenaMap>)->Arg(1 << 16)->Iterations(50);
+BENCHMARK(BM_Clear<PlainMap>)->Arg(1 << 20)->Iterations(3);
+BENCHMARK(BM_Clear<ArenaMap>)->Arg(1 << 20)->Iterations(3);
+BENCHMARK(BM_FindAfterChurn<PlainMap>)->Arg(1 << 20);
+BENCHMARK(BM_FindAfterChurn<ArenaMap>)->Arg(1 << 20);
+BENCHMARK(BM_UpdateSelect_Augmented)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17);
+BENCHMARK(BM_UpdateSelect_SortScan)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17);
+BENCHMARK(BM_RankRange_Augmented)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17);
+BENCHMARK(BM_RankRange_Scan)->Arg(1 << 10)->Arg(1 << 14)->Arg(1 << 17);
+
+BENCHMARK_MAIN();
@@ -0,0 +1,208 @@
+#include "data_structures/dsu/concurrent_dsu.h"
+#include "data_structures/dsu/dsu.h"
+#include "data_structures/dsu/dsu_rank.h"
+#include "data_structures/dsu/dynamic_connectivity.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <map>
+#include <thread>
+#include <utility>
+#include <vector>
+
+using namespace ds::dsu;
+
+namespace {
+using Edge = std::pair<int, int>;
+
+// Cheap generator: 100M edges with std::mt19937 would dominate setup.
+struct XorShift {
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    uint64_t operator()() {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return s;
+    }
+};
+
+// m uniformly random edges over n = m / 4 vertices (average degree 8: one
+// giant component plus isolated stragglers), generated once per m.
+const std::vector<Edge>& random_edges(int64_t m) {
+    static std::map<int64_t, std::vector<Edge>> cache;
+    auto& edges = cache[m];
+    if (edges.empty()) {
+        const auto n = static_cast<uint64_t>(m / 4);
+        XorShift rng;
+        edges.resize(static_cast<size_t>(m));
+        for (auto& [a, b] : edges) {
+            const uint64_t r = rng();
+            a = static_cast<int>((r & 0xFFFFFFFF) % n);
+            b = static_cast<int>((r >> 32) % n);
+        }
+    }
+    return edges;
+}
+} // namespace
+
+// ---- connected components of a random graph: Args m edges [, threads] ----
+
+template <typename Dsu> static void BM_Components_Sequential(benchmark::State& state) {
+    const int64_t m = state.range(0);
+    const auto& edges = random_edges(m);
+    for (auto _ : state) {
+        Dsu dsu(static_cast<int>(m / 4));
+        for (auto [a, b] : edges)
+            dsu.unite(a, b);
+        state.counters["components"] = dsu.components();
+    }
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+// Same edges through DisjointSetUnion::unite_batch (prefetching bulk pass).
+static void BM_Components_Batch(benchmark::State& state) {
+    const int64_t m = state.range(0);
+    const auto& edges = random_edges(m);
+    for (auto _ : state) {
+        DisjointSetUnion dsu(static_cast<int>(m / 4));
+        benchmark::DoNotOptimize(dsu.unite_batch(edges));
+        state.counters["components"] = dsu.components();
+    }
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+// Each thread unites one contiguous slice of the edge list. Wall-clock time,
+// thread start-up included.
+static void BM_Components_Concurrent(benchmark::State& state) {
+    const int64_t m = state.range(0);
+    const int threads = static_cast<int>(state.range(1));
+    const auto& edges = random_edges(m);
+    for (auto _ : state) {
+        ConcurrentDisjointSetUnion dsu(static_cast<int>(m / 4));
+        std::vector<std::thread> pool;
+        for (int t = 0; t < threads; ++t) {
+            pool.emplace_back([&, t] {
+                const size_t lo = edges.size() * static_cast<size_t>(t) / threads;
+                const size_t hi = edges.size() * static_cast<size_t>(t + 1) / threads;
+                for (size_t i = lo; i < hi; ++i)
+                    dsu.unite(edges[i].first, edges[i].second);
+            });
+        }
+        for (auto& th : pool)
+            th.join();
+        state.counters["components"] = dsu.components();
+    }
+    state.SetItemsProcessed(state.iterations() * m);
+}
+
+#define EDGES Arg(10'000'000)->Arg(100'000'000)
+BENCHMARK(BM_Components_Sequential<DisjointSetUnion>)
+    ->EDGES->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+BENCHMARK(BM_Components_Sequential<DisjointSetUnionRank>)
+    ->EDGES->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+BENCHMARK(BM_Components_Batch)->EDGES->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(BM_Components_Concurrent)
+    ->ArgsProduct({{10'000'000, 100'000'000}, {1, 2, 4, 8, 16, 32, 64}})
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
+
+// ---- dynamic connectivity: Args ops ----
+// 40 % edge insertions, 20 % deletions of a random live edge, 40 % queries
+// connected(a, b), over n = ops / 8 vertices.
+
+namespace {
+struct DynOp {
+    int type; // 0 add, 1 remove, 2 query
+    int a, b;
+};
+
+std::vector<DynOp> dynamic_ops(int ops) {
+    const auto n = static_cast<uint64_t>(std::max(ops / 8, 1));
+    XorShift rng;
+    std::vector<DynOp> out;
+    std::vector<Edge> live;
+    out.reserve(static_cast<size_t>(ops));
+    for (int i = 0; i < ops; ++i) {
+        const uint64_t r = rng() % 10;
+        const auto a = static_cast<int>(rng() % n), b = static_cast<int>(rng() % n);
+        if (r < 4 || (r < 6 && live.empty())) {
+            out.push_back({0, a, b});
+            live.emplace_back(a, b);
+        } else if (r < 6) {
+            const size_t k = rng() % live.size();
+            out.push_back({1, live[k].first, live[k].second});
+            live[k] = live.back();
+            live.pop_back();
+        } else {
+            out.push_back({2, a, b});
+        }
+    }
+    return out;
+}
+} // namespace
+
+static void BM_DynamicConnectivity_Offline(benchmark::State& state) {
+    const int ops = static_cast<int>(state.range(0));
+    const auto trace = dynamic_ops(ops);
+    for (auto _ : state) {
+        OfflineDynamicConnectivity dc(std::max(ops / 8, 1));
+        for (const auto& op : trace) {
+            if (op.type == 0)
+                dc.add_edge(op.a, op.b);
+            else if (op.type == 1)
+                dc.remove_edge(op.a, op.b);
+            else
+                dc.query_connected(op.a, op.b);
+        }
+        benchmark::DoNotOptimize(dc.solve());
+    }
+    state.SetItemsProcessed(state.iterations() * ops);
+}
+
+// Baseline: incremental DSU on insertions, rebuilt from the live edges on
+// every deletion.
+static void BM_DynamicConnectivity_Recompute(benchmark::State& state) {
+    const int ops = static_cast<int>(state.range(0));
+    const int n = std::max(ops / 8, 1);
+    const auto trace = dynamic_ops(ops);
+    for (auto _ : state) {
+        DisjointSetUnion dsu(n);
+        std::vector<Edge> live;
+        int connected = 0;
+        for (const auto& op : trace) {
+            if (op.type == 0) {
+                live.emplace_back(op.a, op.b);
+                dsu.unite(op.a, op.b);
+            } else if (op.type == 1) {
+                for (size_t i = 0; i < live.size(); ++i) {
+                    if (live[i] == Edge{op.a, op.b}) {
+                        live[i] = live.back();
+                        live.pop_back();
+                        break;
+                    }
+                }
+                dsu.assign(n);
+                for (auto [a, b] : live)
+                    dsu.unite(a, b);
+            } else {
+                connected += dsu.same(op.a, op.b) ? 1 : 0;
+            }
+        }
+        benchmark::DoNotOptimize(connected);
+    }
+    state.SetItemsProcessed(state.iterations() * ops);
+}
+
+BENCHMARK(BM_DynamicConnectivity_Offline)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->Arg(1'000'000)
+    ->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_DynamicConnectivity_Recompute)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->Unit(benchmark::kMillisecond); // quadratic: 1M operations would take ~10 minutes
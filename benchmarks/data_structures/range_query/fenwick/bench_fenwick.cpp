@@ -0,0 +1,343 @@
+#include "data_structures/range_query/fenwick/basic_fenwick.h"
+#include "data_structures/range_query/fenwick/blocked_fenwick.h"
+#include "data_structures/range_query/fenwick/concurrent_fenwick.h"
+#include "data_structures/range_query/fenwick/fenwick.h"
+#include "data_structures/range_query/fenwick/fenwick_2d.h"
+#include "data_structures/range_query/sqrt_decomposition/sqrt_decomposition.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <memory>
+#include <mutex>
+#include <random>
+#include <vector>
+
+using namespace ds::range_query::fenwick;
+using ds::range_query::sqrt_decomposition::SqrtDecomposition;
+
+namespace {
+std::vector<int64_t> random_values(int n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<int64_t> a(static_cast<size_t>(n));
+    for (auto& x : a)
+        x = static_cast<int64_t>(rng() % 1000);
+    return a;
+}
+
+struct Range {
+    int l, r;
+};
+
+std::vector<Range> random_ranges(int n, int count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> d(0, n - 1);
+    std::vector<Range> out(static_cast<size_t>(count));
+    for (auto& q : out) {
+        q.l = d(rng);
+        q.r = d(rng);
+        if (q.l > q.r)
+            std::swap(q.l, q.r);
+    }
+    return out;
+}
+} // namespace
+
+// ---- construction from a vector ----
+
+template <typename T> static void BM_Build(benchmark::State& state) {
+    const auto a = random_values(static_cast<int>(state.range(0)), 1);
+    for (auto _ : state) {
+        T t(a);
+        benchmark::DoNotOptimize(t);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+// ---- point add + range sum (the workload FenwickTree was built for) ----
+
+static void BM_PointRange_FenwickTree(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    FenwickTree t(random_values(n, 2));
+    const auto qs = random_ranges(n, 4096, 3);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        t.add(q.l, 1);
+        benchmark::DoNotOptimize(t.range_sum(q.l, q.r));
+    }
+}
+
+static void BM_PointRange_Basic(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    BasicFenwickTree<int64_t> t(random_values(n, 2));
+    const auto qs = random_ranges(n, 4096, 3);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        t.add(q.l, 1);
+        benchmark::DoNotOptimize(t.range_sum(q.l, q.r));
+    }
+}
+
+static void BM_PointRange_Sqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtDecomposition t(random_values(n, 2));
+    const auto qs = random_ranges(n, 4096, 3);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        t.update(q.l, q.r);
+        benchmark::DoNotOptimize(t.query(q.l, q.r));
+    }
+}
+
+// ---- range add + range sum ----
+
+static void BM_RangeRange_RangeFenwick(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    RangeFenwickTree<int64_t> t(random_values(n, 4));
+    const auto qs = random_ranges(n, 4096, 5);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        t.range_add(q.l, q.r, 3);
+        benchmark::DoNotOptimize(t.range_sum(q.r / 2, q.r));
+    }
+}
+
+// Without range updates the only option is one point add per element.
+static void BM_RangeRange_FenwickTree(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    FenwickTree t(random_values(n, 4));
+    const auto qs = random_ranges(n, 4096, 5);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        for (int k = q.l; k <= q.r; ++k)
+            t.add(k, 3);
+        benchmark::DoNotOptimize(t.range_sum(q.r / 2, q.r));
+    }
+}
+
+static void BM_RangeRange_Sqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    auto a = random_values(n, 4);
+    SqrtDecomposition t(a);
+    const auto qs = random_ranges(n, 4096, 5);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        for (int k = q.l; k <= q.r; ++k)
+            t.update(k, a[static_cast<size_t>(k)] += 3);
+        benchmark::DoNotOptimize(t.query(q.r / 2, q.r));
+    }
+}
+
+// ---- weighted sampling: find index by prefix ----
+
+static void BM_Sample_LowerBound(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    BasicFenwickTree<int64_t> t(random_values(n, 6));
+    const int64_t total = t.prefix_sum(n - 1);
+    std::mt19937_64 rng(7);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(t.lower_bound(static_cast<int64_t>(rng() % total) + 1));
+    }
+}
+
+// Binary search over prefix_sum: O(log^2 n).
+static void BM_Sample_BinarySearch(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    FenwickTree t(random_values(n, 6));
+    const int64_t total = t.prefix_sum(n - 1);
+    std::mt19937_64 rng(7);
+    for (auto _ : state) {
+        const int64_t target = static_cast<int64_t>(rng() % total) + 1;
+        int lo = 0, hi = n;
+        while (lo < hi) {
+            int mid = lo + (hi - lo) / 2;
+            if (t.prefix_sum(mid) < target)
+                lo = mid + 1;
+            else
+                hi = mid;
+        }
+        benchmark::DoNotOptimize(lo);
+    }
+}
+
+// ---- layout sweep: L1-resident to DRAM-resident ----
+
+namespace {
+// Cheap index stream so the generator does not dominate L1-sized runs.
+struct XorShift {
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    uint64_t operator()() {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return s;
+    }
+};
+} // namespace
+
+template <typename T> static void BM_Sweep_Prefix(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    T t(random_values(n, 8));
+    XorShift rng;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(t.prefix_sum(static_cast<int>(rng() % static_cast<uint64_t>(n))));
+    }
+    state.counters["bytes"] = static_cast<double>(n) * sizeof(int64_t);
+}
+
+template <typename T> static void BM_Sweep_Add(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    T t(n);
+    XorShift rng;
+    for (auto _ : state) {
+        t.add(static_cast<int>(rng() % static_cast<uint64_t>(n)), 1);
+    }
+    benchmark::DoNotOptimize(t.prefix_sum(n - 1));
+    state.counters["bytes"] = static_cast<double>(n) * sizeof(int64_t);
+}
+
+// 4 KiB (L1) .. 512 MiB (DRAM) of int64_t.
+#define SWEEP(FN, T) BENCHMARK(FN<T>)->RangeMultiplier(8)->Range(1 << 9, 1 << 26)
+
+SWEEP(BM_Sweep_Prefix, FenwickTree);
+SWEEP(BM_Sweep_Prefix, BlockedFenwickTree<int64_t>);
+SWEEP(BM_Sweep_Add, FenwickTree);
+SWEEP(BM_Sweep_Add, BlockedFenwickTree<int64_t>);
+
+// ---- 2D grid counts: rectangle query after a point increment ----
+
+static void BM_Grid_Fenwick2D(benchmark::State& state) {
+    const int side = static_cast<int>(state.range(0));
+    FenwickTree2D<int64_t> t(side, side);
+    XorShift rng;
+    for (auto _ : state) {
+        const int r = static_cast<int>(rng() % static_cast<uint64_t>(side));
+        const int c = static_cast<int>(rng() % static_cast<uint64_t>(side));
+        t.add(r, c, 1);
+        benchmark::DoNotOptimize(t.rect_sum(r / 2, c / 2, r, c));
+    }
+}
+
+// Baseline: one 1D Fenwick per row, rectangle = sum over its rows.
+static void BM_Grid_RowFenwicks(benchmark::State& state) {
+    const int side = static_cast<int>(state.range(0));
+    std::vector<FenwickTree> rows(static_cast<size_t>(side), FenwickTree(side));
+    XorShift rng;
+    for (auto _ : state) {
+        const int r = static_cast<int>(rng() % static_cast<uint64_t>(side));
+        const int c = static_cast<int>(rng() % static_cast<uint64_t>(side));
+        rows[static_cast<size_t>(r)].add(c, 1);
+        int64_t sum = 0;
+        for (int i = r / 2; i <= r; ++i)
+            sum += rows[static_cast<size_t>(i)].range_sum(c / 2, c);
+        benchmark::DoNotOptimize(sum);
+    }
+}
+
+// ---- concurrent counters: shared histogram updated by 1..64 threads ----
+// Args: n buckets. Thread 0 builds the shared tree before the timed loop;
+// each thread then adds 1 to uniformly random buckets.
+
+namespace {
+struct LockedFenwick {
+    std::mutex m;
+    FenwickTree t;
+    explicit LockedFenwick(int n) : t(n) {}
+    void add(int idx, int64_t delta) {
+        std::lock_guard<std::mutex> lock(m);
+        t.add(idx, delta);
+    }
+};
+
+std::unique_ptr<LockedFenwick> g_locked;
+std::unique_ptr<ConcurrentFenwickTree> g_concurrent;
+std::unique_ptr<ShardedFenwickTree> g_sharded;
+} // namespace
+
+template <typename Tree>
+static void run_adds(benchmark::State& state, std::unique_ptr<Tree>& shared,
+                     std::unique_ptr<Tree> (*make)(int n, int threads)) {
+    const int n = static_cast<int>(state.range(0));
+    if (state.thread_index() == 0)
+        shared = make(n, state.threads());
+    XorShift rng{0x9E3779B97F4A7C15ull + static_cast<uint64_t>(state.thread_index())};
+    for (auto _ : state) {
+        shared->add(static_cast<int>(rng() % static_cast<uint64_t>(n)), 1);
+    }
+    state.SetItemsProcessed(state.iterations());
+    if (state.thread_index() == 0)
+        shared.reset();
+}
+
+static void BM_ConcurrentAdd_Mutex(benchmark::State& state) {
+    run_adds<LockedFenwick>(state, g_locked, [](int n, int) {
+        return std::make_unique<LockedFenwick>(n);
+    });
+}
+
+static void BM_ConcurrentAdd_Atomic(benchmark::State& state) {
+    run_adds<ConcurrentFenwickTree>(state, g_concurrent, [](int n, int) {
+        return std::make_unique<ConcurrentFenwickTree>(n);
+    });
+}
+
+// One shard per benchmark thread.
+static void BM_ConcurrentAdd_Sharded(benchmark::State& state) {
+    run_adds<ShardedFenwickTree>(state, g_sharded, [](int n, int threads) {
+        return std::make_unique<ShardedFenwickTree>(n, threads);
+    });
+}
+
+// Query side of the trade: a sharded prefix sum merges every shard.
+static void BM_ConcurrentPrefix_Atomic(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    ConcurrentFenwickTree t(random_values(n, 9));
+    XorShift rng;
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(t.prefix_sum(static_cast<int>(rng() % static_cast<uint64_t>(n))));
+    }
+}
+
+// Args: n, shards.
+static void BM_ConcurrentPrefix_Sharded(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    ShardedFenwickTree t(n, static_cast<int>(state.range(1)));
+    XorShift rng;
+    for (int i = 0; i < n; ++i)
+        t.add(static_cast<int>(rng() % static_cast<uint64_t>(state.range(1))), i, 1);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(t.prefix_sum(static_cast<int>(rng() % static_cast<uint64_t>(n))));
+    }
+}
+
+BENCHMARK(BM_Grid_Fenwick2D)->Arg(256)->Arg(4096);
+BENCHMARK(BM_Grid_RowFenwicks)->Arg(256)->Arg(4096);
+
+BENCHMARK(BM_Build<FenwickTree>)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_Build<BasicFenwickTree<int64_t>>)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_Build<SqrtDecomposition>)->Arg(1 << 16)->Arg(1 << 22);
+
+BENCHMARK(BM_PointRange_FenwickTree)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_PointRange_Basic)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_PointRange_Sqrt)->Arg(1 << 16)->Arg(1 << 22);
+
+BENCHMARK(BM_RangeRange_RangeFenwick)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK(BM_RangeRange_FenwickTree)->Arg(1 << 12)->Arg(1 << 16);
+BENCHMARK(BM_RangeRange_Sqrt)->Arg(1 << 12)->Arg(1 << 16);
+
+BENCHMARK(BM_Sample_LowerBound)->Arg(1 << 16)->Arg(1 << 22);
+BENCHMARK(BM_Sample_BinarySearch)->Arg(1 << 16)->Arg(1 << 22);
+
+#define CONCURRENT_ARGS Arg(1 << 10)->Arg(1 << 20)->ThreadRange(1, 64)->UseRealTime()
+BENCHMARK(BM_ConcurrentAdd_Mutex)->CONCURRENT_ARGS;
+BENCHMARK(BM_ConcurrentAdd_Atomic)->CONCURRENT_ARGS;
+BENCHMARK(BM_ConcurrentAdd_Sharded)->CONCURRENT_ARGS;
+BENCHMARK(BM_ConcurrentPrefix_Atomic)->Arg(1 << 10)->Arg(1 << 20);
+BENCHMARK(BM_ConcurrentPrefix_Sharded)->ArgsProduct({{1 << 10, 1 << 20}, {8, 64}});
+
+BENCHMARK_MAIN();
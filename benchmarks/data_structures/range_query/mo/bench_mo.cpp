@@ -0,0 +1,100 @@
+#include "data_structures/range_query/mo/mo.h"
+#include "data_structures/range_query/mo/mo_engine.h"
+
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace ds::range_query::mo;
+
+namespace {
+std::vector<int> random_values(int n, int distinct, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> a(static_cast<size_t>(n));
+    for (auto& x : a)
+        x = static_cast<int>(rng() % static_cast<unsigned>(distinct));
+    return a;
+}
+
+std::vector<Query> random_queries(int n, int q, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> d(0, n - 1);
+    std::vector<Query> out(static_cast<size_t>(q));
+    for (int i = 0; i < q; ++i) {
+        int l = d(rng), r = d(rng);
+        if (l > r)
+            std::swap(l, r);
+        out[static_cast<size_t>(i)] = {l, r, i};
+    }
+    return out;
+}
+} // namespace
+
+// Distinct count over Q = 10^6 random queries; Arg: N.
+template <MoOrder Order> static void BM_Distinct(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto a = random_values(n, n / 4, 1);
+    const auto queries = random_queries(n, 1'000'000, 2);
+    for (auto _ : state) {
+        auto ans = mo_solve_distinct(a, queries, Order);
+        benchmark::DoNotOptimize(ans.data());
+    }
+    auto sorted = queries;
+    sort_queries(sorted, n, Order);
+    state.counters["moves"] = static_cast<double>(count_moves(sorted));
+}
+
+// Sorting alone: the Hilbert key costs more than the block comparator.
+template <MoOrder Order> static void BM_Sort(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto queries = random_queries(n, 1'000'000, 2);
+    for (auto _ : state) {
+        auto q = queries;
+        sort_queries(q, n, Order);
+        benchmark::DoNotOptimize(q.data());
+    }
+}
+
+BENCHMARK(BM_Distinct<MoOrder::kBlockOddEven>)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->Arg(1'000'000)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(2);
+BENCHMARK(BM_Distinct<MoOrder::kHilbert>)
+    ->Arg(10'000)
+    ->Arg(100'000)
+    ->Arg(1'000'000)
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(2);
+BENCHMARK(BM_Sort<MoOrder::kBlockOddEven>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_Sort<MoOrder::kHilbert>)->Arg(1'000'000)->Unit(benchmark::kMillisecond);
+
+// Parallel mode on Q = 10^7 queries, N = 2^17; Arg: threads. Wall time
+// (UseRealTime); `moves` includes every chunk's first window.
+static void BM_Parallel(benchmark::State& state) {
+    const int n = 1 << 17;
+    const int threads = static_cast<int>(state.range(0));
+    const auto a = random_values(n, n / 4, 3);
+    const auto queries = random_queries(n, 10'000'000, 4);
+    for (auto _ : state) {
+        auto ans = mo_solve_distinct(a, queries, MoOrder::kHilbert, threads);
+        benchmark::DoNotOptimize(ans.data());
+    }
+    auto sorted = queries;
+    sort_queries(sorted, n, MoOrder::kHilbert);
+    const auto bounds = partition_queries(sorted, threads);
+    int64_t moves = 0;
+    for (size_t c = 0; c + 1 < bounds.size(); ++c)
+        moves += count_moves({sorted.begin() + static_cast<std::ptrdiff_t>(bounds[c]),
+                              sorted.begin() + static_cast<std::ptrdiff_t>(bounds[c + 1])});
+    state.counters["moves"] = static_cast<double>(moves);
+}
+
+BENCHMARK(BM_Parallel)
+    ->RangeMultiplier(2)
+    ->Range(1, 64)
+    ->UseRealTime()
+    ->Unit(benchmark::kMillisecond)
+    ->Iterations(1);
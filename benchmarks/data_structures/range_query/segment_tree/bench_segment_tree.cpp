@@ -0,0 +1,245 @@
+#include "data_structures/range_query/fenwick/fenwick.h"
+#include "data_structures/range_query/segment_tree/lazy_segment_tree.h"
+#include "data_structures/range_query/segment_tree/persistent_segment_tree.h"
+#include "data_structures/range_query/sqrt_decomposition/sqrt_decomposition.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using namespace ds::range_query::segment_tree;
+using ds::range_query::fenwick::FenwickTree;
+using ds::range_query::sqrt_decomposition::SqrtDecomposition;
+
+namespace {
+std::vector<int64_t> random_values(int n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<int64_t> a(static_cast<size_t>(n));
+    for (auto& x : a)
+        x = static_cast<int64_t>(rng() % 1000);
+    return a;
+}
+
+// One operation of a mixed workload: update if upd, otherwise query.
+struct Op {
+    bool upd;
+    int l, r;
+    int64_t v;
+};
+
+// update_pct percent updates, the rest queries, random ranges.
+std::vector<Op> random_ops(int n, int update_pct, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> d(0, n - 1);
+    std::vector<Op> out(4096);
+    for (auto& op : out) {
+        op.upd = static_cast<int>(rng() % 100) < update_pct;
+        op.l = d(rng);
+        op.r = d(rng);
+        if (op.l > op.r)
+            std::swap(op.l, op.r);
+        op.v = static_cast<int64_t>(rng() % 1000);
+    }
+    return out;
+}
+
+template <Layout L> using SumTree = LazySegmentTree<SumMonoid<int64_t>, AddAction<int64_t>, L>;
+template <Layout L>
+using MinAssignTree = LazySegmentTree<MinMonoid<int64_t>, AssignAction<int64_t>, L>;
+
+std::vector<SumLen<int64_t>> sum_leaves(const std::vector<int64_t>& a) {
+    std::vector<SumLen<int64_t>> out;
+    out.reserve(a.size());
+    for (auto x : a)
+        out.push_back(SumMonoid<int64_t>::leaf(x));
+    return out;
+}
+} // namespace
+
+// ---- point set + range sum: the workload SqrtDecomposition supports ----
+// Args: n, percent of updates.
+
+template <Layout L> static void BM_PointSetSum_Segment(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SumTree<L> t(sum_leaves(random_values(n, 1)));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 2);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.set(op.l, SumMonoid<int64_t>::leaf(op.v));
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+static void BM_PointSetSum_Sqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtDecomposition t(random_values(n, 1));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 2);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.update(op.l, op.v);
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+#define POINT_SET_ARGS ArgsProduct({{1 << 16, 1 << 20}, {10, 50, 90}})
+BENCHMARK(BM_PointSetSum_Segment<Layout::kSoA>)->POINT_SET_ARGS;
+BENCHMARK(BM_PointSetSum_Segment<Layout::kAoS>)->POINT_SET_ARGS;
+BENCHMARK(BM_PointSetSum_Sqrt)->POINT_SET_ARGS;
+
+// ---- range assign + range min (50 / 50) ----
+
+template <Layout L> static void BM_AssignMin_Segment(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    MinAssignTree<L> t(random_values(n, 3));
+    const auto ops = random_ops(n, 50, 4);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.apply(op.l, op.r, {op.v, true});
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+// Baseline without a lazy structure: O(r - l) fill and scan.
+static void BM_AssignMin_Array(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    auto a = random_values(n, 3);
+    const auto ops = random_ops(n, 50, 4);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            std::fill(a.begin() + op.l, a.begin() + op.r + 1, op.v);
+        else
+            benchmark::DoNotOptimize(*std::min_element(a.begin() + op.l, a.begin() + op.r + 1));
+    }
+}
+
+BENCHMARK(BM_AssignMin_Segment<Layout::kSoA>)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_AssignMin_Segment<Layout::kAoS>)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_AssignMin_Array)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+
+// ---- versioned range sum: persistent tree vs FenwickTree copies ----
+// Every update makes a new version; queries hit a random earlier version.
+
+namespace {
+constexpr int kVersions = 256;
+
+struct VersionedOp {
+    int ver, l, r;
+};
+
+std::vector<VersionedOp> random_versioned_ops(int n, int versions, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> d(0, n - 1), dv(0, versions - 1);
+    std::vector<VersionedOp> out(4096);
+    for (auto& op : out) {
+        op.ver = dv(rng);
+        op.l = d(rng);
+        op.r = d(rng);
+        if (op.l > op.r)
+            std::swap(op.l, op.r);
+    }
+    return out;
+}
+} // namespace
+
+// Path copy per update; bytes_per_update counts the arena nodes it adds.
+static void BM_VersionedUpdate_Persistent(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto ops = random_ops(n, 100, 5);
+    PersistentSegmentTree<int64_t> t(random_values(n, 1));
+    const size_t start = t.nodes();
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        benchmark::DoNotOptimize(t.add(t.versions() - 1, op.l, op.v));
+    }
+    state.counters["bytes_per_update"] =
+        static_cast<double>((t.nodes() - start) * 16) / static_cast<double>(state.iterations());
+}
+
+// Snapshot per update: copy the whole tree, then add.
+static void BM_VersionedUpdate_FenwickCopy(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto ops = random_ops(n, 100, 5);
+    FenwickTree cur(random_values(n, 1));
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        FenwickTree next = cur;
+        next.add(op.l, op.v);
+        cur = std::move(next);
+        benchmark::DoNotOptimize(cur);
+    }
+    state.counters["bytes_per_update"] = static_cast<double>(n) * sizeof(int64_t);
+}
+
+static void BM_VersionedQuery_Persistent(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto upd = random_ops(n, 100, 5);
+    PersistentSegmentTree<int64_t> t(random_values(n, 1));
+    for (int v = 1; v < kVersions; ++v)
+        t.add(v - 1, upd[static_cast<size_t>(v)].l, upd[static_cast<size_t>(v)].v);
+    const auto ops = random_versioned_ops(n, kVersions, 6);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        benchmark::DoNotOptimize(t.range_sum(op.ver, op.l, op.r));
+    }
+    state.counters["MiB"] = static_cast<double>(t.memory_bytes()) / (1 << 20);
+}
+
+// One FenwickTree per version: fastest queries, kVersions * n memory.
+static void BM_VersionedQuery_FenwickCopies(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto upd = random_ops(n, 100, 5);
+    std::vector<FenwickTree> snap{FenwickTree(random_values(n, 1))};
+    for (int v = 1; v < kVersions; ++v) {
+        snap.push_back(snap.back());
+        snap.back().add(upd[static_cast<size_t>(v)].l, upd[static_cast<size_t>(v)].v);
+    }
+    const auto ops = random_versioned_ops(n, kVersions, 6);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        benchmark::DoNotOptimize(snap[static_cast<size_t>(op.ver)].range_sum(op.l, op.r));
+    }
+    state.counters["MiB"] =
+        static_cast<double>(kVersions) * n * sizeof(int64_t) / (1 << 20);
+}
+
+// No snapshots: copy version 0 and replay the first `ver` updates per query.
+static void BM_VersionedQuery_FenwickReplay(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto upd = random_ops(n, 100, 5);
+    const FenwickTree base(random_values(n, 1));
+    const auto ops = random_versioned_ops(n, kVersions, 6);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        FenwickTree t = base;
+        for (int v = 1; v <= op.ver; ++v)
+            t.add(upd[static_cast<size_t>(v)].l, upd[static_cast<size_t>(v)].v);
+        benchmark::DoNotOptimize(t.range_sum(op.l, op.r));
+    }
+    state.counters["MiB"] = static_cast<double>(n) * sizeof(int64_t) / (1 << 20);
+}
+
+#define VERSIONED_ARGS Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20)
+// Fixed iteration count: the arena keeps every version, so it grows with the run.
+BENCHMARK(BM_VersionedUpdate_Persistent)->VERSIONED_ARGS->Iterations(1 << 20);
+BENCHMARK(BM_VersionedUpdate_FenwickCopy)->VERSIONED_ARGS;
+BENCHMARK(BM_VersionedQuery_Persistent)->VERSIONED_ARGS;
+BENCHMARK(BM_VersionedQuery_FenwickCopies)->Arg(1 << 12)->Arg(1 << 16); // 2 GiB at 1 << 20
+BENCHMARK(BM_VersionedQuery_FenwickReplay)->VERSIONED_ARGS;
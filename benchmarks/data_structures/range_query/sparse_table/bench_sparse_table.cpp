@@ -0,0 +1,231 @@
+#include "data_structures/range_query/sparse_table/lca.h"
+#include "data_structures/range_query/sparse_table/linear_rmq.h"
+#include "data_structures/range_query/sparse_table/sparse_table.h"
+#include "data_structures/range_query/sqrt_decomposition/sqrt_decomposition.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <limits>
+#include <random>
+#include <utility>
+#include <vector>
+
+using namespace ds::range_query::sparse_table;
+using ds::range_query::sqrt_decomposition::SqrtDecomposition;
+
+namespace {
+template <typename T> std::vector<T> random_values(int n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<T> a(static_cast<size_t>(n));
+    for (auto& x : a)
+        x = static_cast<T>(rng() % 1'000'000);
+    return a;
+}
+
+struct Range {
+    int l, r;
+};
+
+std::vector<Range> random_ranges(int n, int count, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> d(0, n - 1);
+    std::vector<Range> out(static_cast<size_t>(count));
+    for (auto& q : out) {
+        q.l = d(rng);
+        q.r = d(rng);
+        if (q.l > q.r)
+            std::swap(q.l, q.r);
+    }
+    return out;
+}
+
+// Baseline: bottom-up segment tree (size 2n), O(n) build, O(log n) query.
+template <typename T, typename Op> class SegmentTree {
+  public:
+    explicit SegmentTree(const std::vector<T>& a) : n_(a.size()), t_(2 * a.size()) {
+        std::copy(a.begin(), a.end(), t_.begin() + static_cast<std::ptrdiff_t>(n_));
+        for (size_t i = n_ - 1; i > 0; --i)
+            t_[i] = Op::op(t_[2 * i], t_[2 * i + 1]);
+    }
+
+    T query(int l, int r) const {
+        T res = Op::identity();
+        for (size_t lo = static_cast<size_t>(l) + n_, hi = static_cast<size_t>(r) + n_ + 1; lo < hi;
+             lo >>= 1, hi >>= 1) {
+            if (lo & 1)
+                res = Op::op(res, t_[lo++]);
+            if (hi & 1)
+                res = Op::op(res, t_[--hi]);
+        }
+        return res;
+    }
+
+  private:
+    size_t n_;
+    std::vector<T> t_;
+};
+} // namespace
+
+// ---- construction ----
+
+template <typename T> static void BM_Build(benchmark::State& state) {
+    const auto a = random_values<typename T::value_type>(static_cast<int>(state.range(0)), 1);
+    for (auto _ : state) {
+        typename T::table t(a);
+        benchmark::DoNotOptimize(t);
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(0));
+}
+
+template <typename V, template <typename> class Op> struct Sparse {
+    using value_type = V;
+    using table = SparseTable<V, Op<V>>;
+};
+template <typename V> struct Disjoint {
+    using value_type = V;
+    using table = DisjointSparseTable<V, SumOp<V>>;
+};
+template <typename V> struct Segment {
+    using value_type = V;
+    using table = SegmentTree<V, MinOp<V>>;
+};
+
+// int32 min / or vectorize on baseline x86-64; int64 min needs SSE4.2 (pcmpgtq).
+BENCHMARK(BM_Build<Sparse<int32_t, MinOp>>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Build<Sparse<int32_t, OrOp>>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Build<Sparse<int64_t, MinOp>>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Build<Disjoint<int64_t>>)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Build<Segment<int64_t>>)->Arg(1 << 16)->Arg(1 << 20);
+
+// ---- range min ----
+
+static void BM_Min_SparseTable(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SparseTable<int64_t> t(random_values<int64_t>(n, 2));
+    const auto qs = random_ranges(n, 4096, 3);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        benchmark::DoNotOptimize(t.query(q.l, q.r));
+    }
+}
+
+static void BM_Min_SegmentTree(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SegmentTree<int64_t, MinOp<int64_t>> t(random_values<int64_t>(n, 2));
+    const auto qs = random_ranges(n, 4096, 3);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        benchmark::DoNotOptimize(t.query(q.l, q.r));
+    }
+}
+
+// ---- range sum (no idempotence) ----
+
+static void BM_Sum_DisjointSparseTable(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    DisjointSparseTable<int64_t> t(random_values<int64_t>(n, 4));
+    const auto qs = random_ranges(n, 4096, 5);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        benchmark::DoNotOptimize(t.query(q.l, q.r));
+    }
+}
+
+static void BM_Sum_SegmentTree(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SegmentTree<int64_t, SumOp<int64_t>> t(random_values<int64_t>(n, 4));
+    const auto qs = random_ranges(n, 4096, 5);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        benchmark::DoNotOptimize(t.query(q.l, q.r));
+    }
+}
+
+static void BM_Sum_Sqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtDecomposition t(random_values<int64_t>(n, 4));
+    const auto qs = random_ranges(n, 4096, 5);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        benchmark::DoNotOptimize(t.query(q.l, q.r));
+    }
+}
+
+BENCHMARK(BM_Min_SparseTable)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Min_SegmentTree)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Sum_DisjointSparseTable)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Sum_SegmentTree)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+BENCHMARK(BM_Sum_Sqrt)->Arg(1 << 12)->Arg(1 << 16)->Arg(1 << 20);
+
+// ---- linear-space RMQ vs full sparse table: memory and latency ----
+
+template <typename T> static void BM_Rmq_Latency(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    T t(random_values<int32_t>(n, 6));
+    const auto qs = random_ranges(n, 4096, 7);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = qs[i++ & 4095];
+        if constexpr (requires { t.argmin(q.l, q.r); })
+            benchmark::DoNotOptimize(t.argmin(q.l, q.r));
+        else
+            benchmark::DoNotOptimize(t.query(q.l, q.r));
+    }
+    state.counters["bytes_per_elem"] = static_cast<double>(t.memory_bytes()) / n;
+}
+
+// Independent queries issued through argmin_batch (prefetching ahead) vs
+// one argmin call each; items_per_second is queries per second.
+static void BM_Rmq_Batch(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const bool batched = state.range(1) != 0;
+    LinearRmq<int32_t> t(random_values<int32_t>(n, 6));
+    std::vector<std::pair<int, int>> qs;
+    for (const auto& q : random_ranges(n, 1 << 16, 8))
+        qs.emplace_back(q.l, q.r);
+    std::vector<int> out(qs.size());
+    for (auto _ : state) {
+        if (batched) {
+            t.argmin_batch(qs, out);
+        } else {
+            for (size_t i = 0; i < qs.size(); ++i)
+                out[i] = t.argmin(qs[i].first, qs[i].second);
+        }
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(qs.size()));
+}
+
+static void BM_Lca(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    std::mt19937 rng(9);
+    EulerTourLca::AdjList g(static_cast<size_t>(n));
+    for (int v = 1; v < n; ++v) {
+        const auto p = static_cast<int32_t>(rng() % static_cast<unsigned>(v));
+        g[static_cast<size_t>(v)].push_back(p);
+        g[static_cast<size_t>(p)].push_back(v);
+    }
+    EulerTourLca lca(g, 0);
+    std::vector<std::pair<int32_t, int32_t>> qs(1 << 16);
+    for (auto& q : qs)
+        q = {static_cast<int32_t>(rng() % static_cast<unsigned>(n)),
+             static_cast<int32_t>(rng() % static_cast<unsigned>(n))};
+    std::vector<int32_t> out;
+    for (auto _ : state) {
+        lca.lca_batch(qs, out);
+        benchmark::DoNotOptimize(out.data());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(qs.size()));
+}
+
+// A full int32 sparse table at 2^26 would need 6.5 GiB; stop it at 2^22.
+BENCHMARK(BM_Rmq_Latency<SparseTable<int32_t>>)->RangeMultiplier(16)->Range(1 << 10, 1 << 22);
+BENCHMARK(BM_Rmq_Latency<LinearRmq<int32_t>>)->RangeMultiplier(16)->Range(1 << 10, 1 << 26);
+BENCHMARK(BM_Rmq_Batch)->Args({1 << 16, 0})->Args({1 << 16, 1})->Args({1 << 26, 0})->Args({1 << 26, 1});
+BENCHMARK(BM_Lca)->Arg(1 << 16)->Arg(1 << 22);
@@ -0,0 +1,209 @@
+#include "data_structures/range_query/segment_tree/lazy_segment_tree.h"
+#include "data_structures/range_query/sqrt_decomposition/lazy_sqrt_decomposition.h"
+#include "data_structures/range_query/sqrt_decomposition/sqrt_decomposition.h"
+
+#include <algorithm>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+namespace seg = ds::range_query::segment_tree;
+namespace sq = ds::range_query::sqrt_decomposition;
+
+namespace {
+std::vector<int64_t> random_values(int n, unsigned seed) {
+    std::mt19937_64 rng(seed);
+    std::vector<int64_t> a(static_cast<size_t>(n));
+    for (auto& x : a)
+        x = static_cast<int64_t>(rng() % 1000);
+    return a;
+}
+
+// One operation of a mixed workload: update if upd, otherwise query.
+struct Op {
+    bool upd;
+    int l, r;
+    int64_t v;
+};
+
+// update_pct percent updates, the rest queries, random ranges.
+std::vector<Op> random_ops(int n, int update_pct, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> d(0, n - 1);
+    std::vector<Op> out(4096);
+    for (auto& op : out) {
+        op.upd = static_cast<int>(rng() % 100) < update_pct;
+        op.l = d(rng);
+        op.r = d(rng);
+        if (op.l > op.r)
+            std::swap(op.l, op.r);
+        op.v = static_cast<int64_t>(rng() % 1000);
+    }
+    return out;
+}
+
+using SqrtSumAdd = sq::LazySqrtDecomposition<sq::SumMonoid<int64_t>, sq::AddAction<int64_t>>;
+using SqrtMinAssign =
+    sq::LazySqrtDecomposition<sq::MinMonoid<int64_t>, sq::AssignAction<int64_t>>;
+using SegSumAdd = seg::LazySegmentTree<seg::SumMonoid<int64_t>, seg::AddAction<int64_t>>;
+using SegMinAssign = seg::LazySegmentTree<seg::MinMonoid<int64_t>, seg::AssignAction<int64_t>>;
+
+std::vector<seg::SumLen<int64_t>> sum_leaves(const std::vector<int64_t>& a) {
+    std::vector<seg::SumLen<int64_t>> out;
+    out.reserve(a.size());
+    for (auto x : a)
+        out.push_back(seg::SumMonoid<int64_t>::leaf(x));
+    return out;
+}
+} // namespace
+
+// ---- point set + range sum: the workload SqrtDecomposition supports ----
+// Args: n, percent of updates.
+
+static void BM_PointSetSum_Sqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    sq::SqrtDecomposition t(random_values(n, 1));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 2);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.update(op.l, op.v);
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+static void BM_PointSetSum_LazySqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtSumAdd t(random_values(n, 1));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 2);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.set(op.l, op.v);
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+static void BM_PointSetSum_Segment(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SegSumAdd t(sum_leaves(random_values(n, 1)));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 2);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.set(op.l, seg::SumMonoid<int64_t>::leaf(op.v));
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+#define POINT_SET_ARGS ArgsProduct({{1 << 16, 1 << 20}, {10, 50, 90}})
+BENCHMARK(BM_PointSetSum_Sqrt)->POINT_SET_ARGS;
+BENCHMARK(BM_PointSetSum_LazySqrt)->POINT_SET_ARGS;
+BENCHMARK(BM_PointSetSum_Segment)->POINT_SET_ARGS;
+
+// ---- range add + range sum, range assign + range min ----
+// Args: n, percent of updates.
+
+static void BM_AddSum_LazySqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtSumAdd t(random_values(n, 3));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 4);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.apply(op.l, op.r, op.v);
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+static void BM_AddSum_Segment(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SegSumAdd t(sum_leaves(random_values(n, 3)));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 4);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.apply(op.l, op.r, op.v);
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+static void BM_AssignMin_LazySqrt(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtMinAssign t(random_values(n, 5));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 6);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.apply(op.l, op.r, {op.v, true});
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+static void BM_AssignMin_Segment(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SegMinAssign t(random_values(n, 5));
+    const auto ops = random_ops(n, static_cast<int>(state.range(1)), 6);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.apply(op.l, op.r, {op.v, true});
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+#define RANGE_ARGS ArgsProduct({{1 << 12, 1 << 16, 1 << 20}, {10, 50, 90}})
+BENCHMARK(BM_AddSum_LazySqrt)->RANGE_ARGS;
+BENCHMARK(BM_AddSum_Segment)->RANGE_ARGS;
+BENCHMARK(BM_AssignMin_LazySqrt)->RANGE_ARGS;
+BENCHMARK(BM_AssignMin_Segment)->RANGE_ARGS;
+
+// ---- block size sweep, 50 / 50 ----
+// Args: n, block size in elements.
+
+static void BM_BlockSize_AddSum(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtSumAdd t(random_values(n, 7), static_cast<int>(state.range(1)));
+    const auto ops = random_ops(n, 50, 8);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.apply(op.l, op.r, op.v);
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+static void BM_BlockSize_AssignMin(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    SqrtMinAssign t(random_values(n, 7), static_cast<int>(state.range(1)));
+    const auto ops = random_ops(n, 50, 8);
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& op = ops[i++ & 4095];
+        if (op.upd)
+            t.apply(op.l, op.r, {op.v, true});
+        else
+            benchmark::DoNotOptimize(t.query(op.l, op.r));
+    }
+}
+
+#define BLOCK_ARGS ArgsProduct({{1 << 16, 1 << 20, 1 << 24}, benchmark::CreateRange(16, 8192, 2)})
+BENCHMARK(BM_BlockSize_AddSum)->BLOCK_ARGS;
+BENCHMARK(BM_BlockSize_AssignMin)->BLOCK_ARGS;
@@ -0,0 +1,141 @@
+#include "data_structures/range_query/mo/mo.h"
+#include "data_structures/range_query/wavelet/wavelet_matrix.h"
+
+#include <benchmark/benchmark.h>
+#include <cmath>
+#include <cstdint>
+#include <random>
+#include <vector>
+
+using ds::range_query::mo::Query;
+using namespace ds::range_query::wavelet;
+
+namespace {
+std::vector<int> random_values(int n, int distinct, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<int> a(static_cast<size_t>(n));
+    for (auto& x : a)
+        x = static_cast<int>(rng() % static_cast<unsigned>(distinct));
+    return a;
+}
+
+std::vector<Query> random_queries(int n, int q, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_int_distribution<int> d(0, n - 1);
+    std::vector<Query> out(static_cast<size_t>(q));
+    for (int i = 0; i < q; ++i) {
+        int l = d(rng), r = d(rng);
+        if (l > r)
+            std::swap(l, r);
+        out[static_cast<size_t>(i)] = {l, r, i};
+    }
+    return out;
+}
+
+std::vector<uint64_t> as_u64(const std::vector<int>& a) { return {a.begin(), a.end()}; }
+
+// Log-uniform values in [0, sigma): frequency of v falls off like 1 / (v + 1).
+std::vector<uint64_t> zipf_values(int n, uint64_t sigma, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::uniform_real_distribution<double> u(0.0, 1.0);
+    std::vector<uint64_t> a(static_cast<size_t>(n));
+    for (auto& x : a)
+        x = static_cast<uint64_t>(std::pow(static_cast<double>(sigma), u(rng))) - 1;
+    return a;
+}
+} // namespace
+
+// ---- distinct count: offline Mo vs online RangeDistinct ----
+// Args: N, Q. N / 4 distinct values. Both include all preprocessing.
+
+static void BM_Distinct_Mo(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto a = random_values(n, n / 4, 1);
+    const auto queries = random_queries(n, static_cast<int>(state.range(1)), 2);
+    for (auto _ : state) {
+        auto ans = ds::range_query::mo::mo_solve_distinct(a, queries);
+        benchmark::DoNotOptimize(ans.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+static void BM_Distinct_Wavelet(benchmark::State& state) {
+    const int n = static_cast<int>(state.range(0));
+    const auto a = random_values(n, n / 4, 1);
+    const auto queries = random_queries(n, static_cast<int>(state.range(1)), 2);
+    for (auto _ : state) {
+        RangeDistinct rd(a);
+        std::vector<int> ans(queries.size());
+        for (const auto& q : queries)
+            ans[static_cast<size_t>(q.idx)] = rd.distinct(q.l, q.r);
+        benchmark::DoNotOptimize(ans.data());
+    }
+    state.SetItemsProcessed(state.iterations() * state.range(1));
+}
+
+#define DISTINCT_ARGS                                                                              \
+    ArgsProduct({{100'000, 1'000'000}, {100'000, 1'000'000}})->Unit(benchmark::kMillisecond)
+BENCHMARK(BM_Distinct_Mo)->DISTINCT_ARGS;
+BENCHMARK(BM_Distinct_Wavelet)->DISTINCT_ARGS;
+
+// ---- single operations on N = 10^6 values; Arg 0: log2 sigma ----
+
+static void BM_Build(benchmark::State& state) {
+    const auto a = as_u64(random_values(1'000'000, 1 << state.range(0), 3));
+    for (auto _ : state) {
+        WaveletMatrix wm(a);
+        benchmark::DoNotOptimize(wm.levels());
+    }
+    state.counters["bytes_per_elem"] = static_cast<double>(WaveletMatrix(a).memory_bytes()) / 1e6;
+}
+
+// Arg 1: 0 for uniform values, 1 for Zipf-like ones.
+template <typename Fn> static void run_queries(benchmark::State& state, Fn fn) {
+    const int n = 1'000'000;
+    const uint64_t sigma = uint64_t{1} << state.range(0);
+    const WaveletMatrix wm(state.range(1) == 1
+                               ? zipf_values(n, sigma, 3)
+                               : as_u64(random_values(n, static_cast<int>(sigma), 3)));
+    const auto queries = random_queries(n, 4096, 4);
+    std::mt19937 rng(5);
+    std::vector<uint64_t> xs(4096);
+    for (auto& x : xs)
+        x = rng() % sigma;
+    size_t i = 0;
+    for (auto _ : state) {
+        const auto& q = queries[i & 4095];
+        fn(wm, q, xs[i & 4095]);
+        ++i;
+    }
+}
+
+static void BM_KthSmallest(benchmark::State& state) {
+    run_queries(state, [](const WaveletMatrix& wm, const Query& q, uint64_t) {
+        benchmark::DoNotOptimize(wm.kth_smallest(q.l, q.r, (q.r - q.l) / 2));
+    });
+}
+
+static void BM_RankLess(benchmark::State& state) {
+    run_queries(state, [](const WaveletMatrix& wm, const Query& q, uint64_t x) {
+        benchmark::DoNotOptimize(wm.rank_less(q.l, q.r, x));
+    });
+}
+
+static void BM_Select(benchmark::State& state) {
+    run_queries(state, [](const WaveletMatrix& wm, const Query&, uint64_t x) {
+        benchmark::DoNotOptimize(wm.select(x, 0));
+    });
+}
+
+static void BM_Top10(benchmark::State& state) {
+    run_queries(state, [](const WaveletMatrix& wm, const Query& q, uint64_t) {
+        auto top = wm.top_k(q.l, q.r, 10);
+        benchmark::DoNotOptimize(top.data());
+    });
+}
+
+BENCHMARK(BM_Build)->Arg(8)->Arg(20)->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_KthSmallest)->Args({8, 0})->Args({20, 0});
+BENCHMARK(BM_RankLess)->Args({8, 0})->Args({20, 0});
+BENCHMARK(BM_Select)->Args({8, 0})->Args({20, 0});
+BENCHMARK(BM_Top10)->ArgsProduct({{8, 20}, {0, 1}});
@@ -0,0 +1,514 @@
+#include "data_structures/trie/concurrent_trie.h"
+#include "data_structures/trie/double_array_trie.h"
+#include "data_structures/trie/radix_trie.h"
+#include "data_structures/trie/trie.h"
+
+#include <algorithm>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdint>
+#include <cstdio>
+#include <functional>
+#include <map>
+#include <memory>
+#include <mutex>
+#include <numeric>
+#include <shared_mutex>
+#include <string_view>
+#include <string>
+#include <thread>
+#include <vector>
+
+using namespace ds::trie;
+
+namespace {
+constexpr int64_t kLookups = 1'000'000;
+
+struct XorShift {
+    uint64_t s = 0x9E3779B97F4A7C15ull;
+    uint64_t operator()() {
+        s ^= s << 13;
+        s ^= s >> 7;
+        s ^= s << 17;
+        return s;
+    }
+};
+
+constexpr const char* kSyllables[] = {"ka", "lo", "mi", "net", "shop", "data", "web", "cloud",
+                                      "news", "blog", "app", "dev", "img", "cdn", "api", "wiki",
+                                      "ra", "zu", "tor", "lab", "hub", "box", "go", "max"};
+constexpr const char* kTlds[] = {".com", ".org", ".net", ".io", ".de", ".co.uk"};
+
+std::string word(XorShift& rng, int syllables) {
+    std::string w;
+    for (int i = 0; i < syllables; ++i) {
+        w += kSyllables[rng() % std::size(kSyllables)];
+    }
+    return w;
+}
+
+// Synthetic crawl: scheme, one of 100K hosts (skewed towards a few large
+// sites), 1-4 path segments from a 2K-word vocabulary, a numeric id and an
+// optional query string. ~60 bytes per URL.
+std::vector<std::string> make_urls(int64_t n) {
+    XorShift rng;
+    std::vector<std::string> hosts(100'000);
+    for (auto& h : hosts) {
+        h = (rng() % 2 ? "https://www." : "http://") + word(rng, 2 + static_cast<int>(rng() % 2)) +
+            kTlds[rng() % std::size(kTlds)];
+    }
+    std::vector<std::string> vocab(2'000);
+    for (auto& w : vocab) {
+        w = word(rng, 1 + static_cast<int>(rng() % 3));
+    }
+
+    std::vector<std::string> urls(static_cast<size_t>(n));
+    for (auto& url : urls) {
+        // min of two uniforms: small host indices are much more frequent.
+        const uint64_t h = std::min(rng() % hosts.size(), rng() % hosts.size());
+        url = hosts[h];
+        const int segments = 1 + static_cast<int>(rng() % 4);
+        for (int s = 0; s < segments; ++s) {
+            url += '/';
+            url += vocab[rng() % vocab.size()];
+        }
+        url += '/';
+        url += std::to_string(rng() % 1'000'000);
+        if (rng() % 4 == 0) {
+            url += "?ref=";
+            url += vocab[rng() % vocab.size()];
+        }
+    }
+    return urls;
+}
+
+// The same URLs mapped onto 'a'..'z' byte by byte, which Trie requires.
+std::vector<std::string> fold_lowercase(std::vector<std::string> urls) {
+    for (auto& url : urls) {
+        for (char& c : url) {
+            c = static_cast<char>('a' + static_cast<uint8_t>(c) % 26);
+        }
+    }
+    return urls;
+}
+
+const std::vector<std::string>& corpus(int64_t n, bool folded) {
+    static std::map<std::pair<int64_t, bool>, std::vector<std::string>> cache;
+    auto& urls = cache[{n, folded}];
+    if (urls.empty()) {
+        urls = folded ? fold_lowercase(make_urls(n)) : make_urls(n);
+    }
+    return urls;
+}
+
+template <typename T> void fill(T& trie, const std::vector<std::string>& keys) {
+    for (const auto& k : keys) {
+        trie.insert(k);
+    }
+}
+
+template <typename T> T build(const std::vector<std::string>& keys) {
+    T trie;
+    fill(trie, keys);
+    return trie;
+}
+
+template <> DoubleArrayTrie build<DoubleArrayTrie>(const std::vector<std::string>& keys) {
+    return build<Trie>(keys).freeze();
+}
+
+// 1M stored keys in random order.
+std::vector<const std::string*> probes(const std::vector<std::string>& keys) {
+    XorShift rng;
+    std::vector<const std::string*> out(kLookups);
+    for (auto& p : out) {
+        p = &keys[rng() % keys.size()];
+    }
+    return out;
+}
+
+template <typename T> int search_all(const T& trie, const std::vector<const std::string*>& ps) {
+    int hits = 0;
+    for (const auto* p : ps) {
+        hits += trie.search(*p) ? 1 : 0;
+    }
+    return hits;
+}
+
+} // namespace
+
+// ---- build: Args n keys; counters report the resulting footprint ----
+
+template <typename T, bool Folded> static void BM_Build(benchmark::State& state) {
+    const auto& keys = corpus(state.range(0), Folded);
+    size_t raw_bytes = 0;
+    for (const auto& k : keys) {
+        raw_bytes += k.size();
+    }
+    for (auto _ : state) {
+        T trie;
+        fill(trie, keys);
+        state.counters["MiB"] = static_cast<double>(trie.memory_bytes()) / (1 << 20);
+        state.counters["bytes/key"] =
+            static_cast<double>(trie.memory_bytes()) / static_cast<double>(keys.size());
+        state.counters["raw_bytes/key"] =
+            static_cast<double>(raw_bytes) / static_cast<double>(keys.size());
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+}
+
+// ---- lookup: search() of 1M stored keys in random order ----
+
+template <typename T, bool Folded> static void BM_Search(benchmark::State& state) {
+    const auto& keys = corpus(state.range(0), Folded);
+    const T trie = build<T>(keys);
+    const auto ps = probes(keys);
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(search_all(trie, ps));
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+}
+
+// ---- frozen dictionary: freeze() cost, load from file, lookups on the mapping ----
+
+static void BM_Freeze(benchmark::State& state) {
+    const auto& keys = corpus(state.range(0), true);
+    const Trie trie = build<Trie>(keys);
+    for (auto _ : state) {
+        const DoubleArrayTrie frozen = trie.freeze();
+        state.counters["MiB"] = static_cast<double>(frozen.memory_bytes()) / (1 << 20);
+        state.counters["bytes/key"] =
+            static_cast<double>(frozen.memory_bytes()) / static_cast<double>(keys.size());
+        state.counters["trie_MiB"] = static_cast<double>(trie.memory_bytes()) / (1 << 20);
+    }
+    state.SetItemsProcessed(state.iterations() * static_cast<int64_t>(keys.size()));
+}
+
+namespace {
+std::string saved_dictionary(int64_t n) {
+    const std::string path = "bench_trie_dat_" + std::to_string(n) + ".bin";
+    build<DoubleArrayTrie>(corpus(n, true)).save(path);
+    return path;
+}
+} // namespace
+
+// load() plus one lookup: with mmap, pages are faulted in on demand.
+static void BM_Load(benchmark::State& state) {
+    const std::string path = saved_dictionary(state.range(0));
+    const std::string& probe = corpus(state.range(0), true).front();
+    for (auto _ : state) {
+        const auto dat = DoubleArrayTrie::load(path);
+        benchmark::DoNotOptimize(dat && dat->search(probe));
+    }
+    std::remove(path.c_str());
+}
+
+static void BM_Search_Mapped(benchmark::State& state) {
+    const std::string path = saved_dictionary(state.range(0));
+    const auto dat = DoubleArrayTrie::load(path);
+    const auto ps = probes(corpus(state.range(0), true));
+    for (auto _ : state) {
+        benchmark::DoNotOptimize(search_all(*dat, ps));
+    }
+    state.SetItemsProcessed(state.iterations() * kLookups);
+    std::remove(path.c_str());
+}
+
+namespace {
+constexpr int kTopK = 10;
+constexpr int64_t kQueries = 1'000;
+
+// n distinct words of 1-5 syllables, in generation order.
+std::vector<std::string> syllable_words(XorShift& rng, int64_t n) {
+    std::vector<std::string> words;
+    Trie seen;
+    while (static_cast<int64_t>(words.size()) < n) {
+        std::string w = word(rng, 1 + static_cast<int>(rng() % 5));
+        if (!seen.search(w)) {
+            seen.insert(w);
+            words.push_back(std::move(w));
+        }
+    }
+    return words;
+}
+
+// Autocomplete dictionary: n distinct syllable words, scored Zipf-like
+// (score = n / rank over a random ranking), so a few words dominate.
+const Trie& scored_dictionary(int64_t n) {
+    static std::map<int64_t, Trie> cache;
+    auto [it, inserted] = cache.try_emplace(n);
+    if (inserted) {
+        XorShift rng;
+        const auto words = syllable_words(rng, n);
+        std::vector<int64_t> rank(words.size());
+        std::iota(rank.begin(), rank.end(), 1);
+        for (size_t i = rank.size(); i > 1; --i) {
+            std::swap(rank[i - 1], rank[rng() % i]);
+        }
+        for (size_t i = 0; i < words.size(); ++i) {
+            it->second.insert(words[i], n / rank[i]);
+        }
+    }
+    return it->second;
+}
+
+// kQueries prefixes of 1-3 characters, cut from stored words.
+std::vector<std::string> prefixes(const Trie& dict) {
+    const auto words = dict.words_with_prefix("");
+    XorShift rng;
+    std::vector<std::string> out(kQueries);
+    for (auto& p : out) {
+        const auto& w = words[rng() % words.size()];
+        p = w.substr(0, 1 + rng() % 3);
+    }
+    return out;
+}
+} // namespace
+
+// ---- autocomplete: top-10 by score for 1-3 character prefixes ----
+
+static void BM_TopK(benchmark::State& state) {
+    const Trie& dict = scored_dictionary(state.range(0));
+    const auto ps = prefixes(dict);
+    Trie::CompletionBuffer buffer;
+    for (auto _ : state) {
+        for (const auto& p : ps) {
+            dict.top_k_with_prefix(p, kTopK, buffer);
+            benchmark::DoNotOptimize(buffer.results().data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+// Baseline: enumerate every completion, look up its score, partial_sort.
+static void BM_TopK_Enumerate(benchmark::State& state) {
+    const Trie& dict = scored_dictionary(state.range(0));
+    const auto ps = prefixes(dict);
+    std::vector<std::pair<int64_t, std::string>> scored;
+    for (auto _ : state) {
+        for (const auto& p : ps) {
+            scored.clear();
+            for (auto& w : dict.words_with_prefix(p)) {
+                const int64_t s = *dict.score(w);
+                scored.emplace_back(s, std::move(w));
+            }
+            const auto k = std::min(scored.size(), static_cast<size_t>(kTopK));
+            std::partial_sort(scored.begin(), scored.begin() + static_cast<std::ptrdiff_t>(k),
+                              scored.end(), std::greater<>());
+            benchmark::DoNotOptimize(scored.data());
+        }
+    }
+    state.SetItemsProcessed(state.iterations() * kQueries);
+}
+
+namespace {
+constexpr int64_t kServedWords = 200'000;
+constexpr int64_t kReadsPerThread = 500'000;
+
+// The baseline for serving reads during a rebuild: one Trie behind a
+// reader-writer lock.
+class LockedTrie {
+  public:
+    void insert(std::string_view w) {
+        std::unique_lock lock(mutex_);
+        trie_.insert(w);
+    }
+    bool search(std::string_view w) const {
+        std::shared_lock lock(mutex_);
+        return trie_.search(w);
+    }
+
+  private:
+    Trie trie_;
+    mutable std::shared_mutex mutex_;
+};
+
+// First half: served dictionary. Second half: words the writer adds.
+const std::vector<std::string>& serving_words() {
+    static const std::vector<std::string> words = [] {
+        XorShift rng;
+        return syllable_words(rng, 2 * kServedWords);
+    }();
+    return words;
+}
+} // namespace
+
+// ---- concurrent serving: Args reader threads; one writer inserts meanwhile ----
+
+// Each reader runs kReadsPerThread search() calls on served words while one
+// writer inserts new words until the readers are done. Wall-clock time;
+// `inserts` counts the writer's progress in that time.
+template <typename T> static void BM_ReadWhileWriting(benchmark::State& state) {
+    const int threads = static_cast<int>(state.range(0));
+    const auto& words = serving_words();
+    int64_t inserts = 0;
+    std::unique_ptr<T> dict;
+    for (auto _ : state) {
+        state.PauseTiming();
+        dict = std::make_unique<T>(); // the previous one is freed untimed
+        for (int64_t i = 0; i < kServedWords; ++i) {
+            dict->insert(words[static_cast<size_t>(i)]);
+        }
+        std::atomic<int> running{threads};
+        state.ResumeTiming();
+
+        std::thread writer([&] {
+            for (auto i = static_cast<size_t>(kServedWords);
+                 i < words.size() && running.load(std::memory_order_relaxed) > 0; ++i) {
+                dict->insert(words[i]);
+                ++inserts;
+            }
+        });
+        std::vector<std::thread> readers;
+        for (int t = 0; t < threads; ++t) {
+            readers.emplace_back([&, t] {
+                XorShift rng;
+                rng.s += static_cast<uint64_t>(t);
+                int hits = 0;
+                for (int64_t i = 0; i < kReadsPerThread; ++i) {
+                    hits += dict->search(words[rng() % kServedWords]) ? 1 : 0;
+                }
+                benchmark::DoNotOptimize(hits);
+                running.fetch_sub(1);
+            });
+        }
+        for (auto& r : readers) {
+            r.join();
+        }
+        writer.join();
+    }
+    state.SetItemsProcessed(state.iterations() * threads * kReadsPerThread);
+    state.counters["inserts"] =
+        static_cast<double>(inserts) / static_cast<double>(state.iterations());
+}
+
+namespace {
+constexpr int64_t kFuzzyQueries = 200;
+
+struct FuzzyWorkload {
+    std::vector<std::string> words;
+    Trie trie;
+    std::vector<std::string> queries; // dictionary words with 1-2 random typos
+};
+
+const FuzzyWorkload& fuzzy_workload(int64_t n) {
+    static std::map<int64_t, FuzzyWorkload> cache;
+    auto [it, inserted] = cache.try_emplace(n);
+    FuzzyWorkload& w = it->second;
+    if (inserted) {
+        XorShift rng;
+        w.words = syllable_words(rng, n);
+        fill(w.trie, w.words);
+        for (int64_t q = 0; q < kFuzzyQueries; ++q) {
+            std::string s = w.words[rng() % w.words.size()];
+            for (int typos = 1 + static_cast<int>(rng() % 2); typos > 0; --typos) {
+                const size_t pos = rng() % (s.size() + 1);
+                const char c = static_cast<char>('a' + rng() % 26);
+                switch (rng() % 3) {
+                case 0:
+                    s.insert(pos, 1, c);
+                    break;
+                case 1:
+                    if (pos < s.size()) {
+                        s.erase(pos, 1);
+                    }
+                    break;
+                default:
+                    if (pos < s.size()) {
+                        s[pos] = c;
+                    }
+                }
+            }
+            w.queries.push_back(std::move(s));
+        }
+    }
+    return w;
+}
+
+int levenshtein(std::string_view a, std::string_view b, std::vector<int>& row) {
+    row.resize(b.size() + 1);
+    for (size_t j = 0; j <= b.size(); ++j) {
+        row[j] = static_cast<int>(j);
+    }
+    for (size_t i = 1; i <= a.size(); ++i) {
+        int diag = row[0];
+        row[0] = static_cast<int>(i);
+        for (size_t j = 1; j <= b.size(); ++j) {
+            const int up = row[j];
+            row[j] = std::min({row[j] + 1, row[j - 1] + 1, diag + (a[i - 1] == b[j - 1] ? 0 : 1)});
+            diag = up;
+        }
+    }
+    return row[b.size()];
+}
+} // namespace
+
+// ---- spell correction: all words within edit distance k; Args n words, k ----
+
+static void BM_Fuzzy(benchmark::State& state) {
+    const auto& w = fuzzy_workload(state.range(0));
+    const int k = static_cast<int>(state.range(1));
+    size_t matches = 0;
+    for (auto _ : state) {
+        matches = 0;
+        for (const auto& q : w.queries) {
+            matches += w.trie.search_within_distance(q, k).size();
+        }
+    }
+    state.counters["matches/query"] =
+        static_cast<double>(matches) / static_cast<double>(kFuzzyQueries);
+    state.SetItemsProcessed(state.iterations() * kFuzzyQueries);
+}
+
+// Baseline: full DP against every word whose length is within k of the query.
+static void BM_Fuzzy_BruteForce(benchmark::State& state) {
+    const auto& w = fuzzy_workload(state.range(0));
+    const int k = static_cast<int>(state.range(1));
+    std::vector<int> row;
+    size_t matches = 0;
+    for (auto _ : state) {
+        matches = 0;
+        for (const auto& q : w.queries) {
+            for (const auto& word : w.words) {
+                const auto gap = static_cast<int>(word.size()) - static_cast<int>(q.size());
+                if (gap <= k && -gap <= k && levenshtein(word, q, row) <= k) {
+                    ++matches;
+                }
+            }
+        }
+    }
+    state.counters["matches/query"] =
+        static_cast<double>(matches) / static_cast<double>(kFuzzyQueries);
+    state.SetItemsProcessed(state.iterations() * kFuzzyQueries);
+}
+
+// Trie costs ~4.7 KB per URL (a 112-byte node per key byte not shared with an
+// earlier key), so the comparison stops at 300K keys (~1.4 GB); RadixTrie
+// alone goes on to 10M raw URLs.
+#define FOLDED Arg(100'000)->Arg(300'000)
+#define RAW Arg(100'000)->Arg(1'000'000)->Arg(10'000'000)
+BENCHMARK(BM_Build<Trie, true>)->FOLDED->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(BM_Build<RadixTrie, true>)->FOLDED->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(BM_Build<RadixTrie, false>)->RAW->Unit(benchmark::kMillisecond)->Iterations(1);
+
+BENCHMARK(BM_Search<Trie, true>)->FOLDED->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK(BM_Search<RadixTrie, true>)->FOLDED->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK(BM_Search<RadixTrie, false>)->RAW->Unit(benchmark::kMillisecond)->Iterations(3);
+BENCHMARK(BM_Search<DoubleArrayTrie, true>)->FOLDED->Unit(benchmark::kMillisecond)->Iterations(3);
+
+BENCHMARK(BM_Freeze)->FOLDED->Unit(benchmark::kMillisecond)->Iterations(1);
+BENCHMARK(BM_Load)->FOLDED->Unit(benchmark::kMicrosecond)->Iterations(100);
+BENCHMARK(BM_Search_Mapped)->FOLDED->Unit(benchmark::kMillisecond)->Iterations(3);
+
+#define DICT Arg(200'000)->Arg(1'000'000)
+BENCHMARK(BM_TopK)->DICT->Unit(benchmark::kMillisecond);
+BENCHMARK(BM_TopK_Enumerate)->DICT->Unit(benchmark::kMillisecond)->Iterations(1);
+
+#define FUZZY ArgsProduct({{200'000, 1'000'000}, {1, 2}})->Unit(benchmark::kMillisecond)
+BENCHMARK(BM_Fuzzy)->FUZZY;
+BENCHMARK(BM_Fuzzy_BruteForce)->FUZZY->Iterations(1);
+
+#define READERS                                                                            \
+    Arg(1)->Arg(2)->Arg(4)->Unit(benchmark::kMillisecond)->UseRealTime()->Iterations(3)
+BENCHMARK(BM_ReadWhileWriting<LockedTrie>)->READERS;
+BENCHMARK(BM_ReadWhileWriting<ConcurrentTrie>)->READERS;
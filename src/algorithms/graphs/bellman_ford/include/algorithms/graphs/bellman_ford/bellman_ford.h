@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <limits>
 #include <vector>
@@ -18,6 +19,10 @@ struct Edge {
 // For undirected graphs, add edges in both directions.
 using Graph = std::vector<std::vector<Edge>>;
 
+// CSR representation (see csr_graph.h): targets and weights in flat arrays.
+// csr_graph::csr_from_adjacency(g) converts a Graph.
+using CsrGraph = csr_graph::CsrGraph<int32_t>;
+
 struct BellmanFordResult {
     // dist[v] == INF means unreachable from source.
     std::vector<int32_t> dist;
@@ -45,4 +50,7 @@ struct BellmanFordResult {
 // Complexity: O(V * E) time, O(V) additional memory.
 BellmanFordResult bellman_ford(const Graph& g, int32_t s);
 
+// Same as above for a CSR graph; returns exactly what the equivalent Graph gives.
+BellmanFordResult bellman_ford(const CsrGraph& g, int32_t s);
+
 } // namespace algorithms::graphs::bellman_ford
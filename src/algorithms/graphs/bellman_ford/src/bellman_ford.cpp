@@ -20,7 +20,10 @@ bool would_overflow_add_int32(int32_t a, int32_t b) {
 
 namespace algorithms::graphs::bellman_ford {
 
-BellmanFordResult bellman_ford(const Graph& g, int32_t s) {
+namespace {
+
+// Shared by the Graph and CsrGraph overloads: both yield {to, w} pairs from g[u].
+template <typename G> BellmanFordResult bellman_ford_impl(const G& g, int32_t s) {
     const int32_t n = static_cast<int32_t>(g.size());
     if (s < 0 || s >= n) {
         return {};
@@ -44,16 +47,16 @@ BellmanFordResult bellman_ford(const Graph& g, int32_t s) {
                 continue;
             }
 
-            for (const auto& e : g[su]) {
-                const int32_t v = e.to;
+            for (const auto& [to, w] : g[su]) {
+                const int32_t v = to;
                 if (v < 0 || v >= n) {
                     continue; // ignore invalid edges defensively
                 }
 
-                if (would_overflow_add_int32(du, e.w)) {
+                if (would_overflow_add_int32(du, w)) {
                     continue;
                 }
-                const int32_t cand = du + e.w;
+                const int32_t cand = du + w;
 
                 const auto sv = static_cast<size_t>(v);
                 if (out.dist[sv] > cand) {
@@ -77,15 +80,15 @@ BellmanFordResult bellman_ford(const Graph& g, int32_t s) {
             continue;
         }
 
-        for (const auto& e : g[su]) {
-            const int32_t v = e.to;
+        for (const auto& [to, w] : g[su]) {
+            const int32_t v = to;
             if (v < 0 || v >= n) {
                 continue;
             }
-            if (would_overflow_add_int32(du, e.w)) {
+            if (would_overflow_add_int32(du, w)) {
                 continue;
             }
-            const int32_t cand = du + e.w;
+            const int32_t cand = du + w;
             const auto sv = static_cast<size_t>(v);
             if (out.dist[sv] > cand) {
                 out.has_negative_cycle = true;
@@ -97,4 +100,14 @@ BellmanFordResult bellman_ford(const Graph& g, int32_t s) {
     return out;
 }
 
+} // namespace
+
+BellmanFordResult bellman_ford(const Graph& g, int32_t s) {
+    return bellman_ford_impl(g, s);
+}
+
+BellmanFordResult bellman_ford(const CsrGraph& g, int32_t s) {
+    return bellman_ford_impl(g, s);
+}
+
 } // namespace algorithms::graphs::bellman_ford
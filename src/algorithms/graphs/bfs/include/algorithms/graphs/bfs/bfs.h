@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <vector>
 
@@ -8,6 +9,10 @@ namespace algorithms::graphs::bfs {
 // Nodes are indexed [0, n-1].
 using AdjList = std::vector<std::vector<int32_t>>;
 
+// Flat-array graph (see csr_graph.h). bfs_from, bfs_order_from and bfs_forest give
+// the same result for it as for an AdjList holding the same arcs in the same order.
+using CsrGraph = csr_graph::CsrGraph<>;
+
 // Result of a BFS traversal from a single start vertex.
 //
 // Invariants (on return):
@@ -27,10 +32,56 @@ struct BfsResult {
 //
 // Complexity: O(V + E) time over the reachable subgraph; O(V) extra space.
 BfsResult bfs_from(const AdjList& g, int32_t start);
+BfsResult bfs_from(const CsrGraph& g, int32_t start);
 
 // Return only the discovery order of BFS from start.
 // If start is out of range, returns an empty vector.
 std::vector<int32_t> bfs_order_from(const AdjList& g, int32_t start);
+std::vector<int32_t> bfs_order_from(const CsrGraph& g, int32_t start);
+
+// Switching thresholds of bfs_direction_optimizing (Beamer, Asanovic and Patterson,
+// "Direction-Optimizing Breadth-First Search", SC 2012). The defaults are the
+// paper's; values below 1 are treated as 1.
+struct DirectionParams {
+    // Go bottom-up once the out-arcs of the frontier exceed 1/alpha of the arcs not
+    // yet explored. Larger alpha switches earlier.
+    int32_t alpha = 15;
+    // Go back top-down once the frontier is shrinking and holds fewer than n/beta
+    // vertices. Larger beta stays bottom-up longer.
+    int32_t beta = 18;
+};
+
+// Direction-optimizing BFS from a single start vertex.
+//
+// Levels are expanded top-down (each frontier vertex scans its out-arcs) while the
+// frontier is small, and bottom-up (each unreached vertex scans its in-arcs until
+// one comes from the frontier) while it is large. On low-diameter graphs the middle
+// levels reach most vertices, and bottom-up stops at the first hit instead of
+// examining every arc into already-reached vertices. During bottom-up steps the
+// frontier is a bitmap, so the membership test per in-arc is one bit.
+//
+// gt holds the in-arcs: the transpose of g (csr_graph::transpose), or g itself if
+// g is undirected (has both directions of every edge). The overload without gt
+// builds the transpose on every call; prefer passing it when running many searches.
+//
+// Returns the same BfsResult as bfs_from, with these differences:
+// - dist is identical.
+// - parent[v] may be any vertex at distance dist[v] - 1 with an arc to v.
+// - order still lists the vertices by non-decreasing dist, but vertices found by a
+//   bottom-up step appear in increasing id order within their level.
+//
+// If start is out of range or gt has a different number of vertices than g,
+// returns an empty result. Arcs to vertices outside [0, n-1] are ignored.
+//
+// Complexity: O(V + E) time for all top-down levels together, plus O(V + E) worst
+// case per bottom-up level (usually far less, as scans stop at the first frontier
+// hit); O(V) extra space, plus O(V + E) for the transpose if it is built.
+BfsResult bfs_direction_optimizing(const AdjList& g, const AdjList& gt, int32_t start,
+                                   DirectionParams params = {});
+BfsResult bfs_direction_optimizing(const CsrGraph& g, const CsrGraph& gt, int32_t start,
+                                   DirectionParams params = {});
+BfsResult bfs_direction_optimizing(const AdjList& g, int32_t start, DirectionParams params = {});
+BfsResult bfs_direction_optimizing(const CsrGraph& g, int32_t start, DirectionParams params = {});
 
 // Full BFS forest over all vertices.
 //
@@ -49,5 +100,6 @@ struct BfsForest {
 
 // Complexity: O(V + E) time, O(V) extra space.
 BfsForest bfs_forest(const AdjList& g);
+BfsForest bfs_forest(const CsrGraph& g);
 
 } // namespace algorithms::graphs::bfs
@@ -1,10 +1,14 @@
+#include <algorithm>
 #include <algorithms/graphs/bfs/bfs.h>
 #include <cstddef>
 #include <queue>
 
 namespace algorithms::graphs::bfs {
 
-BfsResult bfs_from(const AdjList& g, int32_t start) {
+namespace {
+
+// Shared by the AdjList and CsrGraph overloads: G only needs size() and g[v].
+template <typename G> BfsResult bfs_from_impl(const G& g, int32_t start) {
     const int32_t n = static_cast<int32_t>(g.size());
     if (start < 0 || start >= n) {
         return {};
@@ -46,11 +50,143 @@ BfsResult bfs_from(const AdjList& g, int32_t start) {
     return out;
 }
 
-std::vector<int32_t> bfs_order_from(const AdjList& g, int32_t start) {
-    return bfs_from(g, start).order;
+// One bit per vertex.
+class Bitmap {
+  public:
+    explicit Bitmap(size_t n) : words_((n + 63) / 64, 0) {}
+
+    void set(size_t i) { words_[i >> 6] |= uint64_t{1} << (i & 63); }
+    [[nodiscard]] bool test(size_t i) const { return ((words_[i >> 6] >> (i & 63)) & 1) != 0; }
+    void clear() { std::fill(words_.begin(), words_.end(), 0); }
+    void swap(Bitmap& other) noexcept { words_.swap(other.words_); }
+
+  private:
+    std::vector<uint64_t> words_;
+};
+
+// Expand the level out.order[begin, end) along out-arcs; every newly reached
+// vertex is appended to out.order. Returns the out-degree sum of the new vertices.
+template <typename G>
+int64_t top_down_step(const G& g, size_t begin, size_t end, int32_t depth, BfsResult& out) {
+    const auto n = static_cast<int32_t>(g.size());
+    int64_t scout = 0;
+    for (size_t i = begin; i < end; ++i) {
+        const int32_t v = out.order[i];
+        for (int32_t to : g[static_cast<size_t>(v)]) {
+            if (to < 0 || to >= n) {
+                continue;
+            }
+            const auto sto = static_cast<size_t>(to);
+            if (out.dist[sto] != -1) {
+                continue;
+            }
+            out.parent[sto] = v;
+            out.dist[sto] = depth + 1;
+            out.order.push_back(to);
+            scout += static_cast<int64_t>(g[sto].size());
+        }
+    }
+    return scout;
 }
 
-BfsForest bfs_forest(const AdjList& g) {
+// Every unreached vertex looks for an in-arc from the frontier and stops at the
+// first one. New vertices are marked in `next` and appended to out.order.
+// Returns how many were found.
+template <typename G>
+int64_t bottom_up_step(const G& gt, const Bitmap& front, Bitmap& next, int32_t depth,
+                       BfsResult& out) {
+    const auto n = static_cast<int32_t>(gt.size());
+    int64_t awake = 0;
+    for (int32_t v = 0; v < n; ++v) {
+        const auto sv = static_cast<size_t>(v);
+        if (out.dist[sv] != -1) {
+            continue;
+        }
+        for (int32_t from : gt[sv]) {
+            if (from < 0 || from >= n || !front.test(static_cast<size_t>(from))) {
+                continue;
+            }
+            out.parent[sv] = from;
+            out.dist[sv] = depth + 1;
+            out.order.push_back(v);
+            next.set(sv);
+            ++awake;
+            break;
+        }
+    }
+    return awake;
+}
+
+// Beamer's hybrid BFS; see bfs.h. out.order lists the vertices level by level, so
+// the current level is always the slice out.order[level, out.order.size()).
+template <typename G>
+BfsResult bfs_direction_optimizing_impl(const G& g, const G& gt, int32_t start,
+                                        DirectionParams params) {
+    const int32_t n = static_cast<int32_t>(g.size());
+    if (start < 0 || start >= n || gt.size() != g.size()) {
+        return {};
+    }
+    const int64_t alpha = std::max(params.alpha, 1);
+    const int64_t beta = std::max(params.beta, 1);
+
+    BfsResult out;
+    out.parent.assign(static_cast<size_t>(n), -1);
+    out.dist.assign(static_cast<size_t>(n), -1);
+    out.order.reserve(static_cast<size_t>(n));
+    out.dist[static_cast<size_t>(start)] = 0;
+    out.order.push_back(start);
+
+    // Arcs not yet explored top-down, and out-arcs of the current level.
+    int64_t edges_to_check = 0;
+    for (size_t v = 0; v < g.size(); ++v) {
+        edges_to_check += static_cast<int64_t>(g[v].size());
+    }
+    int64_t scout = static_cast<int64_t>(g[static_cast<size_t>(start)].size());
+
+    Bitmap front(static_cast<size_t>(n));
+    Bitmap next(static_cast<size_t>(n));
+    size_t level = 0;
+    int32_t depth = 0;
+    while (level < out.order.size()) {
+        if (scout > edges_to_check / alpha) {
+            front.clear();
+            for (size_t i = level; i < out.order.size(); ++i) {
+                front.set(static_cast<size_t>(out.order[i]));
+            }
+            int64_t awake = static_cast<int64_t>(out.order.size() - level);
+            int64_t old_awake = 0;
+            do {
+                old_awake = awake;
+                level = out.order.size();
+                awake = bottom_up_step(gt, front, next, depth++, out);
+                front.swap(next);
+                next.clear();
+            } while (awake > 0 && (awake >= old_awake || awake > n / beta));
+            scout = 1;
+        } else {
+            edges_to_check -= scout;
+            const size_t end = out.order.size();
+            scout = top_down_step(g, level, end, depth++, out);
+            level = end;
+        }
+    }
+    return out;
+}
+
+AdjList transpose_adj(const AdjList& g) {
+    const auto n = static_cast<int32_t>(g.size());
+    AdjList gt(g.size());
+    for (int32_t u = 0; u < n; ++u) {
+        for (int32_t v : g[static_cast<size_t>(u)]) {
+            if (v >= 0 && v < n) {
+                gt[static_cast<size_t>(v)].push_back(u);
+            }
+        }
+    }
+    return gt;
+}
+
+template <typename G> BfsForest bfs_forest_impl(const G& g) {
     const int32_t n = static_cast<int32_t>(g.size());
 
     BfsForest out;
@@ -98,4 +234,54 @@ BfsForest bfs_forest(const AdjList& g) {
     return out;
 }
 
+} // namespace
+
+BfsResult bfs_from(const AdjList& g, int32_t start) {
+    return bfs_from_impl(g, start);
+}
+
+BfsResult bfs_from(const CsrGraph& g, int32_t start) {
+    return bfs_from_impl(g, start);
+}
+
+std::vector<int32_t> bfs_order_from(const AdjList& g, int32_t start) {
+    return bfs_from(g, start).order;
+}
+
+std::vector<int32_t> bfs_order_from(const CsrGraph& g, int32_t start) {
+    return bfs_from(g, start).order;
+}
+
+BfsResult bfs_direction_optimizing(const AdjList& g, const AdjList& gt, int32_t start,
+                                   DirectionParams params) {
+    return bfs_direction_optimizing_impl(g, gt, start, params);
+}
+
+BfsResult bfs_direction_optimizing(const CsrGraph& g, const CsrGraph& gt, int32_t start,
+                                   DirectionParams params) {
+    return bfs_direction_optimizing_impl(g, gt, start, params);
+}
+
+BfsResult bfs_direction_optimizing(const AdjList& g, int32_t start, DirectionParams params) {
+    if (start < 0 || start >= static_cast<int32_t>(g.size())) {
+        return {};
+    }
+    return bfs_direction_optimizing_impl(g, transpose_adj(g), start, params);
+}
+
+BfsResult bfs_direction_optimizing(const CsrGraph& g, int32_t start, DirectionParams params) {
+    if (start < 0 || start >= g.vertices()) {
+        return {};
+    }
+    return bfs_direction_optimizing_impl(g, csr_graph::transpose(g), start, params);
+}
+
+BfsForest bfs_forest(const AdjList& g) {
+    return bfs_forest_impl(g);
+}
+
+BfsForest bfs_forest(const CsrGraph& g) {
+    return bfs_forest_impl(g);
+}
+
 } // namespace algorithms::graphs::bfs
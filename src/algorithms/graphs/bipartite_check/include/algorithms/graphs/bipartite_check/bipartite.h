@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <optional>
 #include <vector>
@@ -8,6 +9,10 @@ namespace algorithms::graphs::bipartite_check {
 // Graph representation: adjacency list for an undirected graph, nodes are [0, n-1]
 using AdjList = std::vector<std::vector<int32_t>>;
 
+// Flat-array graph (see csr_graph.h). bipartite_bfs and bipartite_dfs color it
+// exactly as they color an AdjList holding the same arcs in the same order.
+using CsrGraph = csr_graph::CsrGraph<>;
+
 // Result type: optional vector of colors (0/1) if bipartite, std::nullopt otherwise
 using ColorResult = std::vector<int32_t>;
 using OptionalColorResult = std::optional<ColorResult>;
@@ -16,7 +21,9 @@ using OptionalColorResult = std::optional<ColorResult>;
 // the graph is bipartite; otherwise returns std::nullopt.
 // Complexity: O(V + E) time, O(V) space.
 OptionalColorResult bipartite_bfs(const AdjList& g);
+OptionalColorResult bipartite_bfs(const CsrGraph& g);
 
 // DFS-based bipartite check (iterative). Also O(V + E) time, O(V) space.
 OptionalColorResult bipartite_dfs(const AdjList& g);
+OptionalColorResult bipartite_dfs(const CsrGraph& g);
 } // namespace algorithms::graphs::bipartite_check
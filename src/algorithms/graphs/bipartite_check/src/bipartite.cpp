@@ -3,7 +3,9 @@
 #include <stack>
 
 namespace algorithms::graphs::bipartite_check {
-OptionalColorResult bipartite_bfs(const AdjList& g) {
+namespace {
+// Shared by the AdjList and CsrGraph overloads: G only needs size() and g[v].
+template <typename G> OptionalColorResult bipartite_bfs_impl(const G& g) {
     int32_t n = (int32_t)g.size();
     ColorResult color(n, -1);
     std::queue<int32_t> q;
@@ -30,7 +32,7 @@ OptionalColorResult bipartite_bfs(const AdjList& g) {
     return color;
 }
 
-OptionalColorResult bipartite_dfs(const AdjList& g) {
+template <typename G> OptionalColorResult bipartite_dfs_impl(const G& g) {
     int32_t n = (int32_t)g.size();
     ColorResult color(n, -1);
     std::stack<int> st;
@@ -56,4 +58,21 @@ OptionalColorResult bipartite_dfs(const AdjList& g) {
     }
     return color;
 }
+} // namespace
+
+OptionalColorResult bipartite_bfs(const AdjList& g) {
+    return bipartite_bfs_impl(g);
+}
+
+OptionalColorResult bipartite_bfs(const CsrGraph& g) {
+    return bipartite_bfs_impl(g);
+}
+
+OptionalColorResult bipartite_dfs(const AdjList& g) {
+    return bipartite_dfs_impl(g);
+}
+
+OptionalColorResult bipartite_dfs(const CsrGraph& g) {
+    return bipartite_dfs_impl(g);
+}
 } // namespace algorithms::graphs::bipartite_check
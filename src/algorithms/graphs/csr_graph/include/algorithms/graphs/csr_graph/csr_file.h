@@ -0,0 +1,98 @@
+#pragma once
+
+#include <algorithms/graphs/csr_graph/csr_graph.h>
+#include <concepts>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <type_traits>
+
+namespace algorithms::graphs::csr_graph {
+// Binary CSR files: a CsrGraph stored exactly as it sits in memory, so that
+// loading one is an mmap instead of a parse.
+//
+//   header   64 bytes: magic "ALGOCSR", format version, byte-order mark,
+//            vertex count n, arc count m, payload type and size
+//   offsets  (n + 1) x int64
+//   targets  m x int32, then zero padding to a multiple of 8 bytes
+//   data     m x payload (absent for CsrGraph<void>)
+//
+// Every section starts 8-byte aligned, so the arrays are used in place. Files
+// are written in native byte order; load_csr() rejects files written with
+// another order, another format version, another payload type, or whose size
+// does not match the header.
+
+// Payload types that can be stored in a file.
+template <typename T>
+concept CsrFileData = std::is_void_v<T> || std::same_as<T, int32_t> || std::same_as<T, int64_t> ||
+                      std::same_as<T, float> || std::same_as<T, double>;
+
+// How much of a file load_csr() checks before handing out the graph.
+enum class CsrVerify {
+    // Header plus every offset and target: O(V + E), reads the whole file once.
+    // A malformed file is rejected instead of causing out-of-range reads later.
+    kFull,
+    // Header, section sizes and the first and last offset only: O(1), so pages
+    // are read lazily as the algorithms touch them. Use for files this process
+    // or a trusted pipeline wrote.
+    kHeaderOnly,
+};
+
+// Write g to path.
+// Returns false if the file could not be written.
+//
+// Complexity: O(V + E).
+template <CsrFileData EdgeData> bool save_csr(const CsrGraph<EdgeData>& g, const std::string& path);
+
+// Open a file written by save_csr() or convert_edge_list(). The graph's arrays
+// point into a read-only mapping of the file where mmap is available
+// (CsrGraph::mapped() is true); elsewhere the file is read into memory. The
+// mapping lives as long as any copy of the graph.
+//
+// Returns std::nullopt if the file is missing, truncated, not a CSR file of
+// this version and payload type, or (with CsrVerify::kFull) not a valid graph.
+template <CsrFileData EdgeData>
+[[nodiscard]] std::optional<CsrGraph<EdgeData>> load_csr(const std::string& path,
+                                                         CsrVerify verify = CsrVerify::kFull);
+
+struct EdgeListOptions {
+    // Number of vertices, or -1 to use the largest id in the file plus one (then
+    // a single stray huge id makes every per-vertex array that large).
+    int32_t vertices = -1;
+    // Threads for both passes. Each thread takes a contiguous byte range of the
+    // input and keeps one counter per vertex.
+    int threads = 1;
+};
+
+struct EdgeListStats {
+    int32_t vertices = 0;
+    int64_t edges = 0;   // arcs written
+    int64_t skipped = 0; // malformed lines and arcs with an out-of-range endpoint
+};
+
+// Convert a text edge list into a binary CSR file, in two streaming passes over
+// the input: count out-degrees, then write every arc straight into its slot in
+// the (memory-mapped) output file.
+//
+// Input: one arc per line, "from to" for CsrGraph<void> or "from to data"
+// otherwise, fields separated by spaces or tabs; further fields are ignored.
+// Blank lines and lines starting with '#' or '%' are comments. Ids must be
+// non-negative decimal integers.
+//
+// - Lines that do not parse, and arcs with an endpoint outside [0, n-1] when
+//   options.vertices is given, are skipped and counted in `skipped`.
+// - The arcs of each vertex keep their order in the file, whatever the thread
+//   count, so the result equals csr_from_edges() on the same list.
+// - Besides the two mapped files, memory use is one int64 counter per vertex
+//   per thread; the arcs never pass through the heap.
+//
+// Returns std::nullopt if the input cannot be read or the output cannot be
+// written.
+//
+// Complexity: O(V * threads + E + file size).
+template <CsrFileData EdgeData>
+std::optional<EdgeListStats> convert_edge_list(const std::string& text_path,
+                                               const std::string& csr_path,
+                                               EdgeListOptions options = {});
+
+} // namespace algorithms::graphs::csr_graph
@@ -0,0 +1,390 @@
+#pragma once
+
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <iterator>
+#include <memory>
+#include <optional>
+#include <span>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace algorithms::graphs::csr_graph {
+// Compressed sparse row (CSR) graph: the out-arcs of all vertices stored back to
+// back in flat arrays.
+//
+//   offsets[v] .. offsets[v + 1]  is the arc range of vertex v  (size n + 1)
+//   targets[i]                    is the head of arc i          (size m)
+//   data[i]                       is the payload of arc i       (size m, absent for void)
+//
+// Compared to std::vector<std::vector<...>>, a CSR graph is three allocations
+// instead of n + 1, has no per-vertex vector header (24 bytes each), and a
+// traversal walks the targets array sequentially instead of chasing one heap
+// pointer per vertex. Weights live in their own array, so algorithms that only
+// follow arcs (BFS, DFS, SCC) never load them.
+//
+// A CsrGraph is immutable once built. Copies share the same arrays, so passing
+// one around by value is cheap. Arcs of a vertex keep the order in which they
+// were given to the builder, so algorithms visit them exactly as they would the
+// equivalent adjacency list and return identical results.
+//
+// Nodes are indexed [0, n-1]. The builders and from_arrays() guarantee that
+// every stored target is a valid vertex.
+//
+// The arrays need not live on the heap: load_csr() (csr_file.h) returns a graph
+// whose arrays point straight into a memory-mapped file.
+
+struct CsrFileAccess;
+
+// An arc of a weighted CsrGraph: head vertex plus the per-arc data. It is an
+// aggregate, so `for (const auto& [to, w] : g[u])` works exactly as it does for
+// the adjacency-list Edge types of the graph modules.
+template <typename EdgeData> struct CsrArc {
+    int32_t to;
+    EdgeData data;
+};
+
+// Out-arcs of one vertex of a weighted CsrGraph: zips the targets and data arrays.
+template <typename EdgeData> class CsrArcs {
+  public:
+    class iterator {
+      public:
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = CsrArc<EdgeData>;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        iterator(const int32_t* to, const EdgeData* data) : to_(to), data_(data) {}
+
+        value_type operator*() const { return {*to_, *data_}; }
+        iterator& operator++() {
+            ++to_;
+            ++data_;
+            return *this;
+        }
+        iterator operator++(int) {
+            iterator old = *this;
+            ++*this;
+            return old;
+        }
+        friend bool operator==(const iterator& a, const iterator& b) { return a.to_ == b.to_; }
+
+      private:
+        const int32_t* to_ = nullptr;
+        const EdgeData* data_ = nullptr;
+    };
+
+    CsrArcs(std::span<const int32_t> to, std::span<const EdgeData> data) : to_(to), data_(data) {}
+
+    [[nodiscard]] iterator begin() const { return {to_.data(), data_.data()}; }
+    [[nodiscard]] iterator end() const { return {to_.data() + to_.size(), nullptr}; }
+    [[nodiscard]] size_t size() const { return to_.size(); }
+    [[nodiscard]] bool empty() const { return to_.empty(); }
+    [[nodiscard]] CsrArc<EdgeData> operator[](size_t i) const { return {to_[i], data_[i]}; }
+
+  private:
+    std::span<const int32_t> to_;
+    std::span<const EdgeData> data_;
+};
+
+template <typename EdgeData = void> class CsrGraph {
+  public:
+    static constexpr bool kWeighted = !std::is_void_v<EdgeData>;
+
+    // Payload type; a placeholder for unweighted graphs, whose data array is empty.
+    using Data = std::conditional_t<kWeighted, EdgeData, std::byte>;
+
+    // What g[v] returns: the targets for an unweighted graph, {to, data} arcs otherwise.
+    using Arcs = std::conditional_t<kWeighted, CsrArcs<Data>, std::span<const int32_t>>;
+
+    // Graph with no vertices.
+    CsrGraph() : CsrGraph(std::vector<int64_t>{0}, {}, {}) {}
+
+    // Adopt prebuilt arrays.
+    //
+    // Returns std::nullopt unless they form a valid graph: offsets is non-empty,
+    // starts at 0, is non-decreasing and ends at targets.size(); every target is
+    // in [0, n-1]; data has one entry per arc (and is empty when EdgeData is void).
+    //
+    // Complexity: O(V + E) to validate; the arrays are moved, not copied.
+    [[nodiscard]] static std::optional<CsrGraph> from_arrays(std::vector<int64_t> offsets,
+                                                             std::vector<int32_t> targets,
+                                                             std::vector<Data> data = {}) {
+        if (!valid(offsets, targets, data)) {
+            return std::nullopt;
+        }
+        return CsrGraph(std::move(offsets), std::move(targets), std::move(data));
+    }
+
+    // Number of vertices, as a size_t so that code written against an adjacency
+    // list (g.size(), g[v]) works unchanged.
+    [[nodiscard]] size_t size() const { return offsets_.size() - 1; }
+
+    [[nodiscard]] int32_t vertices() const { return static_cast<int32_t>(size()); }
+    [[nodiscard]] int64_t edges() const { return static_cast<int64_t>(targets_.size()); }
+
+    // Out-arcs of v. Like std::vector::operator[], v must be in [0, n-1].
+    [[nodiscard]] Arcs operator[](size_t v) const {
+        const auto first = static_cast<size_t>(offsets_[v]);
+        const auto count = static_cast<size_t>(offsets_[v + 1]) - first;
+        if constexpr (kWeighted) {
+            return Arcs(targets_.subspan(first, count), data_.subspan(first, count));
+        } else {
+            return targets_.subspan(first, count);
+        }
+    }
+
+    // Heads of the out-arcs of v; empty if v is out of range.
+    [[nodiscard]] std::span<const int32_t> neighbors(int32_t v) const {
+        if (v < 0 || v >= vertices()) {
+            return {};
+        }
+        const auto sv = static_cast<size_t>(v);
+        const auto first = static_cast<size_t>(offsets_[sv]);
+        return targets_.subspan(first, static_cast<size_t>(offsets_[sv + 1]) - first);
+    }
+
+    // Payloads of the out-arcs of v, parallel to neighbors(v); empty if v is out of range.
+    [[nodiscard]] std::span<const Data> edge_data(int32_t v) const
+        requires kWeighted
+    {
+        if (v < 0 || v >= vertices()) {
+            return {};
+        }
+        const auto sv = static_cast<size_t>(v);
+        const auto first = static_cast<size_t>(offsets_[sv]);
+        return data_.subspan(first, static_cast<size_t>(offsets_[sv + 1]) - first);
+    }
+
+    // Out-degree of v, or 0 if v is out of range.
+    [[nodiscard]] int64_t degree(int32_t v) const {
+        return static_cast<int64_t>(neighbors(v).size());
+    }
+
+    [[nodiscard]] std::span<const int64_t> offsets() const { return offsets_; }
+    [[nodiscard]] std::span<const int32_t> targets() const { return targets_; }
+    [[nodiscard]] std::span<const Data> data() const { return data_; }
+
+    // Bytes held by the three arrays.
+    [[nodiscard]] size_t memory_bytes() const {
+        return offsets_.size_bytes() + targets_.size_bytes() + data_.size_bytes();
+    }
+
+    // True if the arrays live in a memory-mapped file rather than on the heap.
+    [[nodiscard]] bool mapped() const { return mapped_; }
+
+  private:
+    struct Arrays {
+        std::vector<int64_t> offsets;
+        std::vector<int32_t> targets;
+        std::vector<Data> data;
+    };
+
+    std::shared_ptr<const void> owner_; // keeps the arrays below alive
+    std::span<const int64_t> offsets_;
+    std::span<const int32_t> targets_;
+    std::span<const Data> data_;
+    bool mapped_ = false;
+
+    CsrGraph(std::vector<int64_t> offsets, std::vector<int32_t> targets, std::vector<Data> data) {
+        auto arrays = std::make_shared<Arrays>(
+            Arrays{std::move(offsets), std::move(targets), std::move(data)});
+        offsets_ = arrays->offsets;
+        targets_ = arrays->targets;
+        data_ = arrays->data;
+        owner_ = std::move(arrays);
+    }
+
+    // View over arrays kept alive by owner (used by load_csr()).
+    CsrGraph(std::shared_ptr<const void> owner, std::span<const int64_t> offsets,
+             std::span<const int32_t> targets, std::span<const Data> data, bool mapped)
+        : owner_(std::move(owner)), offsets_(offsets), targets_(targets), data_(data),
+          mapped_(mapped) {}
+
+    static bool valid(std::span<const int64_t> offsets, std::span<const int32_t> targets,
+                      std::span<const Data> data) {
+        if (offsets.empty() || offsets.front() != 0 ||
+            offsets.back() != static_cast<int64_t>(targets.size()) ||
+            offsets.size() - 1 > static_cast<size_t>(INT32_MAX) ||
+            data.size() != (kWeighted ? targets.size() : 0)) {
+            return false;
+        }
+        for (size_t v = 1; v < offsets.size(); ++v) {
+            if (offsets[v] < offsets[v - 1]) {
+                return false;
+            }
+        }
+        const auto n = static_cast<int64_t>(offsets.size() - 1);
+        for (int32_t to : targets) {
+            if (to < 0 || to >= n) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+    template <typename> friend class CsrBuilder;
+    friend struct CsrFileAccess;
+};
+
+// Directed edge from -> to with its payload, input to csr_from_edges().
+template <typename EdgeData = void> struct CsrEdge {
+    int32_t from;
+    int32_t to;
+    EdgeData data;
+};
+
+template <> struct CsrEdge<void> {
+    int32_t from;
+    int32_t to;
+};
+
+// Fills CSR arrays from arcs given in any order, in two passes over the input
+// (count out-degrees, then place). Arcs with an endpoint outside [0, n-1] are
+// dropped. Placement is stable: each vertex keeps its arcs in input order.
+template <typename EdgeData> class CsrBuilder {
+  public:
+    using Graph = CsrGraph<EdgeData>;
+    using Data = typename Graph::Data;
+
+    explicit CsrBuilder(int32_t n)
+        : n_(n < 0 ? 0 : n), offsets_(static_cast<size_t>(n_) + 1, 0) {}
+
+    // Pass 1: announce an arc.
+    void count(int32_t from, int32_t to) {
+        if (valid(from) && valid(to)) {
+            ++offsets_[static_cast<size_t>(from) + 1];
+        }
+    }
+
+    // Between the passes: turn the degrees into offsets and size the arrays.
+    void allocate() {
+        for (size_t v = 1; v < offsets_.size(); ++v) {
+            offsets_[v] += offsets_[v - 1];
+        }
+        cursor_.assign(offsets_.begin(), offsets_.end() - 1);
+        targets_.resize(static_cast<size_t>(offsets_.back()));
+        if constexpr (Graph::kWeighted) {
+            data_.resize(targets_.size());
+        }
+    }
+
+    // Pass 2: place the same arcs again, in the same order.
+    void place(int32_t from, int32_t to, const Data& data = {}) {
+        if (!valid(from) || !valid(to)) {
+            return;
+        }
+        const auto i = static_cast<size_t>(cursor_[static_cast<size_t>(from)]++);
+        targets_[i] = to;
+        if constexpr (Graph::kWeighted) {
+            data_[i] = data;
+        }
+    }
+
+    [[nodiscard]] Graph build() && {
+        return Graph(std::move(offsets_), std::move(targets_), std::move(data_));
+    }
+
+  private:
+    int32_t n_;
+    std::vector<int64_t> offsets_;
+    std::vector<int64_t> cursor_; // next free slot of each vertex during pass 2
+    std::vector<int32_t> targets_;
+    std::vector<Data> data_;
+
+    [[nodiscard]] bool valid(int32_t v) const { return v >= 0 && v < n_; }
+};
+
+// Build a graph with n vertices from a list of directed arcs.
+//
+// - If n <= 0, returns a graph with no vertices.
+// - Arcs with an endpoint outside [0, n-1] are ignored.
+// - Parallel arcs and self-loops are kept.
+// - The arcs of each vertex keep their order in `edges`.
+//
+// Complexity: O(V + E) time (counting sort), O(V + E) memory.
+template <typename EdgeData>
+[[nodiscard]] CsrGraph<EdgeData> csr_from_edges(int32_t n,
+                                                const std::vector<CsrEdge<EdgeData>>& edges) {
+    CsrBuilder<EdgeData> builder(n);
+    for (const auto& e : edges) {
+        builder.count(e.from, e.to);
+    }
+    builder.allocate();
+    for (const auto& e : edges) {
+        if constexpr (std::is_void_v<EdgeData>) {
+            builder.place(e.from, e.to);
+        } else {
+            builder.place(e.from, e.to, e.data);
+        }
+    }
+    return std::move(builder).build();
+}
+
+// Build an unweighted graph from an adjacency list (the AdjList type of the bfs,
+// dfs, bipartite_check, topological_sort and kosaraju_scc modules).
+// Arcs to vertices outside [0, n-1] are ignored.
+//
+// Complexity: O(V + E).
+[[nodiscard]] CsrGraph<> csr_from_adjacency(const std::vector<std::vector<int32_t>>& g);
+
+// Build a weighted graph from an adjacency list of {to, w} edges (the Graph type
+// of the dijkstra and bellman_ford modules). The payload type is the type of w.
+// Arcs to vertices outside [0, n-1] are ignored.
+//
+// Complexity: O(V + E).
+template <typename Edge>
+    requires requires(const Edge& e) {
+        { e.to } -> std::convertible_to<int32_t>;
+        e.w;
+    }
+[[nodiscard]] auto csr_from_adjacency(const std::vector<std::vector<Edge>>& g)
+    -> CsrGraph<std::remove_cvref_t<decltype(Edge::w)>> {
+    const auto n = static_cast<int32_t>(g.size());
+    CsrBuilder<std::remove_cvref_t<decltype(Edge::w)>> builder(n);
+    for (int32_t u = 0; u < n; ++u) {
+        for (const auto& e : g[static_cast<size_t>(u)]) {
+            builder.count(u, e.to);
+        }
+    }
+    builder.allocate();
+    for (int32_t u = 0; u < n; ++u) {
+        for (const auto& e : g[static_cast<size_t>(u)]) {
+            builder.place(u, e.to, e.w);
+        }
+    }
+    return std::move(builder).build();
+}
+
+// Reverse every arc. The in-arcs of each vertex come out ordered by tail vertex
+// (and by position among the tail's arcs), exactly as when a transposed
+// adjacency list is built by scanning u = 0..n-1 and pushing u onto gt[v].
+//
+// Complexity: O(V + E).
+template <typename EdgeData>
+[[nodiscard]] CsrGraph<EdgeData> transpose(const CsrGraph<EdgeData>& g) {
+    const int32_t n = g.vertices();
+    CsrBuilder<EdgeData> builder(n);
+    for (int32_t to : g.targets()) {
+        builder.count(to, 0);
+    }
+    builder.allocate();
+    const auto offsets = g.offsets();
+    const auto targets = g.targets();
+    for (int32_t u = 0; u < n; ++u) {
+        const auto su = static_cast<size_t>(u);
+        for (auto i = static_cast<size_t>(offsets[su]); i < static_cast<size_t>(offsets[su + 1]);
+             ++i) {
+            if constexpr (CsrGraph<EdgeData>::kWeighted) {
+                builder.place(targets[i], u, g.data()[i]);
+            } else {
+                builder.place(targets[i], u);
+            }
+        }
+    }
+    return std::move(builder).build();
+}
+
+} // namespace algorithms::graphs::csr_graph
@@ -0,0 +1,576 @@
+#include <algorithm>
+#include <algorithms/graphs/csr_graph/csr_file.h>
+#include <charconv>
+#include <cstdio>
+#include <cstring>
+#include <exception>
+#include <limits>
+#include <memory>
+#include <span>
+#include <thread>
+#include <utility>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define ALGO_CSR_HAVE_MMAP 1
+#endif
+
+namespace algorithms::graphs::csr_graph {
+
+// Gives the file code access to CsrGraph's validation and view constructor.
+struct CsrFileAccess {
+    template <typename EdgeData>
+    static bool valid(std::span<const int64_t> offsets, std::span<const int32_t> targets,
+                      std::span<const typename CsrGraph<EdgeData>::Data> data) {
+        return CsrGraph<EdgeData>::valid(offsets, targets, data);
+    }
+
+    template <typename EdgeData>
+    static CsrGraph<EdgeData> view(std::shared_ptr<const void> owner,
+                                   std::span<const int64_t> offsets,
+                                   std::span<const int32_t> targets,
+                                   std::span<const typename CsrGraph<EdgeData>::Data> data,
+                                   bool mapped) {
+        return CsrGraph<EdgeData>(std::move(owner), offsets, targets, data, mapped);
+    }
+};
+
+namespace {
+constexpr char kMagic[8] = {'A', 'L', 'G', 'O', 'C', 'S', 'R', '\0'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrder = 0x01020304;
+
+struct Header {
+    char magic[8];
+    uint32_t version;
+    uint32_t byte_order;
+    uint64_t vertices;
+    uint64_t edges;
+    uint32_t data_type;  // DataType of the payload
+    uint32_t data_bytes; // size of one payload, 0 for void
+    uint64_t reserved[3];
+};
+static_assert(sizeof(Header) == 64);
+
+enum DataType : uint32_t { kNone = 0, kInt32 = 1, kInt64 = 2, kFloat = 3, kDouble = 4 };
+
+template <typename EdgeData> constexpr uint32_t data_type() {
+    if constexpr (std::is_void_v<EdgeData>) {
+        return kNone;
+    } else if constexpr (std::is_same_v<EdgeData, int32_t>) {
+        return kInt32;
+    } else if constexpr (std::is_same_v<EdgeData, int64_t>) {
+        return kInt64;
+    } else if constexpr (std::is_same_v<EdgeData, float>) {
+        return kFloat;
+    } else {
+        return kDouble;
+    }
+}
+
+template <typename EdgeData> constexpr uint32_t data_bytes() {
+    if constexpr (std::is_void_v<EdgeData>) {
+        return 0;
+    } else {
+        return sizeof(EdgeData);
+    }
+}
+
+constexpr size_t round_up8(size_t x) {
+    return (x + 7) & ~size_t{7};
+}
+
+// Byte offsets of the sections of a file with n vertices and m arcs.
+struct Layout {
+    size_t offsets;
+    size_t targets;
+    size_t data;
+    size_t total;
+};
+
+// std::nullopt if the file would not fit in the address space.
+std::optional<Layout> layout(uint64_t n, uint64_t m, uint32_t payload_bytes) {
+    constexpr uint64_t kMax = std::numeric_limits<size_t>::max() / 32;
+    if (n >= kMax || m >= kMax || payload_bytes > 8) {
+        return std::nullopt;
+    }
+    Layout l{};
+    l.offsets = sizeof(Header);
+    l.targets = l.offsets + static_cast<size_t>(n + 1) * sizeof(int64_t);
+    l.data = round_up8(l.targets + static_cast<size_t>(m) * sizeof(int32_t));
+    l.total = l.data + static_cast<size_t>(m) * payload_bytes;
+    return l;
+}
+
+template <typename EdgeData> Header make_header(uint64_t n, uint64_t m) {
+    Header h{};
+    std::memcpy(h.magic, kMagic, sizeof(kMagic));
+    h.version = kVersion;
+    h.byte_order = kByteOrder;
+    h.vertices = n;
+    h.edges = m;
+    h.data_type = data_type<EdgeData>();
+    h.data_bytes = data_bytes<EdgeData>();
+    return h;
+}
+
+// A whole file as read-only bytes: mapped where mmap is available, read into an
+// 8-byte aligned buffer otherwise.
+class FileView {
+  public:
+    FileView(const FileView&) = delete;
+    FileView& operator=(const FileView&) = delete;
+
+    ~FileView() {
+#if defined(ALGO_CSR_HAVE_MMAP)
+        if (map_ != nullptr) {
+            ::munmap(map_, bytes_);
+        }
+#endif
+    }
+
+    // nullptr if the file cannot be opened or read.
+    static std::shared_ptr<const FileView> open(const std::string& path) {
+        std::shared_ptr<FileView> view(new FileView());
+#if defined(ALGO_CSR_HAVE_MMAP)
+        const int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) {
+            return nullptr;
+        }
+        struct stat st{};
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            return nullptr;
+        }
+        view->bytes_ = static_cast<size_t>(st.st_size);
+        if (view->bytes_ > 0) {
+            void* map = ::mmap(nullptr, view->bytes_, PROT_READ, MAP_SHARED, fd, 0);
+            if (map == MAP_FAILED) {
+                ::close(fd);
+                return nullptr;
+            }
+            view->map_ = map;
+            view->data_ = static_cast<const std::byte*>(map);
+        }
+        ::close(fd); // the mapping keeps the file alive
+#else
+        std::FILE* f = std::fopen(path.c_str(), "rb");
+        if (f == nullptr) {
+            return nullptr;
+        }
+        long bytes = -1;
+        if (std::fseek(f, 0, SEEK_END) == 0) {
+            bytes = std::ftell(f);
+        }
+        if (bytes < 0 || std::fseek(f, 0, SEEK_SET) != 0) {
+            std::fclose(f);
+            return nullptr;
+        }
+        view->bytes_ = static_cast<size_t>(bytes);
+        view->owned_.resize((view->bytes_ + 7) / 8);
+        const bool ok = std::fread(view->owned_.data(), 1, view->bytes_, f) == view->bytes_;
+        std::fclose(f);
+        if (!ok) {
+            return nullptr;
+        }
+        view->data_ = reinterpret_cast<const std::byte*>(view->owned_.data());
+#endif
+        return view;
+    }
+
+    [[nodiscard]] const std::byte* data() const { return data_; }
+    [[nodiscard]] size_t size() const { return bytes_; }
+    [[nodiscard]] bool mapped() const { return map_ != nullptr; }
+
+  private:
+    FileView() = default;
+
+    const std::byte* data_ = nullptr;
+    size_t bytes_ = 0;
+    void* map_ = nullptr;         // mmap base, or nullptr when data_ points into owned_
+    std::vector<uint64_t> owned_; // file contents without mmap
+};
+
+// A new file of fixed size filled in through memory: a shared writable mapping
+// where mmap is available, so pages go to the page cache rather than the heap;
+// a zeroed buffer written out by commit() otherwise.
+class OutputFile {
+  public:
+    OutputFile(const OutputFile&) = delete;
+    OutputFile& operator=(const OutputFile&) = delete;
+
+    ~OutputFile() { release(); }
+
+    // nullptr if the file cannot be created at that size.
+    static std::unique_ptr<OutputFile> create(const std::string& path, size_t bytes) {
+        std::unique_ptr<OutputFile> out(new OutputFile());
+        out->bytes_ = bytes;
+#if defined(ALGO_CSR_HAVE_MMAP)
+        out->fd_ = ::open(path.c_str(), O_RDWR | O_CREAT | O_TRUNC, 0644);
+        if (out->fd_ < 0 || ::ftruncate(out->fd_, static_cast<off_t>(bytes)) != 0) {
+            return nullptr;
+        }
+        void* map = ::mmap(nullptr, bytes, PROT_READ | PROT_WRITE, MAP_SHARED, out->fd_, 0);
+        if (map == MAP_FAILED) {
+            return nullptr;
+        }
+        out->data_ = static_cast<std::byte*>(map);
+#else
+        out->path_ = path;
+        out->owned_.assign((bytes + 7) / 8, 0);
+        out->data_ = reinterpret_cast<std::byte*>(out->owned_.data());
+#endif
+        return out;
+    }
+
+    [[nodiscard]] std::byte* data() const { return data_; }
+
+    // Finish the file. Returns false if it could not be written.
+    bool commit() {
+#if defined(ALGO_CSR_HAVE_MMAP)
+        return release();
+#else
+        std::FILE* f = std::fopen(path_.c_str(), "wb");
+        if (f == nullptr) {
+            return false;
+        }
+        const bool ok = std::fwrite(data_, 1, bytes_, f) == bytes_;
+        return std::fclose(f) == 0 && ok;
+#endif
+    }
+
+  private:
+    OutputFile() = default;
+
+    std::byte* data_ = nullptr;
+    size_t bytes_ = 0;
+#if defined(ALGO_CSR_HAVE_MMAP)
+    int fd_ = -1;
+
+    bool release() {
+        bool ok = true;
+        if (data_ != nullptr) {
+            ok = ::munmap(data_, bytes_) == 0;
+            data_ = nullptr;
+        }
+        if (fd_ >= 0) {
+            ok = ::close(fd_) == 0 && ok;
+            fd_ = -1;
+        }
+        return ok;
+    }
+#else
+    std::string path_;
+    std::vector<uint64_t> owned_;
+
+    bool release() { return true; }
+#endif
+};
+
+// Run fn(c) for c in [0, parts) on `parts` threads (the caller runs c = 0).
+// An exception thrown by any call is rethrown after all threads have joined.
+template <typename Fn> void parallel_for(size_t parts, Fn fn) {
+    std::vector<std::exception_ptr> errors(parts);
+    auto guarded = [&](size_t c) {
+        try {
+            fn(c);
+        } catch (...) {
+            errors[c] = std::current_exception();
+        }
+    };
+    std::vector<std::thread> pool;
+    for (size_t c = 1; c < parts; ++c) {
+        pool.emplace_back(guarded, c);
+    }
+    if (parts > 0) {
+        guarded(0);
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+    for (const auto& e : errors) {
+        if (e) {
+            std::rethrow_exception(e);
+        }
+    }
+}
+
+bool is_space(char c) {
+    return c == ' ' || c == '\t' || c == '\r';
+}
+
+// Parse the next field of a line into out and move p past it.
+template <typename T> bool parse_field(const char*& p, const char* end, T& out) {
+    while (p < end && is_space(*p)) {
+        ++p;
+    }
+    const auto [next, ec] = std::from_chars(p, end, out);
+    if (ec != std::errc{} || (next < end && !is_space(*next))) {
+        return false;
+    }
+    p = next;
+    return true;
+}
+
+// One parsed input line.
+template <typename EdgeData> struct Line {
+    enum Kind { kComment, kBad, kArc } kind;
+    int64_t from;
+    int64_t to;
+    typename CsrGraph<EdgeData>::Data data;
+};
+
+template <typename EdgeData> Line<EdgeData> parse_line(const char* p, const char* end) {
+    Line<EdgeData> line{Line<EdgeData>::kBad, 0, 0, {}};
+    while (p < end && is_space(*p)) {
+        ++p;
+    }
+    if (p == end || *p == '#' || *p == '%') {
+        line.kind = Line<EdgeData>::kComment;
+        return line;
+    }
+    if (!parse_field(p, end, line.from) || !parse_field(p, end, line.to)) {
+        return line;
+    }
+    if constexpr (!std::is_void_v<EdgeData>) {
+        if (!parse_field(p, end, line.data)) {
+            return line;
+        }
+    }
+    line.kind = Line<EdgeData>::kArc;
+    return line;
+}
+
+// Call fn(first, last) for every line of text that starts in [begin, end).
+template <typename Fn>
+void for_each_line(std::span<const char> text, size_t begin, size_t end, Fn fn) {
+    auto next_line = [&](size_t from) {
+        const void* nl = std::memchr(text.data() + from, '\n', text.size() - from);
+        return nl == nullptr ? text.size()
+                             : static_cast<size_t>(static_cast<const char*>(nl) - text.data());
+    };
+    size_t pos = begin;
+    if (pos > 0) { // a line starts right after a newline; skip the one in progress
+        pos = next_line(pos - 1) + 1;
+    }
+    while (pos < end) {
+        const size_t eol = next_line(pos);
+        fn(text.data() + pos, text.data() + eol);
+        pos = eol + 1;
+    }
+}
+
+// Per-thread state of the converter: out-degrees of the thread's arcs during
+// pass 1, then the next free slot of each vertex for the thread during pass 2.
+struct Chunk {
+    size_t begin;
+    size_t end;
+    std::vector<int64_t> slot;
+    int64_t skipped = 0;
+};
+} // namespace
+
+template <CsrFileData EdgeData>
+bool save_csr(const CsrGraph<EdgeData>& g, const std::string& path) {
+    const auto n = static_cast<uint64_t>(g.vertices());
+    const auto m = static_cast<uint64_t>(g.edges());
+    const auto l = layout(n, m, data_bytes<EdgeData>());
+    if (!l) {
+        return false;
+    }
+    const Header header = make_header<EdgeData>(n, m);
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    auto write = [f](const void* bytes, size_t count) {
+        return count == 0 || std::fwrite(bytes, 1, count, f) == count;
+    };
+    const char padding[8] = {};
+    const size_t pad = l->data - (l->targets + g.targets().size_bytes());
+    const bool ok = write(&header, sizeof(header)) &&
+                    write(g.offsets().data(), g.offsets().size_bytes()) &&
+                    write(g.targets().data(), g.targets().size_bytes()) && write(padding, pad) &&
+                    write(g.data().data(), g.data().size_bytes());
+    return std::fclose(f) == 0 && ok;
+}
+
+template <CsrFileData EdgeData>
+std::optional<CsrGraph<EdgeData>> load_csr(const std::string& path, CsrVerify verify) {
+    using Data = typename CsrGraph<EdgeData>::Data;
+
+    auto file = FileView::open(path);
+    if (!file || file->size() < sizeof(Header)) {
+        return std::nullopt;
+    }
+    Header h;
+    std::memcpy(&h, file->data(), sizeof(h));
+    if (std::memcmp(h.magic, kMagic, sizeof(kMagic)) != 0 || h.version != kVersion ||
+        h.byte_order != kByteOrder || h.data_type != data_type<EdgeData>() ||
+        h.data_bytes != data_bytes<EdgeData>() || h.vertices > static_cast<uint64_t>(INT32_MAX)) {
+        return std::nullopt;
+    }
+    const auto l = layout(h.vertices, h.edges, h.data_bytes);
+    if (!l || l->total != file->size()) {
+        return std::nullopt;
+    }
+
+    const std::byte* base = file->data();
+    const auto n = static_cast<size_t>(h.vertices);
+    const auto m = static_cast<size_t>(h.edges);
+    const std::span offsets(reinterpret_cast<const int64_t*>(base + l->offsets), n + 1);
+    const std::span targets(reinterpret_cast<const int32_t*>(base + l->targets), m);
+    std::span<const Data> data;
+    if constexpr (!std::is_void_v<EdgeData>) {
+        data = std::span(reinterpret_cast<const Data*>(base + l->data), m);
+    }
+
+    if (offsets.front() != 0 || offsets.back() != static_cast<int64_t>(m)) {
+        return std::nullopt;
+    }
+    if (verify == CsrVerify::kFull && !CsrFileAccess::valid<EdgeData>(offsets, targets, data)) {
+        return std::nullopt;
+    }
+    const bool mapped = file->mapped();
+    return CsrFileAccess::view<EdgeData>(std::move(file), offsets, targets, data, mapped);
+}
+
+template <CsrFileData EdgeData>
+std::optional<EdgeListStats> convert_edge_list(const std::string& text_path,
+                                               const std::string& csr_path,
+                                               EdgeListOptions options) {
+    using Data = typename CsrGraph<EdgeData>::Data;
+    using ParsedLine = Line<EdgeData>;
+
+    const auto input = FileView::open(text_path);
+    if (!input) {
+        return std::nullopt;
+    }
+    const std::span text(reinterpret_cast<const char*>(input->data()), input->size());
+
+    // Byte ranges below ~1 MiB are not worth a thread.
+    const size_t parts = std::min(static_cast<size_t>(std::max(options.threads, 1)),
+                                  std::max<size_t>(text.size() >> 20, 1));
+    std::vector<Chunk> chunks(parts);
+    for (size_t c = 0; c < parts; ++c) {
+        chunks[c].begin = text.size() * c / parts;
+        chunks[c].end = text.size() * (c + 1) / parts;
+    }
+
+    // Pass 1: out-degrees per chunk. Without a given vertex count, every chunk
+    // grows its counters to its largest id; n is the largest of those.
+    const bool fixed_n = options.vertices >= 0;
+    const int64_t id_limit = fixed_n ? options.vertices : int64_t{INT32_MAX};
+    parallel_for(parts, [&](size_t c) {
+        Chunk& chunk = chunks[c];
+        if (fixed_n) {
+            chunk.slot.assign(static_cast<size_t>(options.vertices), 0);
+        }
+        for_each_line(text, chunk.begin, chunk.end, [&](const char* first, const char* last) {
+            const ParsedLine line = parse_line<EdgeData>(first, last);
+            if (line.kind == ParsedLine::kComment) {
+                return;
+            }
+            if (line.kind == ParsedLine::kBad || line.from < 0 || line.from >= id_limit ||
+                line.to < 0 || line.to >= id_limit) {
+                ++chunk.skipped;
+                return;
+            }
+            const auto needed = static_cast<size_t>(std::max(line.from, line.to)) + 1;
+            if (chunk.slot.size() < needed) {
+                chunk.slot.resize(needed, 0);
+            }
+            ++chunk.slot[static_cast<size_t>(line.from)];
+        });
+    });
+
+    EdgeListStats stats;
+    size_t n = fixed_n ? static_cast<size_t>(options.vertices) : 0;
+    for (auto& chunk : chunks) {
+        n = std::max(n, chunk.slot.size());
+        stats.skipped += chunk.skipped;
+    }
+    for (auto& chunk : chunks) {
+        chunk.slot.resize(n, 0);
+    }
+    for (const auto& chunk : chunks) {
+        for (int64_t d : chunk.slot) {
+            stats.edges += d;
+        }
+    }
+    stats.vertices = static_cast<int32_t>(n);
+
+    const auto l = layout(n, static_cast<uint64_t>(stats.edges), data_bytes<EdgeData>());
+    if (!l) {
+        return std::nullopt;
+    }
+    auto out = OutputFile::create(csr_path, l->total);
+    if (!out) {
+        return std::nullopt;
+    }
+    std::byte* base = out->data();
+    auto* offsets = reinterpret_cast<int64_t*>(base + l->offsets);
+    auto* targets = reinterpret_cast<int32_t*>(base + l->targets);
+    auto* data = reinterpret_cast<Data*>(base + l->data);
+
+    // Offsets, and the first slot of every (chunk, vertex): chunk c places the
+    // arcs of v after those of chunks 0..c-1, which keeps file order.
+    offsets[0] = 0;
+    for (size_t v = 0; v < n; ++v) {
+        int64_t next = offsets[v];
+        for (auto& chunk : chunks) {
+            const int64_t degree = chunk.slot[v];
+            chunk.slot[v] = next;
+            next += degree;
+        }
+        offsets[v + 1] = next;
+    }
+
+    // Pass 2: place every arc in its slot. Lines parse as in pass 1, and every
+    // id accepted there is below n.
+    const auto limit = static_cast<int64_t>(n);
+    parallel_for(parts, [&](size_t c) {
+        Chunk& chunk = chunks[c];
+        for_each_line(text, chunk.begin, chunk.end, [&](const char* first, const char* last) {
+            const ParsedLine line = parse_line<EdgeData>(first, last);
+            if (line.kind != ParsedLine::kArc || line.from < 0 || line.from >= limit ||
+                line.to < 0 || line.to >= limit) {
+                return;
+            }
+            const auto i = static_cast<size_t>(chunk.slot[static_cast<size_t>(line.from)]++);
+            targets[i] = static_cast<int32_t>(line.to);
+            if constexpr (!std::is_void_v<EdgeData>) {
+                data[i] = line.data;
+            }
+        });
+    });
+
+    // The header goes in last, so an interrupted conversion leaves a file that
+    // load_csr() rejects.
+    const Header header = make_header<EdgeData>(n, static_cast<uint64_t>(stats.edges));
+    std::memcpy(base, &header, sizeof(header));
+    if (!out->commit()) {
+        return std::nullopt;
+    }
+    return stats;
+}
+
+#define ALGO_CSR_FILE_INSTANTIATE(T)                                                              \
+    template bool save_csr<T>(const CsrGraph<T>&, const std::string&);                            \
+    template std::optional<CsrGraph<T>> load_csr<T>(const std::string&, CsrVerify);               \
+    template std::optional<EdgeListStats> convert_edge_list<T>(                                   \
+        const std::string&, const std::string&, EdgeListOptions);
+
+ALGO_CSR_FILE_INSTANTIATE(void)
+ALGO_CSR_FILE_INSTANTIATE(int32_t)
+ALGO_CSR_FILE_INSTANTIATE(int64_t)
+ALGO_CSR_FILE_INSTANTIATE(float)
+ALGO_CSR_FILE_INSTANTIATE(double)
+
+#undef ALGO_CSR_FILE_INSTANTIATE
+
+} // namespace algorithms::graphs::csr_graph
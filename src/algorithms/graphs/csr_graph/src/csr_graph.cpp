@@ -0,0 +1,22 @@
+#include <algorithms/graphs/csr_graph/csr_graph.h>
+
+namespace algorithms::graphs::csr_graph {
+
+CsrGraph<> csr_from_adjacency(const std::vector<std::vector<int32_t>>& g) {
+    const auto n = static_cast<int32_t>(g.size());
+    CsrBuilder<void> builder(n);
+    for (int32_t u = 0; u < n; ++u) {
+        for (int32_t v : g[static_cast<size_t>(u)]) {
+            builder.count(u, v);
+        }
+    }
+    builder.allocate();
+    for (int32_t u = 0; u < n; ++u) {
+        for (int32_t v : g[static_cast<size_t>(u)]) {
+            builder.place(u, v);
+        }
+    }
+    return std::move(builder).build();
+}
+
+} // namespace algorithms::graphs::csr_graph
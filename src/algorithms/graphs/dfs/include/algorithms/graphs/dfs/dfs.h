@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <vector>
 
@@ -8,6 +9,10 @@ namespace algorithms::graphs::dfs {
 // Nodes are indexed [0, n-1].
 using AdjList = std::vector<std::vector<int32_t>>;
 
+// Flat-array graph (see csr_graph.h). The CSR overloads of both DFS variants follow
+// the stored arc order, so forests and orders match those of the AdjList overloads.
+using CsrGraph = csr_graph::CsrGraph<>;
+
 // Result of a full DFS forest traversal.
 //
 // Invariants:
@@ -27,6 +32,7 @@ struct DfsForest {
 //
 // Complexity: O(V + E) time, O(V) extra space.
 DfsForest dfs_forest(const AdjList& g);
+DfsForest dfs_forest(const CsrGraph& g);
 
 // Run a DFS from a single start vertex.
 //
@@ -34,6 +40,7 @@ DfsForest dfs_forest(const AdjList& g);
 //
 // Complexity: O(V + E) in the worst case (for reachable subgraph), O(V) space.
 std::vector<int32_t> dfs_order_from(const AdjList& g, int32_t start);
+std::vector<int32_t> dfs_order_from(const CsrGraph& g, int32_t start);
 
 // Recursive DFS forest traversal.
 //
@@ -41,10 +48,12 @@ std::vector<int32_t> dfs_order_from(const AdjList& g, int32_t start);
 //
 // Complexity: O(V + E) time, O(V) extra space (plus recursion depth up to O(V)).
 DfsForest dfs_forest_recursive(const AdjList& g);
+DfsForest dfs_forest_recursive(const CsrGraph& g);
 
 // Recursive DFS from a single start vertex.
 // Returns discovery order of the reachable subgraph.
 // If start is out of range, returns an empty vector.
 std::vector<int32_t> dfs_order_from_recursive(const AdjList& g, int32_t start);
+std::vector<int32_t> dfs_order_from_recursive(const CsrGraph& g, int32_t start);
 
 } // namespace algorithms::graphs::dfs
@@ -11,9 +11,9 @@ struct Frame {
     int32_t parent;
     size_t next_idx;
 };
-} // namespace
 
-DfsForest dfs_forest(const AdjList& g) {
+// Shared by the AdjList and CsrGraph overloads: G only needs size() and g[v].
+template <typename G> DfsForest dfs_forest_impl(const G& g) {
     const int32_t n = static_cast<int32_t>(g.size());
 
     DfsForest out;
@@ -66,7 +66,7 @@ DfsForest dfs_forest(const AdjList& g) {
     return out;
 }
 
-std::vector<int32_t> dfs_order_from(const AdjList& g, int32_t start) {
+template <typename G> std::vector<int32_t> dfs_order_from_impl(const G& g, int32_t start) {
     const int32_t n = static_cast<int32_t>(g.size());
     if (start < 0 || start >= n) {
         return {};
@@ -103,8 +103,8 @@ std::vector<int32_t> dfs_order_from(const AdjList& g, int32_t start) {
     return order;
 }
 
-namespace {
-void dfs_rec_visit(const AdjList& g, int32_t v, int32_t parent, std::vector<uint8_t>& color,
+template <typename G>
+void dfs_rec_visit(const G& g, int32_t v, int32_t parent, std::vector<uint8_t>& color,
                    int32_t& timer, DfsForest& out) {
     const int32_t n = static_cast<int32_t>(g.size());
     const auto sv = static_cast<size_t>(v);
@@ -127,9 +127,8 @@ void dfs_rec_visit(const AdjList& g, int32_t v, int32_t parent, std::vector<uint
     color[sv] = 2;
     out.tout[sv] = timer++;
 }
-} // namespace
 
-DfsForest dfs_forest_recursive(const AdjList& g) {
+template <typename G> DfsForest dfs_forest_recursive_impl(const G& g) {
     const int32_t n = static_cast<int32_t>(g.size());
 
     DfsForest out;
@@ -152,8 +151,8 @@ DfsForest dfs_forest_recursive(const AdjList& g) {
     return out;
 }
 
-namespace {
-void dfs_rec_order(const AdjList& g, int32_t v, std::vector<uint8_t>& seen,
+template <typename G>
+void dfs_rec_order(const G& g, int32_t v, std::vector<uint8_t>& seen,
                    std::vector<int32_t>& order) {
     const int32_t n = static_cast<int32_t>(g.size());
     const auto sv = static_cast<size_t>(v);
@@ -171,9 +170,9 @@ void dfs_rec_order(const AdjList& g, int32_t v, std::vector<uint8_t>& seen,
         }
     }
 }
-} // namespace
 
-std::vector<int32_t> dfs_order_from_recursive(const AdjList& g, int32_t start) {
+template <typename G>
+std::vector<int32_t> dfs_order_from_recursive_impl(const G& g, int32_t start) {
     const int32_t n = static_cast<int32_t>(g.size());
     if (start < 0 || start >= n) {
         return {};
@@ -188,4 +187,38 @@ std::vector<int32_t> dfs_order_from_recursive(const AdjList& g, int32_t start) {
     return order;
 }
 
+} // namespace
+
+DfsForest dfs_forest(const AdjList& g) {
+    return dfs_forest_impl(g);
+}
+
+DfsForest dfs_forest(const CsrGraph& g) {
+    return dfs_forest_impl(g);
+}
+
+std::vector<int32_t> dfs_order_from(const AdjList& g, int32_t start) {
+    return dfs_order_from_impl(g, start);
+}
+
+std::vector<int32_t> dfs_order_from(const CsrGraph& g, int32_t start) {
+    return dfs_order_from_impl(g, start);
+}
+
+DfsForest dfs_forest_recursive(const AdjList& g) {
+    return dfs_forest_recursive_impl(g);
+}
+
+DfsForest dfs_forest_recursive(const CsrGraph& g) {
+    return dfs_forest_recursive_impl(g);
+}
+
+std::vector<int32_t> dfs_order_from_recursive(const AdjList& g, int32_t start) {
+    return dfs_order_from_recursive_impl(g, start);
+}
+
+std::vector<int32_t> dfs_order_from_recursive(const CsrGraph& g, int32_t start) {
+    return dfs_order_from_recursive_impl(g, start);
+}
+
 } // namespace algorithms::graphs::dfs
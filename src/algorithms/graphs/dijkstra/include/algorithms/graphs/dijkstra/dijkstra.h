@@ -1,5 +1,7 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
+#include <cstddef>
 #include <cstdint>
 #include <limits>
 #include <vector>
@@ -15,7 +17,15 @@ struct Edge {
 // Adjacency list representation
 using Graph = std::vector<std::vector<Edge>>;
 
+// CSR representation (see csr_graph.h): targets and weights in flat arrays.
+// csr_graph::csr_from_adjacency(g) converts a Graph; each overload below returns
+// exactly what it returns for that Graph.
+using CsrGraph = csr_graph::CsrGraph<int32_t>;
+
 std::vector<int32_t> dijkstra_queue(const Graph& g, int32_t s);
+std::vector<int32_t> dijkstra_queue(const CsrGraph& g, int32_t s);
 std::vector<int32_t> dijkstra_set(const Graph& g, int32_t s);
+std::vector<int32_t> dijkstra_set(const CsrGraph& g, int32_t s);
 std::vector<int32_t> dijkstra(const Graph& g, int32_t s);
+std::vector<int32_t> dijkstra(const CsrGraph& g, int32_t s);
 } // namespace algorithms::graphs::dijkstra
\ No newline at end of file
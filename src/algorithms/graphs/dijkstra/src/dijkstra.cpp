@@ -8,7 +8,9 @@ constexpr int32_t INF = std::numeric_limits<int32_t>::max();
 }
 
 namespace algorithms::graphs::dijkstra {
-std::vector<int32_t> dijkstra_queue(const Graph& g, int32_t s) {
+namespace {
+// Shared by the Graph and CsrGraph overloads: both yield {to, w} pairs from g[u].
+template <typename G> std::vector<int32_t> dijkstra_queue_impl(const G& g, int32_t s) {
     std::vector<int32_t> dist(g.size(), INF);
 
     using P = std::pair<int32_t, int32_t>;
@@ -35,7 +37,7 @@ std::vector<int32_t> dijkstra_queue(const Graph& g, int32_t s) {
     return dist;
 }
 
-std::vector<int32_t> dijkstra_set(const Graph& g, int32_t s) {
+template <typename G> std::vector<int32_t> dijkstra_set_impl(const G& g, int32_t s) {
     std::vector<int32_t> dist(g.size(), INF);
 
     using P = std::pair<int32_t, int32_t>;
@@ -60,7 +62,7 @@ std::vector<int32_t> dijkstra_set(const Graph& g, int32_t s) {
     return dist;
 }
 
-std::vector<int32_t> dijkstra(const Graph& g, int32_t s) {
+template <typename G> std::vector<int32_t> dijkstra_impl(const G& g, int32_t s) {
     std::vector<int32_t> dist(g.size(), INF);
     std::vector<bool> u(g.size(), false);
 
@@ -85,4 +87,29 @@ std::vector<int32_t> dijkstra(const Graph& g, int32_t s) {
 
     return dist;
 }
+} // namespace
+
+std::vector<int32_t> dijkstra_queue(const Graph& g, int32_t s) {
+    return dijkstra_queue_impl(g, s);
+}
+
+std::vector<int32_t> dijkstra_queue(const CsrGraph& g, int32_t s) {
+    return dijkstra_queue_impl(g, s);
+}
+
+std::vector<int32_t> dijkstra_set(const Graph& g, int32_t s) {
+    return dijkstra_set_impl(g, s);
+}
+
+std::vector<int32_t> dijkstra_set(const CsrGraph& g, int32_t s) {
+    return dijkstra_set_impl(g, s);
+}
+
+std::vector<int32_t> dijkstra(const Graph& g, int32_t s) {
+    return dijkstra_impl(g, s);
+}
+
+std::vector<int32_t> dijkstra(const CsrGraph& g, int32_t s) {
+    return dijkstra_impl(g, s);
+}
 } // namespace algorithms::graphs::dijkstra
\ No newline at end of file
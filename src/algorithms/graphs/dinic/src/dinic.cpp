@@ -109,4 +109,14 @@ int64_t compute_max_flow(int32_t n, const std::vector<std::tuple<int32_t, int32_
     return network.max_flow(source, sink);
 }
 
+int64_t compute_max_flow(const csr_graph::CsrGraph<int32_t>& g, int32_t source, int32_t sink) {
+    FlowNetwork network(g.vertices());
+    for (int32_t u = 0; u < g.vertices(); ++u) {
+        for (const auto& [to, capacity] : g[static_cast<size_t>(u)]) {
+            network.add_edge(u, to, capacity);
+        }
+    }
+    return network.max_flow(source, sink);
+}
+
 } // namespace algorithms::graphs::dinic
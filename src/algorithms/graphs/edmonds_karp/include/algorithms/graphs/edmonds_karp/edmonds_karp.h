@@ -1,7 +1,10 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <limits>
+#include <tuple>
+#include <utility>
 #include <vector>
 
 namespace algorithms::graphs::edmonds_karp {
@@ -102,4 +105,16 @@ class FlowNetwork {
 compute_max_flow(int32_t n, const std::vector<std::tuple<int32_t, int32_t, int32_t>>& edges,
                  int32_t source, int32_t sink);
 
+/**
+ * @brief Compute maximum flow on a graph stored in CSR form.
+ * @param g Directed graph whose arc payloads are the capacities (see csr_graph.h).
+ * @param source Source vertex.
+ * @param sink Sink vertex.
+ * @return Maximum flow value, the same as for the equivalent edge list.
+ *
+ * The residual network is built from the arcs in CSR order.
+ */
+[[nodiscard]] int64_t compute_max_flow(const csr_graph::CsrGraph<int32_t>& g, int32_t source,
+                                       int32_t sink);
+
 } // namespace algorithms::graphs::edmonds_karp
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <limits>
 #include <vector>
@@ -39,4 +40,12 @@ struct FloydWarshallResult {
 // Complexity: O(n^3) time, O(n^2) memory.
 FloydWarshallResult floyd_warshall(const std::vector<std::vector<int32_t>>& weights);
 
+// Same for a weighted CSR graph (see csr_graph.h). The adjacency matrix is built
+// from its arcs: the lightest of parallel arcs is used, and weights[i][i] is
+// min(0, lightest self-loop). The O(n^2) matrix dominates memory, so this is
+// only a convenience for graphs already stored as CSR.
+//
+// Complexity: O(n^3 + E) time, O(n^2) memory.
+FloydWarshallResult floyd_warshall(const csr_graph::CsrGraph<int32_t>& g);
+
 } // namespace algorithms::graphs::floyd_warshall
@@ -1,5 +1,6 @@
 #include "algorithms/graphs/floyd_warshall/floyd_warshall.h"
 
+#include <algorithm>
 #include <cstddef>
 
 namespace {
@@ -99,4 +100,17 @@ FloydWarshallResult floyd_warshall(const std::vector<std::vector<int32_t>>& weig
     return out;
 }
 
+FloydWarshallResult floyd_warshall(const csr_graph::CsrGraph<int32_t>& g) {
+    const auto n = g.size();
+    std::vector<std::vector<int32_t>> weights(n, std::vector<int32_t>(n, FloydWarshallResult::INF));
+    for (size_t u = 0; u < n; ++u) {
+        weights[u][u] = 0;
+        for (const auto& [v, w] : g[u]) {
+            auto& cell = weights[u][static_cast<size_t>(v)];
+            cell = std::min(cell, w);
+        }
+    }
+    return floyd_warshall(weights);
+}
+
 } // namespace algorithms::graphs::floyd_warshall
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -9,6 +10,10 @@ namespace algorithms::graphs::kosaraju_scc {
 // Nodes are indexed [0, n-1].
 using AdjList = std::vector<std::vector<int32_t>>;
 
+// Flat-array graph (see csr_graph.h). kosaraju_scc gives the same SccResult for it
+// as for the equivalent AdjList; build_condensation_graph returns a CsrGraph.
+using CsrGraph = csr_graph::CsrGraph<>;
+
 // Result of SCC decomposition.
 //
 // Invariants (on return):
@@ -30,6 +35,9 @@ struct SccResult {
 // Complexity: O(V + E) time and O(V + E) extra space (transpose + stacks).
 SccResult kosaraju_scc(const AdjList& g);
 
+// Same for a CSR graph; the transpose is built as a CSR graph too (csr_graph::transpose).
+SccResult kosaraju_scc(const CsrGraph& g);
+
 // Convenience helper: builds SCCs as a list of vertex groups (by component id).
 //
 // The returned list has size == components_count and `components[c]` contains all
@@ -43,4 +51,7 @@ std::vector<std::vector<int32_t>> build_components(const SccResult& scc);
 // The output has no parallel edges.
 AdjList build_condensation_graph(const AdjList& g, const SccResult& scc);
 
+// Same for a CSR graph, returning the condensation as a CSR graph.
+CsrGraph build_condensation_graph(const CsrGraph& g, const SccResult& scc);
+
 } // namespace algorithms::graphs::kosaraju_scc
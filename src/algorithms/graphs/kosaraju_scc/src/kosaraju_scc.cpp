@@ -24,9 +24,14 @@ AdjList build_transpose(const AdjList& g) {
     return gt;
 }
 
+CsrGraph build_transpose(const CsrGraph& g) {
+    return csr_graph::transpose(g);
+}
+
 // Iterative DFS that appends vertices to `out_order` in postorder.
-static void dfs_postorder_iter(const AdjList& g, int32_t start, std::vector<uint8_t>& used,
-                               std::vector<int32_t>& out_order) {
+template <typename G>
+void dfs_postorder_iter(const G& g, int32_t start, std::vector<uint8_t>& used,
+                        std::vector<int32_t>& out_order) {
     // state: (vertex, next_edge_index)
     struct Frame {
         int32_t v;
@@ -63,8 +68,8 @@ static void dfs_postorder_iter(const AdjList& g, int32_t start, std::vector<uint
 }
 
 // Iterative DFS on transpose that assigns component id.
-static void dfs_assign_iter(const AdjList& gt, int32_t start, int32_t comp_id,
-                            std::vector<int32_t>& comp_of) {
+template <typename G>
+void dfs_assign_iter(const G& gt, int32_t start, int32_t comp_id, std::vector<int32_t>& comp_of) {
     std::vector<int32_t> st;
     st.push_back(start);
     comp_of[static_cast<size_t>(start)] = comp_id;
@@ -89,9 +94,9 @@ static void dfs_assign_iter(const AdjList& gt, int32_t start, int32_t comp_id,
     }
 }
 
-} // namespace
-
-SccResult kosaraju_scc(const AdjList& g) {
+// Shared by the AdjList and CsrGraph overloads: G only needs size() and g[v],
+// and build_transpose(g) to return a G.
+template <typename G> SccResult kosaraju_scc_impl(const G& g) {
     const int32_t n = static_cast<int32_t>(g.size());
 
     SccResult res;
@@ -114,7 +119,7 @@ SccResult kosaraju_scc(const AdjList& g) {
     }
 
     // Pass 2: DFS on transpose in reverse finish order, assign components.
-    const AdjList gt = build_transpose(g);
+    const G gt = build_transpose(g);
 
     for (int32_t i = n - 1; i >= 0; --i) {
         const int32_t v = order[static_cast<size_t>(i)];
@@ -128,22 +133,7 @@ SccResult kosaraju_scc(const AdjList& g) {
     return res;
 }
 
-std::vector<std::vector<int32_t>> build_components(const SccResult& scc) {
-    const int32_t n = static_cast<int32_t>(scc.component_of.size());
-    std::vector<std::vector<int32_t>> comps(static_cast<size_t>(scc.components_count));
-
-    for (int32_t v = 0; v < n; ++v) {
-        const int32_t c = scc.component_of[static_cast<size_t>(v)];
-        if (c < 0) {
-            continue;
-        }
-        comps[static_cast<size_t>(c)].push_back(v);
-    }
-
-    return comps;
-}
-
-AdjList build_condensation_graph(const AdjList& g, const SccResult& scc) {
+template <typename G> AdjList build_condensation_graph_impl(const G& g, const SccResult& scc) {
     const int32_t n = static_cast<int32_t>(g.size());
     const int32_t cns = scc.components_count;
 
@@ -188,4 +178,37 @@ AdjList build_condensation_graph(const AdjList& g, const SccResult& scc) {
     return dag;
 }
 
+} // namespace
+
+SccResult kosaraju_scc(const AdjList& g) {
+    return kosaraju_scc_impl(g);
+}
+
+SccResult kosaraju_scc(const CsrGraph& g) {
+    return kosaraju_scc_impl(g);
+}
+
+std::vector<std::vector<int32_t>> build_components(const SccResult& scc) {
+    const int32_t n = static_cast<int32_t>(scc.component_of.size());
+    std::vector<std::vector<int32_t>> comps(static_cast<size_t>(scc.components_count));
+
+    for (int32_t v = 0; v < n; ++v) {
+        const int32_t c = scc.component_of[static_cast<size_t>(v)];
+        if (c < 0) {
+            continue;
+        }
+        comps[static_cast<size_t>(c)].push_back(v);
+    }
+
+    return comps;
+}
+
+AdjList build_condensation_graph(const AdjList& g, const SccResult& scc) {
+    return build_condensation_graph_impl(g, scc);
+}
+
+CsrGraph build_condensation_graph(const CsrGraph& g, const SccResult& scc) {
+    return csr_graph::csr_from_adjacency(build_condensation_graph_impl(g, scc));
+}
+
 } // namespace algorithms::graphs::kosaraju_scc
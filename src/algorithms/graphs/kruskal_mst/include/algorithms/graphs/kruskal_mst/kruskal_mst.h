@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <vector>
 
@@ -13,6 +14,9 @@ struct Edge {
     int64_t w{};
 };
 
+// CSR graph with int64_t weights (see csr_graph.h).
+using CsrGraph = csr_graph::CsrGraph<int64_t>;
+
 // Kruskal output for a graph with n vertices.
 //
 // For connected graphs this is a Minimum Spanning Tree (MST).
@@ -40,4 +44,9 @@ struct KruskalMstResult {
 // - O(V) extra space for DSU
 KruskalMstResult kruskal_mst(int32_t n, std::vector<Edge> edges);
 
+// Same for a graph given in CSR form: every arc u -> v with weight w is the
+// undirected edge (u, v, w). A symmetric graph (each edge stored in both
+// directions) lists every edge twice, which does not change the forest weight.
+KruskalMstResult kruskal_mst(const CsrGraph& g);
+
 } // namespace algorithms::graphs::kruskal_mst
@@ -1,7 +1,9 @@
 #include "algorithms/graphs/kruskal_mst/kruskal_mst.h"
 
 #include <algorithm>
+#include <cstddef>
 #include <numeric>
+#include <utility>
 
 namespace algorithms::graphs::kruskal_mst {
 namespace {
@@ -110,4 +112,15 @@ KruskalMstResult kruskal_mst(int32_t n, std::vector<Edge> edges) {
     return res;
 }
 
+KruskalMstResult kruskal_mst(const CsrGraph& g) {
+    std::vector<Edge> edges;
+    edges.reserve(static_cast<size_t>(g.edges()));
+    for (int32_t u = 0; u < g.vertices(); ++u) {
+        for (const auto& [v, w] : g[static_cast<size_t>(u)]) {
+            edges.push_back(Edge{.u = u, .v = v, .w = w});
+        }
+    }
+    return kruskal_mst(g.vertices(), std::move(edges));
+}
+
 } // namespace algorithms::graphs::kruskal_mst
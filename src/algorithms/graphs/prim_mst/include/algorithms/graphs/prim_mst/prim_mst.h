@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstdint>
 #include <vector>
 
@@ -13,6 +14,9 @@ struct Edge {
     int64_t w{};
 };
 
+// CSR graph with int64_t weights (see csr_graph.h).
+using CsrGraph = csr_graph::CsrGraph<int64_t>;
+
 // Prim output for a graph with n vertices.
 //
 // For connected graphs this is a Minimum Spanning Tree (MST).
@@ -36,9 +40,18 @@ struct PrimMstResult {
 // - Edges with endpoints out of range are ignored.
 //
 // Complexity:
-// - Building adjacency list: O(E)
+// - Building the CSR adjacency: O(V + E)
 // - Heap-based Prim: O((V + E) log E)
 // - Extra memory: O(V + E)
 PrimMstResult prim_mst(int32_t n, const std::vector<Edge>& edges);
 
+// Same for a graph given in CSR form, used directly as the adjacency structure.
+//
+// The graph must be symmetric: every undirected edge stored as both u -> v and
+// v -> u with the same weight (which is what prim_mst(n, edges) builds). Self-loops
+// are ignored.
+//
+// Complexity: O((V + E) log E) time, O(V + E) extra memory for the heap.
+PrimMstResult prim_mst(const CsrGraph& g);
+
 } // namespace algorithms::graphs::prim_mst
@@ -1,6 +1,8 @@
 #include "algorithms/graphs/prim_mst/prim_mst.h"
 
+#include <cstddef>
 #include <queue>
+#include <utility>
 #include <vector>
 
 namespace algorithms::graphs::prim_mst {
@@ -10,11 +12,6 @@ bool is_valid_vertex(int32_t v, int32_t n) {
     return v >= 0 && v < n;
 }
 
-struct AdjEdge {
-    int32_t to{};
-    int64_t w{};
-};
-
 struct HeapItem {
     int64_t w{};
     int32_t from{};
@@ -38,19 +35,32 @@ PrimMstResult prim_mst(int32_t n, const std::vector<Edge>& edges) {
         return PrimMstResult{.vertices = 0, .components = 0, .total_weight = 0, .edges = {}};
     }
 
-    // Build adjacency list; ignore self-loops and invalid endpoints (mirrors Kruskal module rules).
-    std::vector<std::vector<AdjEdge>> g(static_cast<size_t>(n));
-    g.shrink_to_fit();
-
+    // Build a symmetric CSR adjacency; ignore self-loops and invalid endpoints (mirrors
+    // Kruskal module rules). Arcs keep input order, as push_back into per-vertex lists would.
+    csr_graph::CsrBuilder<int64_t> builder(n);
+    auto usable = [n](const Edge& e) {
+        return e.u != e.v && is_valid_vertex(e.u, n) && is_valid_vertex(e.v, n);
+    };
     for (const auto& e : edges) {
-        if (e.u == e.v) {
-            continue;
+        if (usable(e)) {
+            builder.count(e.u, e.v);
+            builder.count(e.v, e.u);
         }
-        if (!is_valid_vertex(e.u, n) || !is_valid_vertex(e.v, n)) {
-            continue;
+    }
+    builder.allocate();
+    for (const auto& e : edges) {
+        if (usable(e)) {
+            builder.place(e.u, e.v, e.w);
+            builder.place(e.v, e.u, e.w);
         }
-        g[static_cast<size_t>(e.u)].push_back(AdjEdge{.to = e.v, .w = e.w});
-        g[static_cast<size_t>(e.v)].push_back(AdjEdge{.to = e.u, .w = e.w});
+    }
+    return prim_mst(std::move(builder).build());
+}
+
+PrimMstResult prim_mst(const CsrGraph& g) {
+    const int32_t n = g.vertices();
+    if (n <= 0) {
+        return PrimMstResult{.vertices = 0, .components = 0, .total_weight = 0, .edges = {}};
     }
 
     PrimMstResult res;
@@ -70,8 +80,8 @@ PrimMstResult prim_mst(int32_t n, const std::vector<Edge>& edges) {
         used[static_cast<size_t>(start)] = 1;
 
         std::priority_queue<HeapItem, std::vector<HeapItem>, std::greater<>> pq;
-        for (const auto& ae : g[static_cast<size_t>(start)]) {
-            pq.push(HeapItem{.w = ae.w, .from = start, .to = ae.to});
+        for (const auto& [to, w] : g[static_cast<size_t>(start)]) {
+            pq.push(HeapItem{.w = w, .from = start, .to = to});
         }
 
         while (!pq.empty()) {
@@ -88,9 +98,9 @@ PrimMstResult prim_mst(int32_t n, const std::vector<Edge>& edges) {
             res.total_weight += cur.w;
 
             // Add outgoing edges.
-            for (const auto& ae : g[static_cast<size_t>(cur.to)]) {
-                if (used[static_cast<size_t>(ae.to)] == 0) {
-                    pq.push(HeapItem{.w = ae.w, .from = cur.to, .to = ae.to});
+            for (const auto& [to, w] : g[static_cast<size_t>(cur.to)]) {
+                if (used[static_cast<size_t>(to)] == 0) {
+                    pq.push(HeapItem{.w = w, .from = cur.to, .to = to});
                 }
             }
         }
@@ -1,5 +1,6 @@
 #pragma once
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <cstddef>
 #include <cstdint>
 #include <vector>
@@ -9,6 +10,10 @@ namespace algorithms::graphs::topological_sort {
 // Nodes are indexed [0, n-1].
 using AdjList = std::vector<std::vector<int32_t>>;
 
+// Flat-array graph (see csr_graph.h). Each sort below also takes one; as the result
+// depends only on vertex ids and arc order, it matches the AdjList overload.
+using CsrGraph = csr_graph::CsrGraph<>;
+
 // Result of a topological sort.
 //
 // Invariants (on return):
@@ -34,6 +39,7 @@ struct TopologicalSortResult {
 //
 // Complexity: O(V + E) time, O(V) memory.
 TopologicalSortResult topological_sort(const AdjList& g);
+TopologicalSortResult topological_sort(const CsrGraph& g);
 
 // DFS-based topological sort (postorder).
 //
@@ -47,14 +53,17 @@ TopologicalSortResult topological_sort(const AdjList& g);
 //
 // Complexity: O(V + E) time, O(V) memory.
 TopologicalSortResult topological_sort_dfs(const AdjList& g);
+TopologicalSortResult topological_sort_dfs(const CsrGraph& g);
 
 // Convenience wrapper: returns only the ordering.
 //
 // If the graph has a cycle, returns an empty vector.
 std::vector<int32_t> topological_order_or_empty(const AdjList& g);
+std::vector<int32_t> topological_order_or_empty(const CsrGraph& g);
 
 // Convenience wrapper for DFS-based variant.
 // If the graph has a cycle, returns an empty vector.
 std::vector<int32_t> topological_order_or_empty_dfs(const AdjList& g);
+std::vector<int32_t> topological_order_or_empty_dfs(const CsrGraph& g);
 
 } // namespace algorithms::graphs::topological_sort
@@ -12,8 +12,9 @@ enum class Color : uint8_t {
     Black = 2,
 };
 
-static void dfs_visit(const AdjList& g, int32_t v, std::vector<Color>& color,
-                      std::vector<int32_t>& out, bool& has_cycle) {
+template <typename G>
+void dfs_visit(const G& g, int32_t v, std::vector<Color>& color, std::vector<int32_t>& out,
+               bool& has_cycle) {
     if (has_cycle) {
         return;
     }
@@ -42,9 +43,9 @@ static void dfs_visit(const AdjList& g, int32_t v, std::vector<Color>& color,
     color[static_cast<size_t>(v)] = Color::Black;
     out.push_back(v); // postorder
 }
-} // namespace
 
-TopologicalSortResult topological_sort_dfs(const AdjList& g) {
+// Shared by the AdjList and CsrGraph overloads: G only needs size() and g[v].
+template <typename G> TopologicalSortResult topological_sort_dfs_impl(const G& g) {
     const int32_t n = static_cast<int32_t>(g.size());
 
     TopologicalSortResult res;
@@ -70,15 +71,7 @@ TopologicalSortResult topological_sort_dfs(const AdjList& g) {
     return res;
 }
 
-std::vector<int32_t> topological_order_or_empty_dfs(const AdjList& g) {
-    auto res = topological_sort_dfs(g);
-    if (res.has_cycle) {
-        return {};
-    }
-    return std::move(res.order);
-}
-
-TopologicalSortResult topological_sort(const AdjList& g) {
+template <typename G> TopologicalSortResult topological_sort_impl(const G& g) {
     const int32_t n = static_cast<int32_t>(g.size());
 
     TopologicalSortResult out;
@@ -129,6 +122,40 @@ TopologicalSortResult topological_sort(const AdjList& g) {
     return out;
 }
 
+} // namespace
+
+TopologicalSortResult topological_sort_dfs(const AdjList& g) {
+    return topological_sort_dfs_impl(g);
+}
+
+TopologicalSortResult topological_sort_dfs(const CsrGraph& g) {
+    return topological_sort_dfs_impl(g);
+}
+
+std::vector<int32_t> topological_order_or_empty_dfs(const AdjList& g) {
+    auto res = topological_sort_dfs(g);
+    if (res.has_cycle) {
+        return {};
+    }
+    return std::move(res.order);
+}
+
+std::vector<int32_t> topological_order_or_empty_dfs(const CsrGraph& g) {
+    auto res = topological_sort_dfs(g);
+    if (res.has_cycle) {
+        return {};
+    }
+    return std::move(res.order);
+}
+
+TopologicalSortResult topological_sort(const AdjList& g) {
+    return topological_sort_impl(g);
+}
+
+TopologicalSortResult topological_sort(const CsrGraph& g) {
+    return topological_sort_impl(g);
+}
+
 std::vector<int32_t> topological_order_or_empty(const AdjList& g) {
     auto res = topological_sort(g);
     if (res.has_cycle) {
@@ -137,4 +164,12 @@ std::vector<int32_t> topological_order_or_empty(const AdjList& g) {
     return std::move(res.order);
 }
 
+std::vector<int32_t> topological_order_or_empty(const CsrGraph& g) {
+    auto res = topological_sort(g);
+    if (res.has_cycle) {
+        return {};
+    }
+    return std::move(res.order);
+}
+
 } // namespace algorithms::graphs::topological_sort
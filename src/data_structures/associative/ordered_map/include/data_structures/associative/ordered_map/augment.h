@@ -0,0 +1,97 @@
+#pragma once
+
+#include <algorithm>
+#include <concepts>
+#include <cstddef>
+#include <limits>
+#include <utility>
+
+namespace ds::ordered_map {
+
+// Subtree augmentation policies for OrderedMap.
+//
+// An augmentation is a monoid folded over every subtree in key order and kept
+// up to date through insert, erase and rotations. A policy exposes:
+//
+//   using value_type = ...;
+//   static value_type identity();
+//   static value_type lift(const Key&, const Value&);          // one node
+//   static value_type combine(const value_type&, const value_type&);  // associative
+//
+// The fold at a node is combine(combine(left, lift(node)), right), so combine
+// does not need to be commutative. Policies that also provide
+//
+//   static std::size_t count(const value_type&);
+//
+// enable the order-statistics queries select / rank / count_in_range.
+// Policy functions run inside the tree's noexcept rotations and must not throw.
+
+// Default: no per-node payload, no extra work in rotations.
+struct NoAugment {
+    struct value_type {};
+    static value_type identity() noexcept { return {}; }
+    template <typename K, typename V> static value_type lift(const K&, const V&) noexcept {
+        return {};
+    }
+    static value_type combine(value_type, value_type) noexcept { return {}; }
+};
+
+// Subtree size only — enough for select / rank / count_in_range.
+struct SubtreeSize {
+    using value_type = std::size_t;
+    static value_type identity() noexcept { return 0; }
+    template <typename K, typename V> static value_type lift(const K&, const V&) noexcept {
+        return 1;
+    }
+    static value_type combine(value_type a, value_type b) noexcept { return a + b; }
+    static std::size_t count(value_type v) noexcept { return v; }
+};
+
+// Sum of mapped values.
+template <typename T> struct ValueSum {
+    using value_type = T;
+    static value_type identity() { return T{}; }
+    template <typename K> static value_type lift(const K&, const T& v) { return v; }
+    static value_type combine(const T& a, const T& b) { return a + b; }
+};
+
+// Minimum of mapped values; identity is numeric_limits<T>::max().
+template <typename T> struct ValueMin {
+    using value_type = T;
+    static value_type identity() { return std::numeric_limits<T>::max(); }
+    template <typename K> static value_type lift(const K&, const T& v) { return v; }
+    static value_type combine(const T& a, const T& b) { return std::min(a, b); }
+};
+
+// Maximum of mapped values; identity is numeric_limits<T>::lowest().
+template <typename T> struct ValueMax {
+    using value_type = T;
+    static value_type identity() { return std::numeric_limits<T>::lowest(); }
+    template <typename K> static value_type lift(const K&, const T& v) { return v; }
+    static value_type combine(const T& a, const T& b) { return std::max(a, b); }
+};
+
+// Subtree size paired with an arbitrary monoid M, so a single tree answers
+// both order-statistics and range-aggregate queries.
+template <typename M> struct Counted {
+    struct value_type {
+        std::size_t             count = 0;
+        typename M::value_type  agg   = M::identity();
+    };
+    static value_type identity() { return {}; }
+    template <typename K, typename V> static value_type lift(const K& k, const V& v) {
+        return {1, M::lift(k, v)};
+    }
+    static value_type combine(const value_type& a, const value_type& b) {
+        return {a.count + b.count, M::combine(a.agg, b.agg)};
+    }
+    static std::size_t count(const value_type& v) noexcept { return v.count; }
+};
+
+// Satisfied by augmentations that track subtree sizes.
+template <typename A>
+concept CountingAugment = requires(const typename A::value_type& v) {
+    { A::count(v) } -> std::convertible_to<std::size_t>;
+};
+
+} // namespace ds::ordered_map
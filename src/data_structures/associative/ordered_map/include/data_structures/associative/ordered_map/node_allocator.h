@@ -0,0 +1,122 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <utility>
+#include <vector>
+
+namespace ds::ordered_map {
+
+// Node allocation policies for OrderedMap.
+//
+// A policy is a class template over the node type providing
+//
+//   T*   allocate();              // uninitialised storage for one T
+//   void deallocate(T*) noexcept; // return storage of a destroyed T
+//   void release() noexcept;      // drop every outstanding allocation
+//   static constexpr bool kBulkRelease;
+//
+// When kBulkRelease is true the tree tears down with release() instead of
+// deallocating node by node (it still runs destructors if the node type
+// needs them). Copying a map never copies its allocator: the copy starts
+// with a fresh, empty one.
+
+// One global new/delete per node; the behaviour OrderedMap always had.
+template <typename T> class HeapAllocator {
+public:
+    static constexpr bool kBulkRelease = false;
+
+    T*   allocate() { return std::allocator<T>{}.allocate(1); }
+    void deallocate(T* p) noexcept { std::allocator<T>{}.deallocate(p, 1); }
+    void release() noexcept {}
+};
+
+// Slab allocator: nodes are carved sequentially from blocks that double in
+// size (64 → 4096 nodes), freed nodes go to an intrusive free list and are
+// reused first, and release() returns all blocks in O(blocks).
+//
+// Nodes allocated together (a bulk build, a copy) end up adjacent in memory,
+// which also shortens the pointer chase for top-down searches.
+template <typename T> class ArenaAllocator {
+public:
+    static constexpr bool kBulkRelease = true;
+
+    ArenaAllocator() = default;
+    ~ArenaAllocator() { release(); }
+
+    ArenaAllocator(const ArenaAllocator&)            = delete;
+    ArenaAllocator& operator=(const ArenaAllocator&) = delete;
+
+    ArenaAllocator(ArenaAllocator&& other) noexcept
+        : blocks_(std::move(other.blocks_)),
+          free_(std::exchange(other.free_, nullptr)),
+          cursor_(std::exchange(other.cursor_, nullptr)),
+          end_(std::exchange(other.end_, nullptr)) {
+        other.blocks_.clear();
+    }
+
+    ArenaAllocator& operator=(ArenaAllocator&& other) noexcept {
+        if (this != &other) {
+            release();
+            blocks_ = std::move(other.blocks_);
+            other.blocks_.clear();
+            free_   = std::exchange(other.free_, nullptr);
+            cursor_ = std::exchange(other.cursor_, nullptr);
+            end_    = std::exchange(other.end_, nullptr);
+        }
+        return *this;
+    }
+
+    T* allocate() {
+        if (free_) {
+            Slot* s = free_;
+            free_   = s->next;
+            return reinterpret_cast<T*>(s);
+        }
+        if (cursor_ == end_) grow();
+        return reinterpret_cast<T*>(cursor_++);
+    }
+
+    void deallocate(T* p) noexcept {
+        Slot* s = reinterpret_cast<Slot*>(p);
+        s->next = free_;
+        free_   = s;
+    }
+
+    void release() noexcept {
+        for (auto& [p, n] : blocks_) std::allocator<Slot>{}.deallocate(p, n);
+        blocks_.clear();
+        free_ = cursor_ = end_ = nullptr;
+    }
+
+    /// Number of blocks currently held.
+    std::size_t blocks() const noexcept { return blocks_.size(); }
+
+private:
+    // Storage cell: large and aligned enough for a T, doubles as a free-list link.
+    union Slot {
+        Slot* next;
+        alignas(T) std::byte bytes[sizeof(T)];
+    };
+
+    static constexpr std::size_t kFirstBlock = 64;
+    static constexpr std::size_t kMaxBlock   = 4096;
+
+    std::vector<std::pair<Slot*, std::size_t>> blocks_;
+    Slot* free_   = nullptr;
+    Slot* cursor_ = nullptr;
+    Slot* end_    = nullptr;
+
+    void grow() {
+        std::size_t n = blocks_.empty() ? kFirstBlock
+                                        : std::min(blocks_.back().second * 2, kMaxBlock);
+        blocks_.reserve(blocks_.size() + 1);
+        Slot* p = std::allocator<Slot>{}.allocate(n);
+        blocks_.emplace_back(p, n);
+        cursor_ = p;
+        end_    = p + n;
+    }
+};
+
+} // namespace ds::ordered_map
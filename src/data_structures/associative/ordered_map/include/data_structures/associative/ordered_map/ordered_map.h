@@ -1,8 +1,13 @@
 #pragma once
 
+#include "data_structures/associative/ordered_map/augment.h"
+#include "data_structures/associative/ordered_map/node_allocator.h"
+
 #include <algorithm>
 #include <cstddef>
 #include <functional>
+#include <new>
+#include <type_traits>
 #include <utility>
 
 namespace ds::ordered_map {
@@ -17,31 +22,51 @@ namespace ds::ordered_map {
 //   insert, erase, find, contains, operator[]: O(log n)
 //   min_key, max_key:                          O(log n)
 //   size, empty:                               O(1)
-//   clear:                                     O(n)
+//   clear:                                     O(n), O(blocks) with ArenaAllocator
+//                                              and trivially destructible Key/Value
 //
 // Deep copy is supported (O(n) copy constructor / copy assignment).
 // Move is O(1).
+//
+// Augmentation (opt-in, see augment.h): every node caches Augment's monoid
+// folded over its subtree, recomputed alongside the height in rotations.
+// The default NoAugment stores nothing. With a counting augmentation
+// (SubtreeSize, Counted<M>) select / rank / count_in_range run in O(log n);
+// with any augmentation aggregate_range folds a key range in O(log n).
+// Aggregates are refreshed by insert / erase only: writing a value through
+// find() or operator[] bypasses augmentations that read the value.
+//
+// Node storage comes from NodeAllocator (see node_allocator.h). The default
+// HeapAllocator does one new/delete per node; ArenaAllocator carves nodes
+// from large blocks, reuses erased nodes via a free list and releases all
+// blocks at once on clear() / destruction.
 
 template <typename Key,
           typename Value,
-          typename Compare = std::less<Key>>
+          typename Compare = std::less<Key>,
+          typename Augment = NoAugment,
+          template <typename> class NodeAllocator = HeapAllocator>
 class OrderedMap {
 public:
+    using augment_type = typename Augment::value_type;
+
     OrderedMap()  = default;
-    ~OrderedMap() { delete_tree(root_); }
+    ~OrderedMap() { clear(); }
 
-    OrderedMap(const OrderedMap& other)
-        : root_(copy_tree(other.root_)), size_(other.size_) {}
+    // alloc_ is declared after root_, so the copy runs in the body.
+    OrderedMap(const OrderedMap& other) : size_(other.size_) { root_ = copy_tree(other.root_); }
 
     OrderedMap& operator=(OrderedMap other) noexcept {
         std::swap(root_,  other.root_);
         std::swap(size_,  other.size_);
         std::swap(cmp_,   other.cmp_);
+        std::swap(alloc_, other.alloc_);
         return *this;
     }
 
     OrderedMap(OrderedMap&& other) noexcept
-        : root_(other.root_), size_(other.size_), cmp_(std::move(other.cmp_)) {
+        : root_(other.root_), size_(other.size_), cmp_(std::move(other.cmp_)),
+          alloc_(std::move(other.alloc_)) {
         other.root_ = nullptr;
         other.size_ = 0;
     }
@@ -72,21 +97,49 @@ public:
     bool        empty() const noexcept { return size_ == 0; }
     void        clear();
 
+    // ── order statistics (counting augmentations only) ──────────────────────
+
+    /// Pointer to the k-th smallest key (0-based), nullptr if k >= size(). O(log n).
+    const Key* select(std::size_t k) const
+        requires CountingAugment<Augment>;
+
+    /// Number of keys strictly less than key. O(log n).
+    std::size_t rank(const Key& key) const
+        requires CountingAugment<Augment>;
+
+    /// Number of keys in the half-open range [lo, hi). O(log n).
+    std::size_t count_in_range(const Key& lo, const Key& hi) const
+        requires CountingAugment<Augment>;
+
+    // ── range aggregates ────────────────────────────────────────────────────
+
+    /// Fold of Augment over all entries. O(1).
+    augment_type aggregate() const { return agg(root_); }
+
+    /// Fold of Augment over entries with keys in [lo, hi), in key order. O(log n).
+    augment_type aggregate_range(const Key& lo, const Key& hi) const;
+
 private:
+    static constexpr bool kAugmented = !std::is_same_v<Augment, NoAugment>;
+
     struct Node {
         Key   key;
         Value value;
         Node* left   = nullptr;
         Node* right  = nullptr;
         int   height = 1;
+        [[no_unique_address]] augment_type sub{};
 
         Node(Key k, Value v)
-            : key(std::move(k)), value(std::move(v)) {}
+            : key(std::move(k)), value(std::move(v)) {
+            if constexpr (kAugmented) sub = Augment::lift(key, value);
+        }
     };
 
     Node*       root_  = nullptr;
     std::size_t size_  = 0;
     Compare     cmp_{};
+    [[no_unique_address]] NodeAllocator<Node> alloc_;
 
     // ── tree utilities ──────────────────────────────────────────────────────
 
@@ -94,16 +147,31 @@ private:
     static int bf(const Node* n)     noexcept {
         return n ? height(n->right) - height(n->left) : 0;
     }
-    static void update_height(Node* n) noexcept {
-        if (n) n->height = 1 + std::max(height(n->left), height(n->right));
+    static augment_type agg(const Node* n) noexcept {
+        return n ? n->sub : Augment::identity();
+    }
+    static std::size_t count(const Node* n) noexcept
+        requires CountingAugment<Augment>
+    {
+        return n ? Augment::count(n->sub) : 0;
+    }
+
+    // Recompute the cached height and subtree aggregate from the children.
+    static void update(Node* n) noexcept {
+        if (!n) return;
+        n->height = 1 + std::max(height(n->left), height(n->right));
+        if constexpr (kAugmented) {
+            augment_type self = Augment::lift(n->key, n->value);
+            n->sub = Augment::combine(Augment::combine(agg(n->left), self), agg(n->right));
+        }
     }
 
     static Node* rotate_right(Node* y) noexcept {
         Node* x  = y->left;
         y->left  = x->right;
         x->right = y;
-        update_height(y);
-        update_height(x);
+        update(y);
+        update(x);
         return x;
     }
 
@@ -111,13 +179,13 @@ private:
         Node* y  = x->right;
         x->right = y->left;
         y->left  = x;
-        update_height(x);
-        update_height(y);
+        update(x);
+        update(y);
         return y;
     }
 
     static Node* balance(Node* n) noexcept {
-        update_height(n);
+        update(n);
         int b = bf(n);
         if (b > 1) {  // right-heavy
             if (bf(n->right) < 0)           // right-left
@@ -141,20 +209,45 @@ private:
         return n;
     }
 
-    static Node* copy_tree(const Node* n) {
+    template <typename... Args> Node* make_node(Args&&... args) {
+        Node* p = alloc_.allocate();
+        try {
+            return ::new (static_cast<void*>(p)) Node(std::forward<Args>(args)...);
+        } catch (...) {
+            alloc_.deallocate(p);
+            throw;
+        }
+    }
+
+    void destroy_node(Node* n) noexcept {
+        n->~Node();
+        alloc_.deallocate(n);
+    }
+
+    // Preorder copy: with ArenaAllocator a subtree's nodes land next to each other.
+    Node* copy_tree(const Node* n) {
         if (!n) return nullptr;
-        Node* c   = new Node(n->key, n->value);
+        Node* c   = make_node(n->key, n->value);
         c->height = n->height;
+        c->sub    = n->sub;
         c->left   = copy_tree(n->left);
         c->right  = copy_tree(n->right);
         return c;
     }
 
-    static void delete_tree(Node* n) noexcept {
+    void delete_tree(Node* n) noexcept {
         if (!n) return;
         delete_tree(n->left);
         delete_tree(n->right);
-        delete n;
+        destroy_node(n);
+    }
+
+    // Run destructors only; storage is reclaimed by alloc_.release().
+    static void destroy_tree(Node* n) noexcept {
+        if (!n) return;
+        destroy_tree(n->left);
+        destroy_tree(n->right);
+        n->~Node();
     }
 
     // ── recursive operations ────────────────────────────────────────────────
@@ -166,12 +259,12 @@ private:
 
 // ──────────────────────────── method definitions ────────────────────────────
 
-template <typename K, typename V, typename C>
-typename OrderedMap<K, V, C>::Node*
-OrderedMap<K, V, C>::insert_impl(Node* n, K key, V value, bool& size_changed) {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+typename OrderedMap<K, V, C, A, Alloc>::Node*
+OrderedMap<K, V, C, A, Alloc>::insert_impl(Node* n, K key, V value, bool& size_changed) {
     if (!n) {
         size_changed = true;
-        return new Node(std::move(key), std::move(value));
+        return make_node(std::move(key), std::move(value));
     }
     if (cmp_(key, n->key)) {
         n->left  = insert_impl(n->left,  std::move(key), std::move(value), size_changed);
@@ -183,9 +276,9 @@ OrderedMap<K, V, C>::insert_impl(Node* n, K key, V value, bool& size_changed) {
     return balance(n);
 }
 
-template <typename K, typename V, typename C>
-typename OrderedMap<K, V, C>::Node*
-OrderedMap<K, V, C>::erase_impl(Node* n, const K& key, bool& erased) {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+typename OrderedMap<K, V, C, A, Alloc>::Node*
+OrderedMap<K, V, C, A, Alloc>::erase_impl(Node* n, const K& key, bool& erased) {
     if (!n) return nullptr;
 
     if (cmp_(key, n->key)) {
@@ -196,7 +289,7 @@ OrderedMap<K, V, C>::erase_impl(Node* n, const K& key, bool& erased) {
         erased = true;
         if (!n->left || !n->right) {
             Node* child = n->left ? n->left : n->right;
-            delete n;
+            destroy_node(n);
             return child; // child may be nullptr (leaf case)
         }
         // Two children: replace with inorder successor (min of right subtree).
@@ -211,9 +304,9 @@ OrderedMap<K, V, C>::erase_impl(Node* n, const K& key, bool& erased) {
     return balance(n);
 }
 
-template <typename K, typename V, typename C>
-typename OrderedMap<K, V, C>::Node*
-OrderedMap<K, V, C>::find_impl(Node* n, const K& key) const noexcept {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+typename OrderedMap<K, V, C, A, Alloc>::Node*
+OrderedMap<K, V, C, A, Alloc>::find_impl(Node* n, const K& key) const noexcept {
     while (n) {
         if      (cmp_(key, n->key)) n = n->left;
         else if (cmp_(n->key, key)) n = n->right;
@@ -222,61 +315,141 @@ OrderedMap<K, V, C>::find_impl(Node* n, const K& key) const noexcept {
     return nullptr;
 }
 
-template <typename K, typename V, typename C>
-void OrderedMap<K, V, C>::insert(K key, V value) {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+void OrderedMap<K, V, C, A, Alloc>::insert(K key, V value) {
     bool changed = false;
     root_ = insert_impl(root_, std::move(key), std::move(value), changed);
     if (changed) ++size_;
 }
 
-template <typename K, typename V, typename C>
-bool OrderedMap<K, V, C>::erase(const K& key) {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+bool OrderedMap<K, V, C, A, Alloc>::erase(const K& key) {
     bool erased = false;
     root_ = erase_impl(root_, key, erased);
     if (erased) --size_;
     return erased;
 }
 
-template <typename K, typename V, typename C>
-V* OrderedMap<K, V, C>::find(const K& key) {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+V* OrderedMap<K, V, C, A, Alloc>::find(const K& key) {
     Node* n = find_impl(root_, key);
     return n ? &n->value : nullptr;
 }
 
-template <typename K, typename V, typename C>
-const V* OrderedMap<K, V, C>::find(const K& key) const {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+const V* OrderedMap<K, V, C, A, Alloc>::find(const K& key) const {
     const Node* n = find_impl(root_, key);
     return n ? &n->value : nullptr;
 }
 
-template <typename K, typename V, typename C>
-bool OrderedMap<K, V, C>::contains(const K& key) const {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+bool OrderedMap<K, V, C, A, Alloc>::contains(const K& key) const {
     return find_impl(root_, key) != nullptr;
 }
 
-template <typename K, typename V, typename C>
-V& OrderedMap<K, V, C>::operator[](const K& key) {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+V& OrderedMap<K, V, C, A, Alloc>::operator[](const K& key) {
     if (!contains(key)) insert(key, V{});
     return *find(key);
 }
 
-template <typename K, typename V, typename C>
-const K* OrderedMap<K, V, C>::min_key() const {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+const K* OrderedMap<K, V, C, A, Alloc>::min_key() const {
     Node* n = min_node(root_);
     return n ? &n->key : nullptr;
 }
 
-template <typename K, typename V, typename C>
-const K* OrderedMap<K, V, C>::max_key() const {
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+const K* OrderedMap<K, V, C, A, Alloc>::max_key() const {
     Node* n = max_node(root_);
     return n ? &n->key : nullptr;
 }
 
-template <typename K, typename V, typename C>
-void OrderedMap<K, V, C>::clear() {
-    delete_tree(root_);
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+void OrderedMap<K, V, C, A, Alloc>::clear() {
+    if constexpr (Alloc<Node>::kBulkRelease) {
+        if constexpr (!std::is_trivially_destructible_v<Node>) destroy_tree(root_);
+        alloc_.release();
+    } else {
+        delete_tree(root_);
+    }
     root_  = nullptr;
     size_  = 0;
 }
 
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+const K* OrderedMap<K, V, C, A, Alloc>::select(std::size_t k) const
+    requires CountingAugment<A>
+{
+    const Node* n = root_;
+    while (n) {
+        std::size_t l = count(n->left);
+        if      (k < l)  n = n->left;
+        else if (k == l) return &n->key;
+        else { k -= l + 1; n = n->right; }
+    }
+    return nullptr;
+}
+
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+std::size_t OrderedMap<K, V, C, A, Alloc>::rank(const K& key) const
+    requires CountingAugment<A>
+{
+    std::size_t r = 0;
+    const Node* n = root_;
+    while (n) {
+        if (cmp_(n->key, key)) {
+            r += count(n->left) + 1;
+            n  = n->right;
+        } else {
+            n = n->left;
+        }
+    }
+    return r;
+}
+
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+std::size_t OrderedMap<K, V, C, A, Alloc>::count_in_range(const K& lo, const K& hi) const
+    requires CountingAugment<A>
+{
+    if (!cmp_(lo, hi)) return 0;
+    return rank(hi) - rank(lo);
+}
+
+template <typename K, typename V, typename C, typename A, template <typename> class Alloc>
+typename OrderedMap<K, V, C, A, Alloc>::augment_type
+OrderedMap<K, V, C, A, Alloc>::aggregate_range(const K& lo, const K& hi) const {
+    // Descend to the first node whose key lies in [lo, hi); below it the range
+    // splits into a suffix of the left subtree and a prefix of the right one.
+    const Node* n = root_;
+    while (n) {
+        if      (cmp_(n->key, lo))  n = n->right;
+        else if (!cmp_(n->key, hi)) n = n->left;
+        else                        break;
+    }
+    if (!n) return A::identity();
+
+    // Keys >= lo in the left subtree. Pieces found deeper precede earlier ones.
+    augment_type left = A::identity();
+    for (const Node* c = n->left; c;) {
+        if (cmp_(c->key, lo)) {
+            c = c->right;
+        } else {
+            left = A::combine(A::combine(A::lift(c->key, c->value), agg(c->right)), left);
+            c    = c->left;
+        }
+    }
+    // Keys < hi in the right subtree. Pieces found deeper follow earlier ones.
+    augment_type right = A::identity();
+    for (const Node* c = n->right; c;) {
+        if (cmp_(c->key, hi)) {
+            right = A::combine(right, A::combine(agg(c->left), A::lift(c->key, c->value)));
+            c     = c->right;
+        } else {
+            c = c->left;
+        }
+    }
+    return A::combine(A::combine(left, A::lift(n->key, n->value)), right);
+}
+
 } // namespace ds::ordered_map
@@ -0,0 +1,295 @@
+#pragma once
+
+#include <algorithm>
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+
+namespace ds::ordered_map {
+
+// Persistent ordered map: an AVL tree with structural sharing.
+//
+// Copying the map (or calling snapshot()) is O(1): the copy shares the
+// whole tree. Nodes are reference counted; a mutation copies only the
+// nodes on its root-to-leaf path that are still shared with some other
+// version (path copying) and updates nodes it owns exclusively in place,
+// so a map with no outstanding snapshots mutates at close to OrderedMap
+// speed.
+//
+// Thread safety: a given map object must be used by one thread at a time,
+// but distinct versions may be read, mutated and destroyed concurrently
+// from different threads. Snapshot on the writer thread, then hand the
+// snapshot to readers; readers never block the writer and never see its
+// later changes.
+//
+// Complexity:
+//   insert, erase:                     O(log n) time, O(log n) new nodes if shared
+//   find, contains, min_key, max_key:  O(log n)
+//   snapshot / copy, size, empty:      O(1)
+//
+// Key and Value must be copy-constructible (shared nodes are cloned).
+
+template <typename Key, typename Value, typename Compare = std::less<Key>>
+class PersistentOrderedMap {
+public:
+    PersistentOrderedMap() = default;
+
+    /// O(1) point-in-time copy that shares every node with *this.
+    PersistentOrderedMap snapshot() const { return *this; }
+
+    /// Insert or overwrite value for key. O(log n).
+    void insert(Key key, Value value);
+
+    /// Remove key. Returns true if key was found. O(log n).
+    bool erase(const Key& key);
+
+    /// Pointer to value, nullptr if absent. Invalidated by the next mutation
+    /// of this map (not by mutations of other versions). O(log n).
+    const Value* find(const Key& key) const;
+
+    /// True if key is present. O(log n).
+    bool contains(const Key& key) const { return find(key) != nullptr; }
+
+    /// Pointer to the minimum / maximum key, nullptr if empty. O(log n).
+    const Key* min_key() const;
+    const Key* max_key() const;
+
+    std::size_t size() const noexcept { return size_; }
+    bool empty() const noexcept { return size_ == 0; }
+    void clear() noexcept {
+        root_ = NodeRef{};
+        size_ = 0;
+    }
+
+private:
+    struct Node;
+
+    // Intrusive reference-counted pointer to a Node.
+    class NodeRef {
+    public:
+        NodeRef() = default;
+        explicit NodeRef(Node* p) noexcept : p_(p) {}
+        NodeRef(const NodeRef& o) noexcept : p_(o.p_) { retain(); }
+        NodeRef(NodeRef&& o) noexcept : p_(std::exchange(o.p_, nullptr)) {}
+        NodeRef& operator=(NodeRef o) noexcept {
+            std::swap(p_, o.p_);
+            return *this;
+        }
+        ~NodeRef() { release(); }
+
+        Node* get() const noexcept { return p_; }
+        Node* operator->() const noexcept { return p_; }
+        explicit operator bool() const noexcept { return p_ != nullptr; }
+
+        // True when no other version can observe the node. The acquire pairs
+        // with the release in release(), so a version that let go of the node
+        // finished reading it before we start writing.
+        bool unique() const noexcept { return p_->refs.load(std::memory_order_acquire) == 1; }
+
+    private:
+        Node* p_ = nullptr;
+
+        void retain() const noexcept {
+            if (p_) p_->refs.fetch_add(1, std::memory_order_relaxed);
+        }
+        void release() noexcept {
+            if (p_ && p_->refs.fetch_sub(1, std::memory_order_acq_rel) == 1) delete p_;
+        }
+    };
+
+    struct Node {
+        Key     key;
+        Value   value;
+        NodeRef left;
+        NodeRef right;
+        int     height = 1;
+        std::atomic<std::uint32_t> refs{1};
+
+        Node(Key k, Value v) : key(std::move(k)), value(std::move(v)) {}
+        Node(const Node& o)
+            : key(o.key), value(o.value), left(o.left), right(o.right), height(o.height) {}
+    };
+
+    NodeRef     root_;
+    std::size_t size_ = 0;
+    Compare     cmp_{};
+
+    // ── tree utilities ──────────────────────────────────────────────────────
+
+    static int height(const NodeRef& n) noexcept { return n ? n->height : 0; }
+    static int bf(const NodeRef& n) noexcept {
+        return n ? height(n->right) - height(n->left) : 0;
+    }
+    static void update(const NodeRef& n) noexcept {
+        n->height = 1 + std::max(height(n->left), height(n->right));
+    }
+
+    // Make n safe to modify: keep it if unshared, otherwise replace it with
+    // a private clone (the clone shares n's children).
+    static void make_unique(NodeRef& n) {
+        if (!n.unique()) n = NodeRef(new Node(*n.get()));
+    }
+
+    // Rotations take a node that is already unique and unshare the child
+    // they pull up.
+    static NodeRef rotate_right(NodeRef y) {
+        NodeRef x = std::move(y->left);
+        make_unique(x);
+        y->left = std::move(x->right);
+        update(y);
+        x->right = std::move(y);
+        update(x);
+        return x;
+    }
+
+    static NodeRef rotate_left(NodeRef x) {
+        NodeRef y = std::move(x->right);
+        make_unique(y);
+        x->right = std::move(y->left);
+        update(x);
+        y->left = std::move(x);
+        update(y);
+        return y;
+    }
+
+    static NodeRef balance(NodeRef n) {
+        update(n);
+        int b = bf(n);
+        if (b > 1) { // right-heavy
+            if (bf(n->right) < 0) { // right-left
+                make_unique(n->right);
+                n->right = rotate_right(std::move(n->right));
+            }
+            return rotate_left(std::move(n));
+        }
+        if (b < -1) { // left-heavy
+            if (bf(n->left) > 0) { // left-right
+                make_unique(n->left);
+                n->left = rotate_left(std::move(n->left));
+            }
+            return rotate_right(std::move(n));
+        }
+        return n;
+    }
+
+    // ── recursive operations (each consumes its argument) ───────────────────
+
+    NodeRef insert_impl(NodeRef n, Key& key, Value& value, bool& added);
+    NodeRef erase_impl(NodeRef n, const Key& key);
+    static NodeRef pop_min(NodeRef n, NodeRef& min_out);
+    const Node* find_impl(const Key& key) const noexcept;
+};
+
+// ──────────────────────────── method definitions ────────────────────────────
+
+template <typename K, typename V, typename C>
+typename PersistentOrderedMap<K, V, C>::NodeRef
+PersistentOrderedMap<K, V, C>::insert_impl(NodeRef n, K& key, V& value, bool& added) {
+    if (!n) {
+        added = true;
+        return NodeRef(new Node(std::move(key), std::move(value)));
+    }
+    make_unique(n);
+    if (cmp_(key, n->key)) {
+        n->left = insert_impl(std::move(n->left), key, value, added);
+    } else if (cmp_(n->key, key)) {
+        n->right = insert_impl(std::move(n->right), key, value, added);
+    } else {
+        n->value = std::move(value); // update
+        return n;
+    }
+    return balance(std::move(n));
+}
+
+template <typename K, typename V, typename C>
+typename PersistentOrderedMap<K, V, C>::NodeRef
+PersistentOrderedMap<K, V, C>::pop_min(NodeRef n, NodeRef& min_out) {
+    if (!n->left) {
+        NodeRef right = n->right; // n may be shared: copy, never move out of it
+        min_out       = std::move(n);
+        return right;
+    }
+    make_unique(n);
+    n->left = pop_min(std::move(n->left), min_out);
+    return balance(std::move(n));
+}
+
+template <typename K, typename V, typename C>
+typename PersistentOrderedMap<K, V, C>::NodeRef
+PersistentOrderedMap<K, V, C>::erase_impl(NodeRef n, const K& key) {
+    // Caller guarantees key is present, so every node on the path changes.
+    if (cmp_(key, n->key)) {
+        make_unique(n);
+        n->left = erase_impl(std::move(n->left), key);
+    } else if (cmp_(n->key, key)) {
+        make_unique(n);
+        n->right = erase_impl(std::move(n->right), key);
+    } else {
+        if (!n->left) return NodeRef(n->right);
+        if (!n->right) return NodeRef(n->left);
+        // Two children: replace with inorder successor (min of right subtree).
+        make_unique(n);
+        NodeRef succ;
+        n->right = pop_min(std::move(n->right), succ);
+        if (succ.unique()) {
+            n->key   = std::move(succ->key);
+            n->value = std::move(succ->value);
+        } else {
+            n->key   = succ->key;
+            n->value = succ->value;
+        }
+    }
+    return balance(std::move(n));
+}
+
+template <typename K, typename V, typename C>
+const typename PersistentOrderedMap<K, V, C>::Node*
+PersistentOrderedMap<K, V, C>::find_impl(const K& key) const noexcept {
+    const Node* n = root_.get();
+    while (n) {
+        if      (cmp_(key, n->key)) n = n->left.get();
+        else if (cmp_(n->key, key)) n = n->right.get();
+        else                        return n;
+    }
+    return nullptr;
+}
+
+template <typename K, typename V, typename C>
+void PersistentOrderedMap<K, V, C>::insert(K key, V value) {
+    bool added = false;
+    root_ = insert_impl(std::move(root_), key, value, added);
+    if (added) ++size_;
+}
+
+template <typename K, typename V, typename C>
+bool PersistentOrderedMap<K, V, C>::erase(const K& key) {
+    // Look first: a miss must not copy the path of a shared tree.
+    if (!find_impl(key)) return false;
+    root_ = erase_impl(std::move(root_), key);
+    --size_;
+    return true;
+}
+
+template <typename K, typename V, typename C>
+const V* PersistentOrderedMap<K, V, C>::find(const K& key) const {
+    const Node* n = find_impl(key);
+    return n ? &n->value : nullptr;
+}
+
+template <typename K, typename V, typename C>
+const K* PersistentOrderedMap<K, V, C>::min_key() const {
+    const Node* n = root_.get();
+    while (n && n->left) n = n->left.get();
+    return n ? &n->key : nullptr;
+}
+
+template <typename K, typename V, typename C>
+const K* PersistentOrderedMap<K, V, C>::max_key() const {
+    const Node* n = root_.get();
+    while (n && n->right) n = n->right.get();
+    return n ? &n->key : nullptr;
+}
+
+} // namespace ds::ordered_map
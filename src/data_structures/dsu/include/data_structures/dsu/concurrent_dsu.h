@@ -0,0 +1,68 @@
+#pragma once
+
+#include <atomic>
+#include <cstdint>
+#include <vector>
+
+namespace ds::dsu {
+
+// Lock-free Disjoint Set Union for many threads (Jayanti–Tarjan style).
+//
+// Every parent link is a std::atomic<int>; no operation ever takes a lock
+// or waits for another thread:
+//
+// - find(v) walks to the root with path halving: each step tries one CAS
+//   that points the current node at its grandparent and moves on whether
+//   or not the CAS won. A lost CAS only means another thread changed the
+//   link first, so find never retries and never blocks.
+// - unite(a, b) finds both roots and links one under the other with a CAS
+//   that only succeeds while the child is still a root. If another thread
+//   linked it first, the operation finds the new roots and tries again.
+//
+// Linking is randomized: every element has a fixed pseudo-random priority
+// (a hash of its index) and the lower-priority root goes under the higher
+// one. Priorities strictly increase along every path, so links can never
+// form a cycle. Trees have expected O(log n) height without any size or
+// rank field that threads would have to keep consistent.
+//
+// Same API and defensive behavior as DisjointSetUnion, except
+// component_size, which would need such a field. size() and assign() are
+// not thread-safe; every other method is.
+class ConcurrentDisjointSetUnion {
+  public:
+    ConcurrentDisjointSetUnion() = default;
+    explicit ConcurrentDisjointSetUnion(int n);
+
+    // Current number of elements (0..n-1).
+    int size() const;
+
+    // Reset the structure to contain n singleton sets. Not thread-safe.
+    void assign(int n);
+
+    // Representative of the set containing v, or -1 if v is out of range.
+    // Under concurrent unites the answer may be stale by the time it is
+    // returned, but it was the root of v's set at some instant during the call.
+    int find(int v);
+
+    // Whether a and b are in the same set. Returns false if a/b invalid.
+    // Linearizable: loops until it sees two equal roots, or a root of a
+    // that is still a root after b's root was found.
+    bool same(int a, int b);
+
+    // Merge sets containing a and b.
+    // Returns true if this call performed the merge; false if already same
+    // set or invalid inputs.
+    bool unite(int a, int b);
+
+    // Number of connected components currently tracked.
+    int components() const;
+
+  private:
+    int n_ = 0;
+    std::atomic<int> components_{0};
+    std::vector<std::atomic<int>> parent_;
+
+    bool is_valid(int v) const;
+};
+
+} // namespace ds::dsu
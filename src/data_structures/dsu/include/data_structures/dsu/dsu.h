@@ -1,6 +1,8 @@
 #pragma once
 
 #include <cstdint>
+#include <span>
+#include <utility>
 #include <vector>
 
 namespace ds::dsu {
@@ -8,7 +10,11 @@ namespace ds::dsu {
 // Disjoint Set Union (Union-Find) data structure.
 //
 // Supports merging sets and querying representatives in almost-constant amortized time
-// using union by size and path compression.
+// using union by size and path compression (path halving).
+//
+// Parent and size share one 32-bit slot per element: link_[v] is v's parent, or minus the
+// component size if v is a root. Half the memory of separate parent/size arrays, and a
+// root's size arrives with the load that identifies it as a root.
 //
 // API is intentionally defensive and consistent with other data structures in this repo:
 // operations on invalid vertices are treated as no-ops / safe defaults.
@@ -34,6 +40,13 @@ class DisjointSetUnion {
     // Returns true if a merge happened; false if already same set or invalid inputs.
     bool unite(int a, int b);
 
+    // unite() every edge of the batch, in order; returns the number of merges. Edges with
+    // invalid endpoints are skipped. Same result as uniting edge by edge, but faster once
+    // the structure outgrows the cache: the link_ slots of edges a few positions ahead
+    // (and then their parents) are prefetched, so the cache misses of consecutive finds
+    // overlap instead of being paid one after another.
+    int unite_batch(std::span<const std::pair<int, int>> edges);
+
     // Size of the component containing v. Returns 0 if v is out of range.
     int component_size(int v);
 
@@ -43,10 +56,10 @@ class DisjointSetUnion {
   private:
     int n_ = 0;
     int components_ = 0;
-    std::vector<int> parent_;
-    std::vector<int> size_;
+    std::vector<int32_t> link_; // parent, or -size for roots
 
     bool is_valid(int v) const;
+    bool unite_roots(int ra, int rb);
 };
 
 } // namespace ds::dsu
@@ -0,0 +1,69 @@
+#pragma once
+
+#include <cstdint>
+#include <unordered_map>
+#include <vector>
+
+namespace ds::dsu {
+
+// Offline dynamic connectivity: edge insertions, edge deletions and
+// connectivity queries, recorded in order and answered together by solve().
+//
+// Every edge copy is alive during one interval of the query timeline, from
+// its insertion to its deletion (or the end). The intervals are stored in a
+// segment tree over the queries: an interval covering a whole node's range
+// is attached to that node, so each edge lands in O(log Q) nodes. A DFS
+// over the tree unites a node's edges on entry into a
+// RollbackDisjointSetUnion and rolls them back on exit, so at leaf q the DSU
+// holds exactly the edges alive at query q.
+//
+// The graph is undirected and may have parallel edges: remove_edge(a, b)
+// deletes the most recent live copy of {a, b} and is a no-op if there is
+// none. Operations with out-of-range vertices are ignored, and their
+// queries answer 0.
+//
+// Complexity: O(m log Q log n + Q log n) for m edge copies and Q queries.
+// Memory O(m log Q + n).
+class OfflineDynamicConnectivity {
+  public:
+    OfflineDynamicConnectivity() = default;
+    explicit OfflineDynamicConnectivity(int n);
+
+    int size() const;
+
+    void add_edge(int a, int b);
+    void remove_edge(int a, int b);
+
+    // Record a query; returns its index into solve()'s result.
+    // connected(a, b): 1 if a and b are connected at this point, else 0.
+    int query_connected(int a, int b);
+    // components(): number of connected components at this point.
+    int query_components();
+
+    int queries() const;
+
+    // Answers of all recorded queries, in recording order. Can be called
+    // again after more operations are recorded.
+    std::vector<int> solve() const;
+
+  private:
+    struct Query {
+        int a, b;
+        bool components; // query_components(); a, b unused
+    };
+    struct Interval {
+        int a, b;
+        int from, to; // alive for queries [from, to)
+    };
+
+    int n_ = 0;
+    std::vector<Query> queries_;
+    std::vector<Interval> closed_; // copies already deleted
+    // Edge {a, b} with a <= b, keyed as a << 32 | b -> start of each live
+    // copy, oldest first.
+    std::unordered_map<uint64_t, std::vector<int>> live_;
+
+    bool is_valid(int v) const;
+};
+
+} // namespace ds::dsu
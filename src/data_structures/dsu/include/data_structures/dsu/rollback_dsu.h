@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstdint>
+#include <vector>
+
+namespace ds::dsu {
+
+// Disjoint Set Union whose unions can be undone.
+//
+// Union by rank without path compression: every successful unite changes
+// exactly one parent link (plus one size and possibly one rank), which is
+// pushed to a history stack. snapshot() returns the current history length
+// and rollback(to) undoes unions, most recent first, until the history is
+// back to that length. Without compression find is O(log n) worst case
+// rather than amortized O(α(n)), but it never writes, so rollback restores
+// the exact earlier state.
+//
+// Same defensive API as DisjointSetUnionRank, plus snapshot / rollback.
+class RollbackDisjointSetUnion {
+  public:
+    RollbackDisjointSetUnion() = default;
+    explicit RollbackDisjointSetUnion(int n);
+
+    int size() const;
+
+    // Reset to n singleton sets and clear the history.
+    void assign(int n);
+
+    // Representative of v's set; -1 if v is out of range. O(log n).
+    int find(int v) const;
+    bool same(int a, int b) const;
+
+    // Merge the sets of a and b. Returns true (and records the union) if a
+    // merge happened; false if already same set or invalid inputs.
+    bool unite(int a, int b);
+
+    int component_size(int v) const;
+    int components() const;
+
+    // Current history length: pass it to rollback() to return to this state.
+    int snapshot() const;
+
+    // Undo the most recent unions until snapshot() == to. No-op if to is
+    // not below the current history length; to < 0 undoes everything.
+    void rollback(int to);
+
+  private:
+    struct Change {
+        int child;      // root attached by the union
+        bool rank_bump; // whether the new root's rank was incremented
+    };
+
+    int n_ = 0;
+    int components_ = 0;
+
+    std::vector<int> parent_;
+    std::vector<int> rank_; // meaningful only for roots
+    std::vector<int> size_; // component size stored at roots
+    std::vector<Change> history_;
+
+    bool is_valid(int v) const;
+};
+
+} // namespace ds::dsu
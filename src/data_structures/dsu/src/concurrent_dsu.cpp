@@ -0,0 +1,120 @@
+#include <algorithm>
+#include <data_structures/dsu/concurrent_dsu.h>
+
+namespace ds::dsu {
+
+namespace {
+// Link priority of element v: a fixed mix of its index (the 32-bit
+// finalizer of MurmurHash3), ties broken by the index itself.
+uint32_t priority(int v) {
+    auto h = static_cast<uint32_t>(v);
+    h ^= h >> 16;
+    h *= 0x85EBCA6Bu;
+    h ^= h >> 13;
+    h *= 0xC2B2AE35u;
+    h ^= h >> 16;
+    return h;
+}
+
+bool lower_priority(int a, int b) {
+    const uint32_t pa = priority(a), pb = priority(b);
+    return pa != pb ? pa < pb : a < b;
+}
+} // namespace
+
+ConcurrentDisjointSetUnion::ConcurrentDisjointSetUnion(int n) {
+    assign(n);
+}
+
+int ConcurrentDisjointSetUnion::size() const {
+    return n_;
+}
+
+bool ConcurrentDisjointSetUnion::is_valid(int v) const {
+    return 0 <= v && v < n_;
+}
+
+void ConcurrentDisjointSetUnion::assign(int n) {
+    n_ = std::max(0, n);
+    components_.store(n_, std::memory_order_relaxed);
+
+    parent_ = std::vector<std::atomic<int>>(static_cast<size_t>(n_));
+    for (int i = 0; i < n_; ++i) {
+        parent_[static_cast<size_t>(i)].store(i, std::memory_order_relaxed);
+    }
+}
+
+int ConcurrentDisjointSetUnion::find(int v) {
+    if (!is_valid(v)) {
+        return -1;
+    }
+
+    // Path halving: point v at its grandparent, then continue from there.
+    while (true) {
+        int p = parent_[static_cast<size_t>(v)].load(std::memory_order_acquire);
+        if (p == v) {
+            return v;
+        }
+        const int gp = parent_[static_cast<size_t>(p)].load(std::memory_order_acquire);
+        if (gp == p) {
+            return p;
+        }
+        // One try only: if it fails, another thread already moved the link up.
+        parent_[static_cast<size_t>(v)].compare_exchange_weak(p, gp, std::memory_order_acq_rel,
+                                                              std::memory_order_acquire);
+        v = gp;
+    }
+}
+
+bool ConcurrentDisjointSetUnion::same(int a, int b) {
+    if (!is_valid(a) || !is_valid(b)) {
+        return false;
+    }
+
+    while (true) {
+        const int ra = find(a);
+        const int rb = find(b);
+        if (ra == rb) {
+            return true;
+        }
+        // ra still being a root means the sets were different when rb was found.
+        if (parent_[static_cast<size_t>(ra)].load(std::memory_order_acquire) == ra) {
+            return false;
+        }
+    }
+}
+
+bool ConcurrentDisjointSetUnion::unite(int a, int b) {
+    if (!is_valid(a) || !is_valid(b)) {
+        return false;
+    }
+
+    while (true) {
+        // Retries restart from the last roots seen: same sets, shorter paths.
+        a = find(a);
+        b = find(b);
+        if (a == b) {
+            return false;
+        }
+        int ra = a, rb = b;
+
+        // Randomized linking: the lower-priority root goes under the other.
+        if (!lower_priority(ra, rb)) {
+            std::swap(ra, rb);
+        }
+
+        // Succeeds only while ra is still a root; otherwise retry from the new roots.
+        int expected = ra;
+        if (parent_[static_cast<size_t>(ra)].compare_exchange_strong(
+                expected, rb, std::memory_order_acq_rel, std::memory_order_acquire)) {
+            components_.fetch_sub(1, std::memory_order_relaxed);
+            return true;
+        }
+    }
+}
+
+int ConcurrentDisjointSetUnion::components() const {
+    return components_.load(std::memory_order_relaxed);
+}
+
+} // namespace ds::dsu
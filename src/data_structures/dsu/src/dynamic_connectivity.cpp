@@ -0,0 +1,131 @@
+#include <algorithm>
+#include <data_structures/dsu/dynamic_connectivity.h>
+#include <data_structures/dsu/rollback_dsu.h>
+#include <utility>
+
+namespace ds::dsu {
+
+namespace {
+uint64_t edge_key(int a, int b) {
+    if (a > b) {
+        std::swap(a, b);
+    }
+    return (static_cast<uint64_t>(a) << 32) | static_cast<uint32_t>(b);
+}
+
+struct Solver {
+    int q = 0;
+    std::vector<std::vector<std::pair<int, int>>> node_edges; // edges per tree node
+    RollbackDisjointSetUnion dsu;
+
+    Solver(int n, int queries) : q(queries), node_edges(static_cast<size_t>(4 * queries)), dsu(n) {}
+
+    // Attach edge {a, b} to the nodes covering queries [from, to).
+    void insert(int node, int lo, int hi, int from, int to, int a, int b) {
+        if (to <= lo || hi <= from) {
+            return;
+        }
+        if (from <= lo && hi <= to) {
+            node_edges[static_cast<size_t>(node)].emplace_back(a, b);
+            return;
+        }
+        const int mid = lo + (hi - lo) / 2;
+        insert(2 * node, lo, mid, from, to, a, b);
+        insert(2 * node + 1, mid, hi, from, to, a, b);
+    }
+
+    template <typename Leaf> void dfs(int node, int lo, int hi, const Leaf& leaf) {
+        const int snap = dsu.snapshot();
+        for (auto [a, b] : node_edges[static_cast<size_t>(node)]) {
+            dsu.unite(a, b);
+        }
+        if (hi - lo == 1) {
+            leaf(lo, dsu);
+        } else {
+            const int mid = lo + (hi - lo) / 2;
+            dfs(2 * node, lo, mid, leaf);
+            dfs(2 * node + 1, mid, hi, leaf);
+        }
+        dsu.rollback(snap);
+    }
+};
+} // namespace
+
+OfflineDynamicConnectivity::OfflineDynamicConnectivity(int n) : n_(std::max(0, n)) {}
+
+int OfflineDynamicConnectivity::size() const {
+    return n_;
+}
+
+bool OfflineDynamicConnectivity::is_valid(int v) const {
+    return 0 <= v && v < n_;
+}
+
+void OfflineDynamicConnectivity::add_edge(int a, int b) {
+    if (!is_valid(a) || !is_valid(b)) {
+        return;
+    }
+    live_[edge_key(a, b)].push_back(queries());
+}
+
+void OfflineDynamicConnectivity::remove_edge(int a, int b) {
+    if (!is_valid(a) || !is_valid(b)) {
+        return;
+    }
+    const auto it = live_.find(edge_key(a, b));
+    if (it == live_.end()) {
+        return;
+    }
+    const int from = it->second.back();
+    it->second.pop_back();
+    if (it->second.empty()) {
+        live_.erase(it);
+    }
+    // A copy that saw no query needs no interval.
+    if (from < queries()) {
+        closed_.push_back({a, b, from, queries()});
+    }
+}
+
+int OfflineDynamicConnectivity::query_connected(int a, int b) {
+    queries_.push_back({a, b, false});
+    return queries() - 1;
+}
+
+int OfflineDynamicConnectivity::query_components() {
+    queries_.push_back({-1, -1, true});
+    return queries() - 1;
+}
+
+int OfflineDynamicConnectivity::queries() const {
+    return static_cast<int>(queries_.size());
+}
+
+std::vector<int> OfflineDynamicConnectivity::solve() const {
+    const int q = queries();
+    std::vector<int> answers(static_cast<size_t>(q), 0);
+    if (q == 0) {
+        return answers;
+    }
+
+    Solver s(n_, q);
+    for (const auto& e : closed_) {
+        s.insert(1, 0, q, e.from, e.to, e.a, e.b);
+    }
+    for (const auto& [key, starts] : live_) {
+        const auto a = static_cast<int>(key >> 32);
+        const auto b = static_cast<int>(key & 0xFFFFFFFFu);
+        for (int from : starts) {
+            s.insert(1, 0, q, from, q, a, b);
+        }
+    }
+
+    s.dfs(1, 0, q, [&](int i, const RollbackDisjointSetUnion& dsu) {
+        const Query& query = queries_[static_cast<size_t>(i)];
+        answers[static_cast<size_t>(i)] =
+            query.components ? dsu.components() : (dsu.same(query.a, query.b) ? 1 : 0);
+    });
+    return answers;
+}
+
+} // namespace ds::dsu
@@ -0,0 +1,110 @@
+#include <algorithm>
+#include <data_structures/dsu/rollback_dsu.h>
+
+namespace ds::dsu {
+
+RollbackDisjointSetUnion::RollbackDisjointSetUnion(int n) {
+    assign(n);
+}
+
+int RollbackDisjointSetUnion::size() const {
+    return n_;
+}
+
+bool RollbackDisjointSetUnion::is_valid(int v) const {
+    return 0 <= v && v < n_;
+}
+
+void RollbackDisjointSetUnion::assign(int n) {
+    n_ = std::max(0, n);
+    components_ = n_;
+
+    parent_.resize(static_cast<size_t>(n_));
+    rank_.assign(static_cast<size_t>(n_), 0);
+    size_.assign(static_cast<size_t>(n_), 1);
+    history_.clear();
+
+    for (int i = 0; i < n_; ++i) {
+        parent_[static_cast<size_t>(i)] = i;
+    }
+}
+
+int RollbackDisjointSetUnion::find(int v) const {
+    if (!is_valid(v)) {
+        return -1;
+    }
+
+    // No path compression: the tree shape must stay exactly as recorded.
+    while (parent_[static_cast<size_t>(v)] != v) {
+        v = parent_[static_cast<size_t>(v)];
+    }
+    return v;
+}
+
+bool RollbackDisjointSetUnion::same(int a, int b) const {
+    if (!is_valid(a) || !is_valid(b)) {
+        return false;
+    }
+    return find(a) == find(b);
+}
+
+bool RollbackDisjointSetUnion::unite(int a, int b) {
+    if (!is_valid(a) || !is_valid(b)) {
+        return false;
+    }
+
+    int ra = find(a);
+    int rb = find(b);
+    if (ra == rb) {
+        return false;
+    }
+
+    // Union by rank; attach rb under ra.
+    if (rank_[static_cast<size_t>(ra)] < rank_[static_cast<size_t>(rb)]) {
+        std::swap(ra, rb);
+    }
+    const bool bump = rank_[static_cast<size_t>(ra)] == rank_[static_cast<size_t>(rb)];
+
+    parent_[static_cast<size_t>(rb)] = ra;
+    size_[static_cast<size_t>(ra)] += size_[static_cast<size_t>(rb)];
+    if (bump) {
+        ++rank_[static_cast<size_t>(ra)];
+    }
+    --components_;
+    history_.push_back({rb, bump});
+    return true;
+}
+
+int RollbackDisjointSetUnion::component_size(int v) const {
+    if (!is_valid(v)) {
+        return 0;
+    }
+    return size_[static_cast<size_t>(find(v))];
+}
+
+int RollbackDisjointSetUnion::components() const {
+    return components_;
+}
+
+int RollbackDisjointSetUnion::snapshot() const {
+    return static_cast<int>(history_.size());
+}
+
+void RollbackDisjointSetUnion::rollback(int to) {
+    to = std::max(to, 0);
+    while (static_cast<int>(history_.size()) > to) {
+        const Change c = history_.back();
+        history_.pop_back();
+
+        const int child = c.child;
+        const int root = parent_[static_cast<size_t>(child)];
+        parent_[static_cast<size_t>(child)] = child;
+        size_[static_cast<size_t>(root)] -= size_[static_cast<size_t>(child)];
+        if (c.rank_bump) {
+            --rank_[static_cast<size_t>(root)];
+        }
+        ++components_;
+    }
+}
+
+} // namespace ds::dsu
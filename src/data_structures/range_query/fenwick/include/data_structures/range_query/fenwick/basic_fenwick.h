@@ -0,0 +1,206 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ds::range_query::fenwick {
+
+// Abelian group policies for BasicFenwickTree.
+//
+// A policy provides identity(), an associative and commutative op(a, b) and
+// inverse(a) with op(a, inverse(a)) == identity(). The inverse is what turns
+// two prefix folds into a range fold.
+template <typename T> struct AddGroup {
+    static T identity() { return T{}; }
+    static T op(const T& a, const T& b) { return a + b; }
+    static T inverse(const T& a) { return -a; }
+};
+
+template <typename T> struct XorGroup {
+    static T identity() { return T{}; }
+    static T op(const T& a, const T& b) { return a ^ b; }
+    static T inverse(const T& a) { return a; }
+};
+
+// Fenwick tree over an arbitrary abelian group (T, Group).
+//
+// Same 0-based layout and defensive API as FenwickTree: tree_[i] holds the
+// fold of A[i & (i + 1) .. i]; out-of-range updates are no-ops and queries
+// clamp to [0..n-1].
+//
+// Complexity: build from a vector O(n), add / prefix_sum / range_sum /
+// lower_bound O(log n), memory n * sizeof(T).
+template <typename T, typename Group = AddGroup<T>> class BasicFenwickTree {
+  public:
+    BasicFenwickTree() = default;
+    explicit BasicFenwickTree(int n) { assign(n); }
+
+    // Linear-time build: each node pushes its finished fold to its parent once.
+    explicit BasicFenwickTree(const std::vector<T>& arr) : tree_(arr) {
+        n_ = static_cast<int>(tree_.size());
+        for (int i = 0; i < n_; ++i) {
+            int parent = i | (i + 1);
+            if (parent < n_) {
+                tree_[static_cast<size_t>(parent)] =
+                    Group::op(tree_[static_cast<size_t>(parent)], tree_[static_cast<size_t>(i)]);
+            }
+        }
+    }
+
+    int size() const { return n_; }
+
+    void assign(int n) {
+        n_ = std::max(0, n);
+        tree_.assign(static_cast<size_t>(n_), Group::identity());
+    }
+
+    // A[idx] = op(A[idx], delta). No-op if idx is out of range.
+    void add(int idx, const T& delta) {
+        if (idx < 0 || idx >= n_) {
+            return;
+        }
+        for (int i = idx; i < n_; i |= (i + 1)) {
+            tree_[static_cast<size_t>(i)] = Group::op(tree_[static_cast<size_t>(i)], delta);
+        }
+    }
+
+    // Fold of A[0..r]. Identity if r < 0; clamps r to n-1.
+    T prefix_sum(int r) const {
+        T res = Group::identity();
+        if (r < 0 || n_ <= 0) {
+            return res;
+        }
+        r = std::min(r, n_ - 1);
+        for (int i = r; i >= 0; i = (i & (i + 1)) - 1) {
+            res = Group::op(res, tree_[static_cast<size_t>(i)]);
+        }
+        return res;
+    }
+
+    // Fold of A[l..r]. Identity for empty/invalid ranges; clamps to [0..n-1].
+    T range_sum(int l, int r) const {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r) {
+            return Group::identity();
+        }
+        return Group::op(prefix_sum(r), Group::inverse(prefix_sum(l - 1)));
+    }
+
+    // Smallest idx with !(prefix_sum(idx) < target), or size() if none.
+    //
+    // Requires prefix folds to be non-decreasing in idx (e.g. non-negative
+    // weights under addition). Binary lifting over the implicit tree: one
+    // root-to-leaf descent, O(log n), instead of a binary search over
+    // prefix_sum which would be O(log^2 n). Useful for weighted sampling:
+    // lower_bound(uniform(0, total)) picks index i with probability A[i] / total.
+    int lower_bound(const T& target) const {
+        int pos = 0; // number of elements known to have prefix fold < target
+        T acc = Group::identity();
+        for (int step = n_ > 0 ? static_cast<int>(std::bit_floor(static_cast<unsigned>(n_))) : 0;
+             step > 0; step >>= 1) {
+            int next = pos + step;
+            if (next <= n_) {
+                T cand = Group::op(acc, tree_[static_cast<size_t>(next - 1)]);
+                if (cand < target) {
+                    pos = next;
+                    acc = cand;
+                }
+            }
+        }
+        return pos;
+    }
+
+  private:
+    int n_ = 0;
+    std::vector<T> tree_;
+};
+
+// Range add / range sum via two Fenwick trees.
+//
+// With D the difference array of A (range_add(l, r, x) is D[l] += x,
+// D[r+1] -= x), the prefix sum is
+//   sum_{k<=r} A[k] = (r + 1) * sum_{k<=r} D[k] - sum_{k<=r} k * D[k],
+// so one tree stores D and the other k * D[k]. T must be an arithmetic-like
+// ring type constructible from the index.
+//
+// Complexity: build O(n), range_add / add / range_sum / value_at O(log n).
+template <typename T> class RangeFenwickTree {
+  public:
+    RangeFenwickTree() = default;
+    explicit RangeFenwickTree(int n) { assign(n); }
+
+    explicit RangeFenwickTree(const std::vector<T>& arr) {
+        const int n = static_cast<int>(arr.size());
+        std::vector<T> d(arr.size()), kd(arr.size());
+        for (int k = 0; k < n; ++k) {
+            const auto uk = static_cast<size_t>(k);
+            d[uk] = k == 0 ? arr[uk] : arr[uk] - arr[uk - 1];
+            kd[uk] = d[uk] * static_cast<T>(k);
+        }
+        d_ = BasicFenwickTree<T>(d);
+        kd_ = BasicFenwickTree<T>(kd);
+    }
+
+    int size() const { return d_.size(); }
+
+    void assign(int n) {
+        d_.assign(n);
+        kd_.assign(n);
+    }
+
+    // A[l..r] += delta. Clamps to [0..n-1]; no-op for empty ranges.
+    void range_add(int l, int r, const T& delta) {
+        l = std::max(l, 0);
+        r = std::min(r, size() - 1);
+        if (l > r) {
+            return;
+        }
+        point_d(l, delta);
+        point_d(r + 1, -delta); // no-op past the end
+    }
+
+    // A[idx] += delta. No-op if idx is out of range.
+    void add(int idx, const T& delta) { range_add(idx, idx, delta); }
+
+    // Current A[idx]. Zero if idx is out of range.
+    T value_at(int idx) const {
+        if (idx < 0 || idx >= size()) {
+            return T{};
+        }
+        return d_.prefix_sum(idx);
+    }
+
+    // Sum on [0..r] inclusive. Returns 0 if r < 0; clamps r to n-1.
+    T prefix_sum(int r) const {
+        if (r < 0 || size() <= 0) {
+            return T{};
+        }
+        r = std::min(r, size() - 1);
+        return static_cast<T>(r + 1) * d_.prefix_sum(r) - kd_.prefix_sum(r);
+    }
+
+    // Sum on [l..r] inclusive. Returns 0 for empty/invalid ranges.
+    T range_sum(int l, int r) const {
+        l = std::max(l, 0);
+        r = std::min(r, size() - 1);
+        if (l > r) {
+            return T{};
+        }
+        return prefix_sum(r) - prefix_sum(l - 1);
+    }
+
+  private:
+    BasicFenwickTree<T> d_;  // D[k]
+    BasicFenwickTree<T> kd_; // k * D[k]
+
+    void point_d(int k, const T& delta) {
+        d_.add(k, delta);
+        kd_.add(k, delta * static_cast<T>(k));
+    }
+};
+
+} // namespace ds::range_query::fenwick
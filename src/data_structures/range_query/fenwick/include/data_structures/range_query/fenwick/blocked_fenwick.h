@@ -0,0 +1,132 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ds::range_query::fenwick {
+
+// Cache-line blocked Fenwick tree for very large arrays.
+//
+// A flat Fenwick tree walks tree_[i], tree_[start(i) - 1], ... with
+// power-of-two strides, so at 10^8 elements most steps of a query or update
+// land on a different cache line and page.
+//
+// Here the array is cut into 64-byte lines of kLine elements (8 for
+// int64_t), and each line stores the running prefix sums of its own
+// elements, so everything below line granularity is resolved inside one
+// line. The line totals form the next level, laid out the same way, and so
+// on until one line remains — a kLine-ary Fenwick tree:
+//
+//   level 0: n elements        (n / 8 lines)
+//   level 1: n / 8 line totals (n / 64 lines)
+//   ...
+//
+// prefix_sum(r) reads one element per level: r's slot at level 0, then the
+// total of all earlier lines via level 1, etc. An update adds delta to the
+// tail of one line per level, a fixed-length masked add the compiler
+// vectorizes. Both touch ceil(log_kLine n) lines instead of ~log2 n
+// scattered ones, with no data-dependent branches, and the upper levels are
+// small enough to stay cache-resident. All levels share one allocation.
+//
+// Memory: about n * kLine / (kLine - 1) elements. API and clamping rules
+// match FenwickTree. T must be an additive type whose size divides 64.
+template <typename T> class BlockedFenwickTree {
+  public:
+    static constexpr int kLineBytes = 64;
+    static constexpr int kLine = kLineBytes / static_cast<int>(sizeof(T));
+    static_assert(kLine >= 2 && kLineBytes % sizeof(T) == 0, "element must tile a cache line");
+
+    BlockedFenwickTree() = default;
+    explicit BlockedFenwickTree(int n) { assign(n); }
+
+    // O(n): each level is filled from the line totals of the level below.
+    explicit BlockedFenwickTree(const std::vector<T>& arr) {
+        assign(static_cast<int>(arr.size()));
+        std::vector<T> values = arr;
+        for (size_t l = 0; l + 1 < offsets_.size(); ++l) {
+            Line* level = &lines_[offsets_[l]];
+            std::vector<T> totals(offsets_[l + 1] - offsets_[l], T{});
+            for (size_t i = 0; i < values.size(); ++i) {
+                totals[i / kLine] += values[i];
+                level[i / kLine].v[i % kLine] = totals[i / kLine];
+            }
+            // Pad the tail of a partial last line so v[kLine - 1] is its total.
+            for (size_t i = values.size(); i % kLine != 0; ++i) {
+                level[i / kLine].v[i % kLine] = totals[i / kLine];
+            }
+            values.swap(totals);
+        }
+    }
+
+    int size() const { return n_; }
+
+    void assign(int n) {
+        n_ = std::max(0, n);
+        offsets_.assign(1, 0);
+        size_t m = static_cast<size_t>(n_);
+        while (m > 0) {
+            const size_t lines = (m + kLine - 1) / kLine;
+            offsets_.push_back(offsets_.back() + lines);
+            if (lines == 1) {
+                break;
+            }
+            m = lines;
+        }
+        lines_.assign(offsets_.back(), Line{});
+    }
+
+    // A[idx] += delta. No-op if idx is out of range.
+    void add(int idx, const T& delta) {
+        if (idx < 0 || idx >= n_) {
+            return;
+        }
+        size_t i = static_cast<size_t>(idx);
+        for (size_t l = 0; l + 1 < offsets_.size(); ++l) {
+            Line& line = lines_[offsets_[l] + i / kLine];
+            const int j = static_cast<int>(i % kLine);
+            for (int k = 0; k < kLine; ++k) {
+                line.v[k] += k >= j ? delta : T{};
+            }
+            i /= kLine;
+        }
+    }
+
+    // Sum on [0..r] inclusive. Returns 0 if r < 0; clamps r to n-1.
+    T prefix_sum(int r) const {
+        T res{};
+        if (r < 0 || n_ <= 0) {
+            return res;
+        }
+        // i counts the elements of the current level that are included.
+        size_t i = static_cast<size_t>(std::min(r, n_ - 1)) + 1;
+        for (size_t l = 0; l + 1 < offsets_.size() && i > 0; ++l) {
+            const size_t line = (i - 1) / kLine;
+            res += lines_[offsets_[l] + line].v[(i - 1) % kLine];
+            i = line; // whole lines before this one, counted at the next level
+        }
+        return res;
+    }
+
+    // Sum on [l..r] inclusive. Returns 0 for empty/invalid ranges.
+    T range_sum(int l, int r) const {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r) {
+            return T{};
+        }
+        return prefix_sum(r) - prefix_sum(l - 1);
+    }
+
+  private:
+    struct alignas(kLineBytes) Line {
+        T v[kLine]{}; // v[k] = sum of this line's elements 0..k
+    };
+
+    int n_ = 0;
+    std::vector<Line> lines_;     // all levels, level 0 first
+    std::vector<size_t> offsets_; // level l occupies lines_[offsets_[l] .. offsets_[l + 1])
+};
+
+} // namespace ds::range_query::fenwick
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ds::range_query::fenwick {
+
+// FenwickTree that any number of threads may update and query at once.
+//
+// Same 0-based layout and clamping rules as FenwickTree, but every node is a
+// std::atomic<int64_t>: add() is a fetch_add(relaxed) per node on the
+// update path, queries are relaxed loads. No locks, no fences.
+//
+// Consistency. The nodes a prefix_sum(r) reads cover [0..r] disjointly, so
+// exactly one of them contains any given idx <= r. A concurrent add(idx, d)
+// is therefore seen either entirely or not at all by that prefix_sum: the
+// result is the sum of every add that finished before the query started
+// plus some subset of the adds running alongside it — never a torn update.
+// That is enough for monotone counters (the result lies between the values
+// before and after the concurrent adds when all deltas are non-negative),
+// but it is not a linearizable snapshot: two queries may observe two
+// concurrent adds in different orders, and range_sum's two prefix reads
+// are not taken at the same instant. Once updates stop, every query is
+// exact.
+//
+// Nodes are not padded, so threads updating nearby indices share cache
+// lines, and the top-level nodes are touched by every update. Under heavy
+// write contention ShardedFenwickTree scales better.
+class ConcurrentFenwickTree {
+  public:
+    ConcurrentFenwickTree() = default;
+    explicit ConcurrentFenwickTree(int n);
+    // O(n) build; not concurrent with anything else.
+    explicit ConcurrentFenwickTree(const std::vector<int64_t>& arr);
+
+    int size() const { return n_; }
+
+    // A[idx] += delta. No-op if idx is out of range. Thread-safe.
+    void add(int idx, int64_t delta);
+
+    // Sum on [0..r] inclusive. Returns 0 if r < 0; clamps r to n-1.
+    int64_t prefix_sum(int r) const;
+
+    // Sum on [l..r] inclusive. Returns 0 for empty/invalid ranges.
+    int64_t range_sum(int l, int r) const;
+
+  private:
+    int n_ = 0;
+    std::vector<std::atomic<int64_t>> tree_;
+};
+
+// Per-thread sharded Fenwick tree: updates never contend, queries merge.
+//
+// The tree is replicated into `shards` independent Fenwick arrays, each
+// padded to whole cache lines. add() goes to the calling thread's shard
+// (threads get shards round-robin on first use), so with at least as many
+// shards as updating threads no two threads ever write the same line. A
+// query sums the prefix sums of all shards.
+//
+// Updates are still atomic fetch_adds — two threads can map to the same
+// shard once there are more threads than shards — but uncontended ones that
+// stay in the core's cache. The consistency guarantee is the same as
+// ConcurrentFenwickTree's: each add is observed entirely or not at all.
+//
+// Complexity: add O(log n); prefix_sum / range_sum O(shards · log n);
+// memory shards · n counters. Suits write-heavy workloads such as
+// histograms that many threads bump and few threads read.
+class ShardedFenwickTree {
+  public:
+    ShardedFenwickTree() = default;
+    // shards <= 0 picks std::thread::hardware_concurrency().
+    explicit ShardedFenwickTree(int n, int shards = 0);
+
+    int size() const { return n_; }
+    int shards() const { return shards_; }
+
+    // A[idx] += delta in the calling thread's shard. No-op if idx is out of
+    // range. Thread-safe.
+    void add(int idx, int64_t delta);
+
+    // A[idx] += delta in an explicit shard (taken modulo shards()), for
+    // callers that manage their own thread ids. Thread-safe.
+    void add(int shard, int idx, int64_t delta);
+
+    // Sum on [0..r] inclusive over all shards. Returns 0 if r < 0; clamps r
+    // to n-1.
+    int64_t prefix_sum(int r) const;
+
+    // Sum on [l..r] inclusive over all shards. Returns 0 for empty/invalid
+    // ranges.
+    int64_t range_sum(int l, int r) const;
+
+  private:
+    int n_ = 0;
+    int shards_ = 0;
+    size_t stride_ = 0; // counters per shard, a whole number of cache lines
+    std::vector<std::atomic<int64_t>> tree_; // shard s at [s * stride_, s * stride_ + n_)
+};
+
+} // namespace ds::range_query::fenwick
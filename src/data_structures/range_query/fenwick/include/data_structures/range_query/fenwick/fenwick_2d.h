@@ -0,0 +1,84 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <vector>
+
+namespace ds::range_query::fenwick {
+
+// 2D Fenwick tree for point updates and rectangle sums on a rows x cols grid
+// (e.g. counts of events per cell).
+//
+// tree_[i][j] holds the sum of A over rows [start(i) .. i] and columns
+// [start(j) .. j], start(x) = x & (x + 1), stored row-major in one array.
+// The inner walk over columns stays inside one row, so it is contiguous for
+// the short strides near the bottom of the tree.
+//
+// Complexity: add / prefix_sum / rect_sum O(log rows * log cols), memory
+// rows * cols. Out-of-range updates are no-ops; queries clamp to the grid.
+template <typename T> class FenwickTree2D {
+  public:
+    FenwickTree2D() = default;
+    FenwickTree2D(int rows, int cols) { assign(rows, cols); }
+
+    int rows() const { return rows_; }
+    int cols() const { return cols_; }
+
+    void assign(int rows, int cols) {
+        rows_ = std::max(0, rows);
+        cols_ = std::max(0, cols);
+        tree_.assign(static_cast<size_t>(rows_) * static_cast<size_t>(cols_), T{});
+    }
+
+    // A[r][c] += delta. No-op if (r, c) is outside the grid.
+    void add(int r, int c, const T& delta) {
+        if (r < 0 || r >= rows_ || c < 0 || c >= cols_) {
+            return;
+        }
+        for (int i = r; i < rows_; i |= (i + 1)) {
+            T* row = &tree_[static_cast<size_t>(i) * static_cast<size_t>(cols_)];
+            for (int j = c; j < cols_; j |= (j + 1)) {
+                row[j] += delta;
+            }
+        }
+    }
+
+    // Sum over rows [0..r] and columns [0..c]. Returns 0 if r < 0 or c < 0;
+    // clamps to the grid.
+    T prefix_sum(int r, int c) const {
+        T res{};
+        if (r < 0 || c < 0 || rows_ == 0 || cols_ == 0) {
+            return res;
+        }
+        r = std::min(r, rows_ - 1);
+        c = std::min(c, cols_ - 1);
+        for (int i = r; i >= 0; i = (i & (i + 1)) - 1) {
+            const T* row = &tree_[static_cast<size_t>(i) * static_cast<size_t>(cols_)];
+            for (int j = c; j >= 0; j = (j & (j + 1)) - 1) {
+                res += row[j];
+            }
+        }
+        return res;
+    }
+
+    // Sum over the rectangle [r1..r2] x [c1..c2] (inclusive). Returns 0 for
+    // empty rectangles; clamps to the grid.
+    T rect_sum(int r1, int c1, int r2, int c2) const {
+        r1 = std::max(r1, 0);
+        c1 = std::max(c1, 0);
+        r2 = std::min(r2, rows_ - 1);
+        c2 = std::min(c2, cols_ - 1);
+        if (r1 > r2 || c1 > c2) {
+            return T{};
+        }
+        return prefix_sum(r2, c2) - prefix_sum(r1 - 1, c2) - prefix_sum(r2, c1 - 1) +
+               prefix_sum(r1 - 1, c1 - 1);
+    }
+
+  private:
+    int rows_ = 0;
+    int cols_ = 0;
+    std::vector<T> tree_;
+};
+
+} // namespace ds::range_query::fenwick
@@ -0,0 +1,124 @@
+#include <algorithm>
+#include <data_structures/range_query/fenwick/concurrent_fenwick.h>
+#include <thread>
+
+namespace ds::range_query::fenwick {
+
+namespace {
+constexpr size_t kLineCounters = 64 / sizeof(int64_t);
+
+// Shard of the calling thread: a ticket drawn on its first add().
+unsigned thread_ticket() {
+    static std::atomic<unsigned> next{0};
+    thread_local const unsigned ticket = next.fetch_add(1, std::memory_order_relaxed);
+    return ticket;
+}
+
+int64_t prefix_of(const std::atomic<int64_t>* tree, int r) {
+    int64_t res = 0;
+    for (int i = r; i >= 0; i = (i & (i + 1)) - 1) {
+        res += tree[i].load(std::memory_order_relaxed);
+    }
+    return res;
+}
+
+void add_to(std::atomic<int64_t>* tree, int n, int idx, int64_t delta) {
+    for (int i = idx; i < n; i |= (i + 1)) {
+        tree[i].fetch_add(delta, std::memory_order_relaxed);
+    }
+}
+} // namespace
+
+// ---- ConcurrentFenwickTree ----
+
+ConcurrentFenwickTree::ConcurrentFenwickTree(int n)
+    : n_(std::max(0, n)), tree_(static_cast<size_t>(n_)) {}
+
+ConcurrentFenwickTree::ConcurrentFenwickTree(const std::vector<int64_t>& arr)
+    : ConcurrentFenwickTree(static_cast<int>(arr.size())) {
+    // Same O(n) build as BasicFenwickTree, on plain integers first.
+    std::vector<int64_t> t = arr;
+    for (int i = 0; i < n_; ++i) {
+        const int parent = i | (i + 1);
+        if (parent < n_) {
+            t[static_cast<size_t>(parent)] += t[static_cast<size_t>(i)];
+        }
+        tree_[static_cast<size_t>(i)].store(t[static_cast<size_t>(i)], std::memory_order_relaxed);
+    }
+}
+
+void ConcurrentFenwickTree::add(int idx, int64_t delta) {
+    if (idx < 0 || idx >= n_) {
+        return;
+    }
+    add_to(tree_.data(), n_, idx, delta);
+}
+
+int64_t ConcurrentFenwickTree::prefix_sum(int r) const {
+    if (r < 0 || n_ <= 0) {
+        return 0;
+    }
+    return prefix_of(tree_.data(), std::min(r, n_ - 1));
+}
+
+int64_t ConcurrentFenwickTree::range_sum(int l, int r) const {
+    l = std::max(l, 0);
+    r = std::min(r, n_ - 1);
+    if (l > r) {
+        return 0;
+    }
+    return prefix_sum(r) - prefix_sum(l - 1);
+}
+
+// ---- ShardedFenwickTree ----
+
+ShardedFenwickTree::ShardedFenwickTree(int n, int shards) : n_(std::max(0, n)) {
+    if (shards <= 0) {
+        shards = static_cast<int>(std::max(1u, std::thread::hardware_concurrency()));
+    }
+    shards_ = shards;
+    // Round up to whole lines plus one spare line, so consecutive shards
+    // never share a cache line whatever the allocation's alignment.
+    stride_ = (static_cast<size_t>(n_) + kLineCounters - 1) / kLineCounters * kLineCounters +
+              kLineCounters;
+    tree_ = std::vector<std::atomic<int64_t>>(stride_ * static_cast<size_t>(shards_));
+}
+
+void ShardedFenwickTree::add(int idx, int64_t delta) {
+    if (shards_ == 0) {
+        return;
+    }
+    add(static_cast<int>(thread_ticket() % static_cast<unsigned>(shards_)), idx, delta);
+}
+
+void ShardedFenwickTree::add(int shard, int idx, int64_t delta) {
+    if (idx < 0 || idx >= n_ || shards_ == 0) {
+        return;
+    }
+    const auto s =
+        static_cast<size_t>(static_cast<unsigned>(shard) % static_cast<unsigned>(shards_));
+    add_to(tree_.data() + s * stride_, n_, idx, delta);
+}
+
+int64_t ShardedFenwickTree::prefix_sum(int r) const {
+    if (r < 0 || n_ <= 0) {
+        return 0;
+    }
+    r = std::min(r, n_ - 1);
+    int64_t res = 0;
+    for (size_t s = 0; s < static_cast<size_t>(shards_); ++s) {
+        res += prefix_of(tree_.data() + s * stride_, r);
+    }
+    return res;
+}
+
+int64_t ShardedFenwickTree::range_sum(int l, int r) const {
+    l = std::max(l, 0);
+    r = std::min(r, n_ - 1);
+    if (l > r) {
+        return 0;
+    }
+    return prefix_sum(r) - prefix_sum(l - 1);
+}
+
+} // namespace ds::range_query::fenwick
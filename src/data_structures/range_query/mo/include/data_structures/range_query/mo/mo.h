@@ -13,9 +13,22 @@ struct Query {
     int32_t idx = -1;
 };
 
+// Order in which Mo's algorithm visits the queries.
+//
+// kBlockOddEven: sort by (l / B, r) with B = sqrt(N), r descending in odd
+//   blocks — the classic ordering.
+// kHilbert: sort by the position of (l, r) along a Hilbert curve over the
+//   N x N grid. Consecutive queries are neighbours in both coordinates, which
+//   on large Q roughly halves the total pointer movement.
+enum class MoOrder { kBlockOddEven, kHilbert };
+
 // Solve distinct-values-in-range queries using Mo's algorithm (classic CP example).
 // - A: input array (any integer values)
 // - queries: vector of Query (l,r,idx); the function may reorder this vector
+// - order: query visiting order (see MoOrder)
+// - threads: > 1 splits the sorted queries into chunks of balanced pointer
+//   movement, each solved on its own thread with a private frequency array
 // Returns: vector<int> answers where answers[idx] is the answer for the query with that original index.
-std::vector<int> mo_solve_distinct(std::vector<int> A, std::vector<Query> queries);
+std::vector<int> mo_solve_distinct(std::vector<int> A, std::vector<Query> queries,
+                                   MoOrder order = MoOrder::kHilbert, int threads = 1);
 } // namespace ds::range_query::mo
@@ -0,0 +1,260 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <data_structures/range_query/mo/mo.h>
+#include <exception>
+#include <thread>
+#include <utility>
+#include <vector>
+
+namespace ds::range_query::mo {
+
+// Position of (x, y) along the Hilbert curve filling [0, 2^log_side)^2.
+// x and y must be below 2^log_side.
+uint64_t hilbert_order(uint32_t x, uint32_t y, int log_side);
+
+// Sort queries into the visiting order for an array of n elements, using up
+// to `threads` threads (parallel slice sorts plus merge rounds).
+void sort_queries(std::vector<Query>& queries, int n, MoOrder order, int threads = 1);
+
+// Total add/remove calls needed to visit queries in the given order,
+// starting from an empty window.
+int64_t count_moves(const std::vector<Query>& queries);
+
+// Cut sorted queries into at most `parts` contiguous chunks of about equal
+// estimated pointer movement, counting a chunk's first window (built from
+// empty) as part of its cost. Returns the chunk start offsets followed by
+// queries.size(); chunks are never empty.
+std::vector<size_t> partition_queries(const std::vector<Query>& sorted, int parts);
+
+// Generic Mo's algorithm.
+//
+// State must provide
+//   void add(int pos);       // A[pos] enters the window
+//   void remove(int pos);    // A[pos] leaves the window
+//   Answer answer();         // answer for the current window
+//
+// solve() sorts the queries, slides one window [curL, curR] over them and
+// returns answers indexed by Query::idx (which must be a permutation of
+// [0, Q)). Queries are 0-based inclusive and must satisfy 0 <= l <= r < n.
+// State is passed by reference and keeps whatever the last window left.
+//
+// Complexity: O((N + Q) sqrt N) add/remove calls plus O(Q log Q) for sorting.
+template <typename State> class Mo {
+  public:
+    using Answer = decltype(std::declval<State&>().answer());
+
+    explicit Mo(int n, MoOrder order = MoOrder::kHilbert) : n_(n), order_(order) {}
+
+    std::vector<Answer> solve(State& state, std::vector<Query> queries) const {
+        std::vector<Answer> ans(queries.size());
+        sort_queries(queries, n_, order_);
+        run(state, queries, 0, queries.size(), ans);
+        return ans;
+    }
+
+    // Parallel mode: the queries are sorted on `threads` threads, cut into
+    // `threads` chunks of balanced estimated movement (partition_queries),
+    // and each chunk runs on its own thread with a private State from
+    // make_state(). Every chunk pays for building its first window from
+    // empty, so the total work grows by up to `threads` windows; in exchange
+    // the chunks share nothing but the answer array, each writing its own
+    // slots.
+    //
+    // make_state must be callable concurrently. An exception thrown by any
+    // worker is rethrown after all threads have joined. Answer must not be
+    // bool (std::vector<bool> slots are not independent).
+    template <typename MakeState>
+    std::vector<Answer> solve_parallel(MakeState make_state, std::vector<Query> queries,
+                                       int threads) const {
+        std::vector<Answer> ans(queries.size());
+        sort_queries(queries, n_, order_, threads);
+        const auto bounds = partition_queries(queries, std::max(1, threads));
+        const size_t chunks = bounds.size() - 1;
+        std::vector<std::exception_ptr> errors(chunks);
+        auto work = [&](size_t c) {
+            try {
+                State state = make_state();
+                run(state, queries, bounds[c], bounds[c + 1], ans);
+            } catch (...) {
+                errors[c] = std::current_exception();
+            }
+        };
+        std::vector<std::thread> pool;
+        pool.reserve(chunks);
+        for (size_t c = 1; c < chunks; ++c)
+            pool.emplace_back(work, c);
+        if (chunks > 0)
+            work(0);
+        for (auto& t : pool)
+            t.join();
+        for (const auto& e : errors)
+            if (e)
+                std::rethrow_exception(e);
+        return ans;
+    }
+
+  private:
+    int n_;
+    MoOrder order_;
+
+    // Slide one window over queries[begin, end), starting from empty.
+    static void run(State& state, const std::vector<Query>& queries, size_t begin, size_t end,
+                    std::vector<Answer>& ans) {
+        int cur_l = 0, cur_r = -1; // empty window
+        for (size_t i = begin; i < end; ++i) {
+            const auto& q = queries[i];
+            if (cur_r < cur_l) {
+                cur_l = q.l; // empty window: jump instead of walking to q.l
+                cur_r = q.l - 1;
+            }
+            // Grow before shrinking so the window never becomes negative.
+            while (cur_l > q.l)
+                state.add(--cur_l);
+            while (cur_r < q.r)
+                state.add(++cur_r);
+            while (cur_l < q.l)
+                state.remove(cur_l++);
+            while (cur_r > q.r)
+                state.remove(cur_r--);
+            ans[static_cast<size_t>(q.idx)] = state.answer();
+        }
+    }
+};
+
+// Query against the array after its first t updates.
+struct TimedQuery {
+    int32_t l = -1;
+    int32_t r = -1;
+    int32_t t = 0;
+    int32_t idx = -1;
+};
+
+// Mo's algorithm with point updates (a third, time, dimension).
+//
+// State provides add / remove / answer as for Mo, plus
+//   int  update_position(int t);  // index written by update t
+//   void swap_update(int t);      // exchange update t's value with A[pos];
+//                                 // applying it twice restores the array
+// The engine moves the time pointer with swap_update, wrapping it in
+// remove / add when the position is inside the current window.
+//
+// Queries are sorted by (l / B, r / B, t) with B = n^(2/3).
+// Complexity: O(N^(5/3)) moves for Q ~ N queries and updates.
+template <typename State> class MoWithUpdates {
+  public:
+    using Answer = decltype(std::declval<State&>().answer());
+
+    explicit MoWithUpdates(int n) : n_(n) {}
+
+    std::vector<Answer> solve(State& state, std::vector<TimedQuery> queries) const {
+        std::vector<Answer> ans(queries.size());
+        int b = 1;
+        while (static_cast<int64_t>(b) * b * b < static_cast<int64_t>(n_) * n_)
+            ++b;
+        std::sort(queries.begin(), queries.end(), [b](const TimedQuery& x, const TimedQuery& y) {
+            if (x.l / b != y.l / b)
+                return x.l < y.l;
+            if (x.r / b != y.r / b)
+                return ((x.l / b) & 1) ? x.r > y.r : x.r < y.r;
+            return ((x.r / b) & 1) ? x.t > y.t : x.t < y.t;
+        });
+        int cur_l = 0, cur_r = -1, cur_t = 0;
+        auto toggle = [&](int t) {
+            const int pos = state.update_position(t);
+            const bool inside = cur_l <= pos && pos <= cur_r;
+            if (inside)
+                state.remove(pos);
+            state.swap_update(t);
+            if (inside)
+                state.add(pos);
+        };
+        for (const auto& q : queries) {
+            while (cur_t < q.t)
+                toggle(cur_t++);
+            while (cur_t > q.t)
+                toggle(--cur_t);
+            while (cur_l > q.l)
+                state.add(--cur_l);
+            while (cur_r < q.r)
+                state.add(++cur_r);
+            while (cur_l < q.l)
+                state.remove(cur_l++);
+            while (cur_r > q.r)
+                state.remove(cur_r--);
+            ans[static_cast<size_t>(q.idx)] = state.answer();
+        }
+        return ans;
+    }
+
+  private:
+    int n_;
+};
+
+// Rollback ("add-only") Mo for aggregates without a cheap remove (max,
+// mode, longest run, ...).
+//
+// State provides
+//   void add(int pos);
+//   Answer answer();
+//   Checkpoint checkpoint();      // e.g. the size of an undo log
+//   void rollback(Checkpoint);    // undo every add since the checkpoint
+// and must be empty when solve() starts; it is empty again on return.
+//
+// Queries are grouped by block of l (B = sqrt(N)) and sorted by r. Within a
+// block the right pointer only grows from the block's end; each query adds
+// its left part from the block end down to l, answers, and rolls that part
+// back. Queries inside one block are answered directly and rolled back.
+//
+// Complexity: O(N sqrt N + Q sqrt N) adds, no removes.
+template <typename State> class RollbackMo {
+  public:
+    using Answer = decltype(std::declval<State&>().answer());
+
+    explicit RollbackMo(int n) : n_(n) {}
+
+    std::vector<Answer> solve(State& state, std::vector<Query> queries) const {
+        std::vector<Answer> ans(queries.size());
+        int b = 1;
+        while (static_cast<int64_t>(b) * b < n_)
+            ++b;
+        std::sort(queries.begin(), queries.end(), [b](const Query& x, const Query& y) {
+            if (x.l / b != y.l / b)
+                return x.l < y.l;
+            return x.r < y.r;
+        });
+        const auto empty = state.checkpoint();
+        size_t i = 0;
+        while (i < queries.size()) {
+            const int block = queries[i].l / b;
+            const int block_end = std::min(n_, (block + 1) * b); // first index past the block
+            int cur_r = block_end - 1;
+            for (; i < queries.size() && queries[i].l / b == block; ++i) {
+                const auto& q = queries[i];
+                if (q.r < block_end) {
+                    const auto mark = state.checkpoint();
+                    for (int p = q.l; p <= q.r; ++p)
+                        state.add(p);
+                    ans[static_cast<size_t>(q.idx)] = state.answer();
+                    state.rollback(mark);
+                    continue;
+                }
+                while (cur_r < q.r)
+                    state.add(++cur_r);
+                const auto mark = state.checkpoint();
+                for (int p = block_end - 1; p >= q.l; --p)
+                    state.add(p);
+                ans[static_cast<size_t>(q.idx)] = state.answer();
+                state.rollback(mark);
+            }
+            state.rollback(empty);
+        }
+        return ans;
+    }
+
+  private:
+    int n_;
+};
+
+} // namespace ds::range_query::mo
@@ -1,7 +1,9 @@
 #include <data_structures/range_query/mo/mo.h>
+#include <data_structures/range_query/mo/mo_engine.h>
 
 namespace ds::range_query::mo {
-std::vector<int> mo_solve_distinct(std::vector<int> A, std::vector<Query> queries) {
+std::vector<int> mo_solve_distinct(std::vector<int> A, std::vector<Query> queries, MoOrder order,
+                                   int threads) {
     const size_t N = A.size();
     const size_t Q = queries.size();
     if (Q == 0)
@@ -16,49 +18,29 @@ std::vector<int> mo_solve_distinct(std::vector<int> A, std::vector<Query> querie
     }
     const int M = static_cast<int>(vals.size());
 
-    // Block size: standard sqrt decomposition. Can be tuned.
-    int B = std::max<int>(1, static_cast<int>(std::sqrt((double)N)));
-
-    // Sort queries by block(l) and r; use odd-even trick for better locality.
-    std::sort(queries.begin(), queries.end(), [B](const Query& x, const Query& y) {
-        int bx = x.l / B, by = y.l / B;
-        if (bx != by)
-            return bx < by;
-        if (bx & 1)
-            return x.r > y.r; // odd block -> descending r
-        return x.r < y.r;     // even block -> ascending r
-    });
-
     // Frequency array and current distinct count
-    std::vector<int> freq(M);
-    int distinct = 0;
-
-    auto add = [&](int pos) {
-        int v = A[pos];
-        if (++freq[v] == 1)
-            ++distinct;
+    struct Distinct {
+        const std::vector<int>& A;
+        std::vector<int> freq;
+        int distinct = 0;
+
+        void add(int pos) {
+            if (++freq[A[pos]] == 1)
+                ++distinct;
+        }
+        void remove(int pos) {
+            if (--freq[A[pos]] == 0)
+                --distinct;
+        }
+        int answer() const { return distinct; }
     };
-    auto remove = [&](int pos) {
-        int v = A[pos];
-        if (--freq[v] == 0)
-            --distinct;
-    };
-
-    std::vector<int> ans(Q);
-    int curL = 0, curR = -1; // empty window
 
-    for (const auto& q : queries) {
-        while (curL > q.l)
-            add(--curL);
-        while (curR < q.r)
-            add(++curR);
-        while (curL < q.l)
-            remove(curL++);
-        while (curR > q.r)
-            remove(curR--);
-        ans[q.idx] = distinct;
+    const Mo<Distinct> mo(static_cast<int>(N), order);
+    if (threads > 1) {
+        return mo.solve_parallel([&] { return Distinct{A, std::vector<int>(M)}; },
+                                 std::move(queries), threads);
     }
-
-    return ans;
+    Distinct state{A, std::vector<int>(M)};
+    return mo.solve(state, std::move(queries));
 }
 } // namespace ds::range_query::mo
\ No newline at end of file
@@ -0,0 +1,148 @@
+#include <algorithm>
+#include <bit>
+#include <cmath>
+#include <cstdlib>
+#include <thread>
+#include <data_structures/range_query/mo/mo_engine.h>
+
+namespace ds::range_query::mo {
+
+uint64_t hilbert_order(uint32_t x, uint32_t y, int log_side) {
+    // Iterative xy -> d: descend one quadrant per level, rotating/reflecting
+    // the sub-square so that every quadrant is entered at its curve start.
+    uint64_t d = 0;
+    const uint32_t n = log_side > 0 ? uint32_t{1} << log_side : 1;
+    for (uint32_t s = n >> 1; s > 0; s >>= 1) {
+        const uint32_t rx = (x & s) ? 1 : 0;
+        const uint32_t ry = (y & s) ? 1 : 0;
+        d += static_cast<uint64_t>(s) * s * ((3 * rx) ^ ry);
+        if (ry == 0) {
+            if (rx == 1) {
+                x = n - 1 - x;
+                y = n - 1 - y;
+            }
+            std::swap(x, y);
+        }
+    }
+    return d;
+}
+
+namespace {
+// Run fn(c) for c in [0, parts) on `parts` threads (the caller runs c = 0).
+template <typename Fn> void parallel_for(size_t parts, Fn fn) {
+    std::vector<std::thread> pool;
+    for (size_t c = 1; c < parts; ++c) {
+        pool.emplace_back(fn, c);
+    }
+    if (parts > 0) {
+        fn(0);
+    }
+    for (auto& t : pool) {
+        t.join();
+    }
+}
+} // namespace
+
+void sort_queries(std::vector<Query>& queries, int n, MoOrder order, int threads) {
+    // Both orders reduce to one integer key per query. Compute the keys once
+    // and sort (key, position) pairs rather than evaluating the order inside
+    // the comparator or moving whole queries around.
+    const int log_side = std::bit_width(static_cast<unsigned>(std::max(n, 1)));
+    const int B = std::max(1, static_cast<int>(std::sqrt(static_cast<double>(n))));
+    auto key = [&](const Query& q) -> uint64_t {
+        if (order == MoOrder::kHilbert) {
+            return hilbert_order(static_cast<uint32_t>(q.l), static_cast<uint32_t>(q.r), log_side);
+        }
+        const auto block = static_cast<uint64_t>(q.l / B);
+        // Odd block -> descending r, even block -> ascending r.
+        const auto r = static_cast<uint32_t>((block & 1) ? n - 1 - q.r : q.r);
+        return (block << 32) | r;
+    };
+
+    using Keyed = std::pair<uint64_t, uint32_t>;
+    const size_t q = queries.size();
+    std::vector<Keyed> keyed(q);
+    // Slices below ~4K queries are not worth a thread.
+    const size_t parts =
+        std::min(static_cast<size_t>(std::max(threads, 1)), std::max<size_t>(q / 4096, 1));
+    auto cut = [&](size_t c) { return q * c / parts; };
+
+    // Key and sort `parts` slices in parallel, then merge pairs of runs in
+    // log2(parts) rounds, each round's merges in parallel.
+    parallel_for(parts, [&](size_t c) {
+        for (size_t i = cut(c); i < cut(c + 1); ++i) {
+            keyed[i] = {key(queries[i]), static_cast<uint32_t>(i)};
+        }
+        std::sort(keyed.begin() + static_cast<std::ptrdiff_t>(cut(c)),
+                  keyed.begin() + static_cast<std::ptrdiff_t>(cut(c + 1)));
+    });
+    for (size_t width = 1; width < parts; width *= 2) {
+        const size_t merges = (parts + 2 * width - 1) / (2 * width);
+        parallel_for(merges, [&](size_t m) {
+            const size_t lo = 2 * width * m;
+            const size_t mid = std::min(lo + width, parts);
+            const size_t hi = std::min(lo + 2 * width, parts);
+            std::inplace_merge(keyed.begin() + static_cast<std::ptrdiff_t>(cut(lo)),
+                               keyed.begin() + static_cast<std::ptrdiff_t>(cut(mid)),
+                               keyed.begin() + static_cast<std::ptrdiff_t>(cut(hi)));
+        });
+    }
+
+    std::vector<Query> sorted(q);
+    for (size_t i = 0; i < q; ++i) {
+        sorted[i] = queries[keyed[i].second];
+    }
+    queries.swap(sorted);
+}
+
+namespace {
+// add/remove calls to go from window [cur_l, cur_r] to q; an empty window
+// (cur_r < cur_l) costs the full length of q.
+int64_t move_cost(int cur_l, int cur_r, const Query& q) {
+    if (cur_r < cur_l) {
+        return q.r - q.l + 1;
+    }
+    return std::abs(q.l - cur_l) + std::abs(q.r - cur_r);
+}
+} // namespace
+
+int64_t count_moves(const std::vector<Query>& queries) {
+    int64_t moves = 0;
+    int cur_l = 0, cur_r = -1;
+    for (const auto& q : queries) {
+        moves += move_cost(cur_l, cur_r, q);
+        cur_l = q.l;
+        cur_r = q.r;
+    }
+    return moves;
+}
+
+std::vector<size_t> partition_queries(const std::vector<Query>& sorted, int parts) {
+    std::vector<size_t> bounds{0};
+    if (sorted.empty()) {
+        return bounds;
+    }
+    // Cost of query i if it continues the previous window.
+    std::vector<int64_t> step(sorted.size());
+    int64_t total = 0;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        step[i] = i == 0 ? move_cost(0, -1, sorted[i])
+                         : move_cost(sorted[i - 1].l, sorted[i - 1].r, sorted[i]);
+        total += step[i];
+    }
+    const int64_t target = total / std::max(1, parts) + 1;
+    int64_t acc = 0;
+    for (size_t i = 0; i < sorted.size(); ++i) {
+        const bool starts_chunk = bounds.back() == i;
+        acc += starts_chunk ? move_cost(0, -1, sorted[i]) : step[i];
+        if (acc >= target && i + 1 < sorted.size() &&
+            static_cast<int>(bounds.size()) < std::max(1, parts)) {
+            bounds.push_back(i + 1);
+            acc = 0;
+        }
+    }
+    bounds.push_back(sorted.size());
+    return bounds;
+}
+
+} // namespace ds::range_query::mo
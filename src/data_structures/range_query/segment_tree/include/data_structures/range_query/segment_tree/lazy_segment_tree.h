@@ -0,0 +1,356 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <vector>
+
+namespace ds::range_query::segment_tree {
+
+// Policies.
+//
+// A monoid M provides
+//   using value_type = S;
+//   static S identity();
+//   static S op(const S&, const S&);            // associative
+//
+// An action A over M provides
+//   using value_type = F;
+//   static F identity();                        // apply(identity(), x) == x
+//   static S apply(const F& f, const S& x);     // f applied to a whole segment's fold
+//   static F compose(const F& f, const F& g);   // "f after g"
+// with apply(f, op(x, y)) == op(apply(f, x), apply(f, y)). Actions whose
+// effect depends on the segment length (add to a sum) keep the length in S.
+// An action may also provide
+//   static bool is_identity(const F&);
+// so the tree can skip pushing tags that would change nothing — most
+// queries then only read.
+
+template <typename T> struct MinMonoid {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T op(const T& a, const T& b) { return std::min(a, b); }
+};
+
+template <typename T> struct MaxMonoid {
+    using value_type = T;
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T op(const T& a, const T& b) { return std::max(a, b); }
+};
+
+// Sum together with the number of elements it covers.
+template <typename T> struct SumLen {
+    T sum{};
+    int64_t len = 0;
+    bool operator==(const SumLen&) const = default;
+};
+
+template <typename T> struct SumMonoid {
+    using value_type = SumLen<T>;
+    static SumLen<T> identity() { return {}; }
+    static SumLen<T> op(const SumLen<T>& a, const SumLen<T>& b) {
+        return {a.sum + b.sum, a.len + b.len};
+    }
+    static SumLen<T> leaf(const T& v) { return {v, 1}; }
+};
+
+// Add a constant to every element of a range (min / max / sum monoids).
+template <typename T> struct AddAction {
+    using value_type = T;
+    static T identity() { return T{}; }
+    static T apply(const T& f, const T& x) { return f + x; }
+    static SumLen<T> apply(const T& f, const SumLen<T>& x) {
+        return {x.sum + f * static_cast<T>(x.len), x.len};
+    }
+    static T compose(const T& f, const T& g) { return f + g; }
+    static bool is_identity(const T& f) { return f == T{}; }
+};
+
+// Assign a constant to every element of a range (min / max / sum monoids).
+template <typename T> struct AssignAction {
+    struct value_type {
+        T v{};
+        bool set = false;
+    };
+    static value_type identity() { return {}; }
+    static T apply(const value_type& f, const T& x) { return f.set ? f.v : x; }
+    static SumLen<T> apply(const value_type& f, const SumLen<T>& x) {
+        return f.set ? SumLen<T>{f.v * static_cast<T>(x.len), x.len} : x;
+    }
+    static value_type compose(const value_type& f, const value_type& g) { return f.set ? f : g; }
+    static bool is_identity(const value_type& f) { return !f.set; }
+};
+
+// Node storage: data and lazy tags interleaved in one array (kAoS) or kept
+// in two arrays (kSoA). Queries read only data, so SoA keeps twice as many
+// fold values per cache line; updates touch both, so AoS gets each node's
+// pair from one line.
+enum class Layout { kAoS, kSoA };
+
+// Iterative lazy-propagation segment tree (the AtCoder lazy_segtree scheme).
+//
+// Leaves sit at [size, 2 * size) for size = bit_ceil(n); every operation
+// pushes the pending tags on the two root-to-leaf paths of its boundaries
+// top-down, then works bottom-up on the O(log n) canonical nodes between
+// them, then recomputes the boundary paths. No recursion.
+//
+// Same conventions as the other range-query structures: inclusive [l..r],
+// queries clamp to [0..n-1] and return M::identity() for empty ranges,
+// out-of-range updates are no-ops. Queries push pending tags down, so they
+// are non-const.
+//
+// Complexity: build O(n), set / get / query / apply / max_right / min_left
+// O(log n), memory 2 * bit_ceil(n) nodes.
+template <typename M, typename A, Layout L = Layout::kSoA> class LazySegmentTree {
+  public:
+    using S = typename M::value_type;
+    using F = typename A::value_type;
+
+    LazySegmentTree() = default;
+    // n copies of M::identity(). For MinMonoid / MaxMonoid that is the max() /
+    // lowest() sentinel, which AddAction overflows: set() every element before
+    // range-adding to such a tree.
+    explicit LazySegmentTree(int n)
+        : LazySegmentTree(std::vector<S>(static_cast<size_t>(std::max(0, n)), M::identity())) {}
+
+    explicit LazySegmentTree(const std::vector<S>& v) {
+        n_ = static_cast<int>(v.size());
+        size_ = static_cast<int>(std::bit_ceil(static_cast<unsigned>(std::max(n_, 1))));
+        log_ = std::countr_zero(static_cast<unsigned>(size_));
+        nodes_.assign(static_cast<size_t>(2 * size_));
+        for (int i = 0; i < n_; ++i) {
+            d(size_ + i) = v[static_cast<size_t>(i)];
+        }
+        for (int i = size_ - 1; i >= 1; --i) {
+            update(i);
+        }
+    }
+
+    int size() const { return n_; }
+
+    // A[p] = x. No-op if p is out of range.
+    void set(int p, const S& x) {
+        if (p < 0 || p >= n_) {
+            return;
+        }
+        p += size_;
+        push_path(p);
+        d(p) = x;
+        pull_path(p);
+    }
+
+    // A[p]; M::identity() if p is out of range.
+    S get(int p) {
+        if (p < 0 || p >= n_) {
+            return M::identity();
+        }
+        p += size_;
+        push_path(p);
+        return d(p);
+    }
+
+    // Fold of A[l..r]. M::identity() for empty/invalid ranges; clamps to [0..n-1].
+    S query(int l, int r) {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r) {
+            return M::identity();
+        }
+        l += size_;
+        r += size_ + 1; // half-open below
+        push_boundaries(l, r);
+        S sml = M::identity(), smr = M::identity();
+        while (l < r) {
+            if (l & 1) {
+                sml = M::op(sml, d(l++));
+            }
+            if (r & 1) {
+                smr = M::op(d(--r), smr);
+            }
+            l >>= 1;
+            r >>= 1;
+        }
+        return M::op(sml, smr);
+    }
+
+    // Fold of the whole array. O(1).
+    S all() const { return d(1); }
+
+    // A[i] = f(A[i]) for i in [l..r]. Clamps; no-op for empty ranges.
+    void apply(int l, int r, const F& f) {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r) {
+            return;
+        }
+        l += size_;
+        r += size_ + 1;
+        push_boundaries(l, r);
+        for (int a = l, b = r; a < b; a >>= 1, b >>= 1) {
+            if (a & 1) {
+                all_apply(a++, f);
+            }
+            if (b & 1) {
+                all_apply(--b, f);
+            }
+        }
+        for (int i = 1; i <= log_; ++i) {
+            if (((l >> i) << i) != l) {
+                update(l >> i);
+            }
+            if (((r >> i) << i) != r) {
+                update((r - 1) >> i);
+            }
+        }
+    }
+
+    // Largest r in [l-1 .. n-1] with pred(fold(A[l..r])) true, where r = l - 1
+    // is the empty range. pred must be monotone (true, then false as r grows)
+    // and pred(M::identity()) must be true. l is clamped to [0..n].
+    template <typename Pred> int max_right(int l, Pred pred) {
+        l = std::clamp(l, 0, n_);
+        if (l == n_) {
+            return n_ - 1;
+        }
+        l += size_;
+        for (int i = log_; i >= 1; --i) {
+            push(l >> i);
+        }
+        S sm = M::identity();
+        do {
+            while (l % 2 == 0) {
+                l >>= 1;
+            }
+            if (!pred(M::op(sm, d(l)))) {
+                while (l < size_) {
+                    push(l);
+                    l = 2 * l;
+                    if (pred(M::op(sm, d(l)))) {
+                        sm = M::op(sm, d(l));
+                        l++;
+                    }
+                }
+                return l - size_ - 1;
+            }
+            sm = M::op(sm, d(l));
+            l++;
+        } while ((l & -l) != l);
+        return n_ - 1;
+    }
+
+    // Smallest l in [0 .. r+1] with pred(fold(A[l..r])) true, where l = r + 1
+    // is the empty range. pred must be monotone (true, then false as l
+    // shrinks) and pred(M::identity()) must be true. r is clamped to [-1..n-1].
+    template <typename Pred> int min_left(int r, Pred pred) {
+        r = std::clamp(r, -1, n_ - 1) + 1; // half-open end
+        if (r == 0) {
+            return 0;
+        }
+        r += size_;
+        for (int i = log_; i >= 1; --i) {
+            push((r - 1) >> i);
+        }
+        S sm = M::identity();
+        do {
+            r--;
+            while (r > 1 && (r % 2)) {
+                r >>= 1;
+            }
+            if (!pred(M::op(d(r), sm))) {
+                while (r < size_) {
+                    push(r);
+                    r = 2 * r + 1;
+                    if (pred(M::op(d(r), sm))) {
+                        sm = M::op(d(r), sm);
+                        r--;
+                    }
+                }
+                return r + 1 - size_;
+            }
+            sm = M::op(d(r), sm);
+        } while ((r & -r) != r);
+        return 0;
+    }
+
+  private:
+    struct Node {
+        S d;
+        F lz;
+    };
+
+    // Storage for one layout; Nodes<kAoS> and Nodes<kSoA> expose the same accessors.
+    template <Layout, typename = void> struct Nodes {
+        std::vector<Node> v;
+        void assign(size_t n) { v.assign(n, Node{M::identity(), A::identity()}); }
+        S& d(int i) { return v[static_cast<size_t>(i)].d; }
+        const S& d(int i) const { return v[static_cast<size_t>(i)].d; }
+        F& lz(int i) { return v[static_cast<size_t>(i)].lz; }
+    };
+    template <typename Dummy> struct Nodes<Layout::kSoA, Dummy> {
+        std::vector<S> dv;
+        std::vector<F> lzv;
+        void assign(size_t n) {
+            dv.assign(n, M::identity());
+            lzv.assign(n / 2, A::identity()); // internal nodes only
+        }
+        S& d(int i) { return dv[static_cast<size_t>(i)]; }
+        const S& d(int i) const { return dv[static_cast<size_t>(i)]; }
+        F& lz(int i) { return lzv[static_cast<size_t>(i)]; }
+    };
+
+    int n_ = 0;
+    int size_ = 0;
+    int log_ = 0;
+    Nodes<L> nodes_;
+
+    S& d(int i) { return nodes_.d(i); }
+    const S& d(int i) const { return nodes_.d(i); }
+
+    void update(int k) { d(k) = M::op(d(2 * k), d(2 * k + 1)); }
+
+    void all_apply(int k, const F& f) {
+        d(k) = A::apply(f, d(k));
+        if (k < size_) {
+            nodes_.lz(k) = A::compose(f, nodes_.lz(k));
+        }
+    }
+
+    void push(int k) {
+        if constexpr (requires(const F& f) { A::is_identity(f); }) {
+            if (A::is_identity(nodes_.lz(k))) {
+                return;
+            }
+        }
+        all_apply(2 * k, nodes_.lz(k));
+        all_apply(2 * k + 1, nodes_.lz(k));
+        nodes_.lz(k) = A::identity();
+    }
+
+    // Leaf p: push every ancestor's tag down / recompute every ancestor.
+    void push_path(int p) {
+        for (int i = log_; i >= 1; --i) {
+            push(p >> i);
+        }
+    }
+    void pull_path(int p) {
+        for (int i = 1; i <= log_; ++i) {
+            update(p >> i);
+        }
+    }
+
+    // Half-open leaf range [l, r): push the ancestors that are not fully inside.
+    void push_boundaries(int l, int r) {
+        for (int i = log_; i >= 1; --i) {
+            if (((l >> i) << i) != l) {
+                push(l >> i);
+            }
+            if (((r >> i) << i) != r) {
+                push((r - 1) >> i);
+            }
+        }
+    }
+};
+
+} // namespace ds::range_query::segment_tree
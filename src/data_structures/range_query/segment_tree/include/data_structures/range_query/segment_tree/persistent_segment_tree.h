@@ -0,0 +1,232 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ds::range_query::segment_tree {
+
+// Persistent sum segment tree: every update creates a new version and all
+// earlier versions stay queryable.
+//
+// An update copies only the root-to-leaf path of the changed index (at
+// most ceil(log2 n) + 1 nodes) and shares every other subtree with the version
+// it started from. Nodes live in one pooled arena (a std::vector that grows
+// geometrically; reserve() sizes it up front) and refer to their children
+// by 32-bit arena indices instead of pointers:
+//
+//   struct Node { T sum; uint32_t left, right; };  // 16 bytes for int64_t
+//
+// Node 0 is a shared all-zero subtree (its children are itself), so
+// PersistentSegmentTree(n) starts from one node whatever n is.
+//
+// Versions are numbered 0, 1, 2, ... in creation order; version 0 is the
+// initial array. Updates may start from any version, so the history can
+// branch. Updates on a version that does not exist return -1 and create
+// nothing; queries on it see an all-zero array. Otherwise the usual
+// range-query conventions hold: inclusive [l..r], queries clamp to
+// [0..n-1], an out-of-range index leaves the array unchanged (the new
+// version shares the old root).
+//
+// Complexity: build O(n); add / set / get / range_sum / lower_bound
+// O(log n); memory 2n - 1 nodes for a built version 0 plus at most
+// ceil(log2 n) + 1 nodes per update.
+template <typename T = int64_t> class PersistentSegmentTree {
+  public:
+    PersistentSegmentTree() : PersistentSegmentTree(0) {}
+
+    // Version 0: n zeros, sharing the zero node.
+    explicit PersistentSegmentTree(int n) : n_(std::max(0, n)) {
+        nodes_.push_back(Node{});
+        roots_.push_back(0);
+    }
+
+    // Version 0: a copy of arr.
+    explicit PersistentSegmentTree(const std::vector<T>& arr)
+        : PersistentSegmentTree(static_cast<int>(arr.size())) {
+        if (n_ > 0) {
+            nodes_.reserve(2 * arr.size());
+            roots_[0] = build(arr, 0, n_ - 1);
+        }
+    }
+
+    int size() const { return n_; }
+    int versions() const { return static_cast<int>(roots_.size()); }
+
+    // Pre-allocate arena space for `updates` more updates.
+    void reserve(size_t updates) {
+        nodes_.reserve(nodes_.size() + updates * static_cast<size_t>(depth() + 1));
+    }
+
+    // New version: `version` with A[idx] += delta. Returns its number, or -1
+    // if `version` does not exist.
+    int add(int version, int idx, const T& delta) {
+        if (!valid(version)) {
+            return -1;
+        }
+        uint32_t root = roots_[static_cast<size_t>(version)];
+        if (idx >= 0 && idx < n_) {
+            root = add_path(root, idx, delta);
+        }
+        roots_.push_back(root);
+        return versions() - 1;
+    }
+
+    // New version: `version` with A[idx] = value. Returns its number, or -1
+    // if `version` does not exist.
+    int set(int version, int idx, const T& value) {
+        return add(version, idx, value - get(version, idx));
+    }
+
+    // A[idx] in `version`; 0 if idx or version is out of range.
+    T get(int version, int idx) const {
+        if (idx < 0 || idx >= n_) {
+            return T{};
+        }
+        return range_sum(version, idx, idx);
+    }
+
+    // Sum of A[l..r] in `version`. 0 for empty/invalid ranges.
+    T range_sum(int version, int l, int r) const {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r || !valid(version)) {
+            return T{};
+        }
+        const uint32_t root = roots_[static_cast<size_t>(version)];
+        return prefix(root, r) - (l > 0 ? prefix(root, l - 1) : T{});
+    }
+
+    // Smallest idx with !(prefix_sum(idx) < target) in `version`, or size()
+    // if none. Requires non-negative values, as FenwickTree's lower_bound.
+    int lower_bound(int version, const T& target) const {
+        return lower_bound_diff(version, -1, target);
+    }
+
+    // lower_bound over the element-wise difference `newer - older` of two
+    // versions; an invalid `older` counts as all zeros. With version t
+    // holding the counts of the values of A[0..t-1] (A[i] as a rank in
+    // [0, n)), lower_bound_diff(r + 1, l, k + 1) is the rank of the k-th
+    // (0-based) smallest value of A[l..r]. The difference must be
+    // non-negative.
+    int lower_bound_diff(int newer, int older, const T& target) const {
+        if (n_ == 0) {
+            return 0;
+        }
+        uint32_t a = valid(newer) ? roots_[static_cast<size_t>(newer)] : 0;
+        uint32_t b = valid(older) ? roots_[static_cast<size_t>(older)] : 0;
+        if (nodes_[a].sum - nodes_[b].sum < target) {
+            return n_;
+        }
+        T acc{};
+        int lo = 0, hi = n_ - 1;
+        while (lo < hi) {
+            const int mid = lo + (hi - lo) / 2;
+            const T left = nodes_[nodes_[a].left].sum - nodes_[nodes_[b].left].sum;
+            if (acc + left < target) {
+                acc += left;
+                a = nodes_[a].right;
+                b = nodes_[b].right;
+                lo = mid + 1;
+            } else {
+                a = nodes_[a].left;
+                b = nodes_[b].left;
+                hi = mid;
+            }
+        }
+        return lo;
+    }
+
+    // Nodes in the arena, and the bytes it has allocated.
+    size_t nodes() const { return nodes_.size(); }
+    size_t memory_bytes() const {
+        return nodes_.capacity() * sizeof(Node) + roots_.capacity() * sizeof(uint32_t);
+    }
+
+  private:
+    struct Node {
+        T sum{};
+        uint32_t left = 0;
+        uint32_t right = 0;
+    };
+
+    int n_ = 0;
+    std::vector<Node> nodes_;     // the arena; nodes_[0] is the zero subtree
+    std::vector<uint32_t> roots_; // roots_[v]: root of version v
+
+    bool valid(int version) const { return version >= 0 && version < versions(); }
+
+    // Levels below the root: ceil(log2 n).
+    int depth() const {
+        int d = 0;
+        while ((1ll << d) < n_) {
+            ++d;
+        }
+        return d;
+    }
+
+    uint32_t alloc(const Node& node) {
+        nodes_.push_back(node);
+        return static_cast<uint32_t>(nodes_.size() - 1);
+    }
+
+    uint32_t build(const std::vector<T>& arr, int lo, int hi) {
+        if (lo == hi) {
+            return alloc(Node{arr[static_cast<size_t>(lo)], 0, 0});
+        }
+        const int mid = lo + (hi - lo) / 2;
+        const uint32_t left = build(arr, lo, mid);
+        const uint32_t right = build(arr, mid + 1, hi);
+        return alloc(Node{nodes_[left].sum + nodes_[right].sum, left, right});
+    }
+
+    // Copy the path from root to idx's leaf, adding delta on the way.
+    // Returns the new root.
+    uint32_t add_path(uint32_t root, int idx, const T& delta) {
+        uint32_t path[64];
+        bool right[64];
+        int d = 0;
+        uint32_t cur = root;
+        for (int lo = 0, hi = n_ - 1; lo < hi; ++d) {
+            path[d] = cur;
+            const int mid = lo + (hi - lo) / 2;
+            right[d] = idx > mid;
+            if (right[d]) {
+                cur = nodes_[cur].right;
+                lo = mid + 1;
+            } else {
+                cur = nodes_[cur].left;
+                hi = mid;
+            }
+        }
+        uint32_t child = alloc(Node{nodes_[cur].sum + delta, 0, 0});
+        while (d-- > 0) {
+            Node node = nodes_[path[d]]; // copy before alloc may reallocate
+            node.sum += delta;
+            (right[d] ? node.right : node.left) = child;
+            child = alloc(node);
+        }
+        return child;
+    }
+
+    // Sum of A[0..r] under root, 0 <= r < n.
+    T prefix(uint32_t cur, int r) const {
+        T acc{};
+        int lo = 0, hi = n_ - 1;
+        while (lo < hi) {
+            const int mid = lo + (hi - lo) / 2;
+            if (r > mid) {
+                acc += nodes_[nodes_[cur].left].sum;
+                cur = nodes_[cur].right;
+                lo = mid + 1;
+            } else {
+                cur = nodes_[cur].left;
+                hi = mid;
+            }
+        }
+        return acc + nodes_[cur].sum;
+    }
+};
+
+} // namespace ds::range_query::segment_tree
@@ -0,0 +1,7 @@
+// Template instantiation unit — keeps the header compilable as a standalone TU.
+#include <data_structures/range_query/segment_tree/lazy_segment_tree.h>
+
+namespace ds::range_query::segment_tree {
+template class LazySegmentTree<MinMonoid<int64_t>, AssignAction<int64_t>, Layout::kSoA>;
+template class LazySegmentTree<SumMonoid<int64_t>, AddAction<int64_t>, Layout::kAoS>;
+} // namespace ds::range_query::segment_tree
@@ -0,0 +1,7 @@
+// Template instantiation unit — keeps the header compilable as a standalone TU.
+#include <data_structures/range_query/segment_tree/persistent_segment_tree.h>
+
+namespace ds::range_query::segment_tree {
+template class PersistentSegmentTree<int64_t>;
+template class PersistentSegmentTree<int>;
+} // namespace ds::range_query::segment_tree
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <cstdint>
+#include <data_structures/range_query/sparse_table/linear_rmq.h>
+#include <utility>
+#include <vector>
+
+namespace ds::range_query::sparse_table {
+
+// Lowest common ancestor in O(1) per query via an Euler tour and LinearRmq.
+//
+// The tour lists a vertex every time the DFS enters or returns to it
+// (2n - 1 entries for a tree). Between the first occurrences of u and v the
+// tour visits exactly the subtree path from u to v, and the shallowest
+// vertex on it is lca(u, v), so the query is one RMQ over the tour depths.
+//
+// The input is an undirected tree (or forest) as an adjacency list with
+// vertices [0, n-1]. Vertices unreachable from root are ignored: lca()
+// returns -1 for them, as for out-of-range vertices.
+//
+// Complexity: build O(n), lca O(1), memory O(n).
+class EulerTourLca {
+  public:
+    using AdjList = std::vector<std::vector<int32_t>>;
+
+    EulerTourLca() = default;
+    EulerTourLca(const AdjList& tree, int32_t root);
+
+    int32_t lca(int32_t u, int32_t v) const;
+
+    // lca for each pair, written to out (resized to queries.size()).
+    void lca_batch(const std::vector<std::pair<int32_t, int32_t>>& queries,
+                   std::vector<int32_t>& out) const;
+
+    // Depth of v below the root; -1 if v is unreachable or out of range.
+    int32_t depth(int32_t v) const;
+
+  private:
+    std::vector<int32_t> tour_;  // vertex at each tour position
+    std::vector<int32_t> first_; // first tour position of each vertex, -1 if unvisited
+    std::vector<int32_t> depth_;
+    LinearRmq<int32_t> rmq_; // over depths along the tour
+
+    bool visited(int32_t v) const;
+};
+
+} // namespace ds::range_query::sparse_table
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <utility>
+#include <vector>
+
+namespace ds::range_query::sparse_table {
+
+// Static range-minimum queries in O(1) with linear extra memory.
+//
+// The array is cut into blocks of 64. Queries that span blocks combine
+//   - the suffix of l's block and the prefix of r's block, answered by
+//     in-block bitmasks, and
+//   - the whole blocks between them, answered by a sparse table over the
+//     n / 64 block minima.
+//
+// In-block bitmask: scanning a block left to right with a monotonic stack
+// (pop while the top is strictly greater than the new element), mask_[i]
+// has bit j set iff position j of i's block is on the stack after pushing
+// i. For l <= r in one block, the lowest set bit of mask_[r] at or above
+// l's offset is the leftmost minimum of [l..r]: every stack element left of
+// it was popped by a strictly smaller element at or before r.
+//
+// Memory: the values plus 8 bytes per element for the masks plus
+// (n / 64) * log2(n / 64) block indices — for int64_t values about 2x the
+// array, against log2(n) x the array for a full sparse table.
+//
+// Ties resolve to the smallest index. Queries clamp to [0..n-1]; argmin
+// returns -1 for empty ranges.
+//
+// Complexity: build O(n), argmin O(1).
+template <typename T, typename Compare = std::less<T>> class LinearRmq {
+  public:
+    static constexpr int kBlock = 64;
+
+    LinearRmq() = default;
+
+    // Takes the values by value so a large array can be moved in.
+    explicit LinearRmq(std::vector<T> arr, Compare cmp = Compare{})
+        : a_(std::move(arr)), cmp_(std::move(cmp)) {
+        n_ = static_cast<int>(a_.size());
+        build_masks();
+        build_block_table();
+    }
+
+    int size() const { return n_; }
+
+    const T& value_at(int idx) const { return a_[static_cast<size_t>(idx)]; }
+
+    // Index of the leftmost minimum of A[l..r]; -1 for empty/invalid ranges.
+    int argmin(int l, int r) const {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r) {
+            return -1;
+        }
+        const int bl = l / kBlock;
+        const int br = r / kBlock;
+        if (bl == br) {
+            return in_block(l, r);
+        }
+        int best = in_block(l, bl * kBlock + kBlock - 1);
+        if (bl + 1 < br) {
+            best = pick(best, block_argmin(bl + 1, br - 1));
+        }
+        return pick(best, in_block(br * kBlock, r));
+    }
+
+    // argmin for each query, written to out (resized to queries.size()).
+    // Prefetches the mask lines of queries a few slots ahead, so independent
+    // cache misses overlap instead of being paid one query at a time.
+    void argmin_batch(const std::vector<std::pair<int, int>>& queries,
+                      std::vector<int>& out) const {
+        constexpr size_t kAhead = 8;
+        out.resize(queries.size());
+        for (size_t i = 0; i < queries.size(); ++i) {
+            if (i + kAhead < queries.size()) {
+                prefetch(queries[i + kAhead].first);
+                prefetch(queries[i + kAhead].second);
+            }
+            out[i] = argmin(queries[i].first, queries[i].second);
+        }
+    }
+
+    // Bytes held by the structure, values included.
+    size_t memory_bytes() const {
+        return a_.capacity() * sizeof(T) + mask_.capacity() * sizeof(uint64_t) +
+               table_.capacity() * sizeof(int);
+    }
+
+  private:
+    int n_ = 0;
+    int blocks_ = 0;
+    std::vector<T> a_;
+    std::vector<uint64_t> mask_; // in-block min-stack after each position
+    std::vector<int> table_;     // sparse table of block argmins, level k at k * blocks_
+    [[no_unique_address]] Compare cmp_{};
+
+    // Leftmost of two candidate indices with the smaller value (a < b).
+    int pick(int a, int b) const {
+        return cmp_(a_[static_cast<size_t>(b)], a_[static_cast<size_t>(a)]) ? b : a;
+    }
+
+    int in_block(int l, int r) const {
+        const uint64_t m = mask_[static_cast<size_t>(r)] & (~uint64_t{0} << (l % kBlock));
+        return (r / kBlock) * kBlock + std::countr_zero(m);
+    }
+
+    int block_argmin(int bl, int br) const {
+        const int k = std::bit_width(static_cast<unsigned>(br - bl + 1)) - 1;
+        const int* level = table_.data() + static_cast<size_t>(k) * static_cast<size_t>(blocks_);
+        return pick(level[bl], level[br - (1 << k) + 1]);
+    }
+
+    void prefetch(int idx) const {
+#if defined(__GNUC__)
+        if (idx >= 0 && idx < n_) {
+            __builtin_prefetch(&mask_[static_cast<size_t>(idx)]);
+            __builtin_prefetch(&a_[static_cast<size_t>(idx)]);
+        }
+#else
+        (void)idx;
+#endif
+    }
+
+    void build_masks() {
+        mask_.assign(static_cast<size_t>(n_), 0);
+        for (int start = 0; start < n_; start += kBlock) {
+            const int end = std::min(start + kBlock, n_);
+            uint64_t stack = 0;
+            for (int i = start; i < end; ++i) {
+                // Pop the tops (highest bits) that are strictly greater than a_[i].
+                while (stack != 0) {
+                    const int top = start + std::bit_width(stack) - 1;
+                    if (!cmp_(a_[static_cast<size_t>(i)], a_[static_cast<size_t>(top)])) {
+                        break;
+                    }
+                    stack ^= uint64_t{1} << (top - start);
+                }
+                stack |= uint64_t{1} << (i - start);
+                mask_[static_cast<size_t>(i)] = stack;
+            }
+        }
+    }
+
+    void build_block_table() {
+        blocks_ = (n_ + kBlock - 1) / kBlock;
+        const int levels = blocks_ > 0 ? std::bit_width(static_cast<unsigned>(blocks_)) : 0;
+        const auto b = static_cast<size_t>(blocks_);
+        table_.resize(b * static_cast<size_t>(levels));
+        for (int i = 0; i < blocks_; ++i) {
+            const int end = std::min(i * kBlock + kBlock, n_);
+            table_[static_cast<size_t>(i)] = in_block(i * kBlock, end - 1);
+        }
+        for (int k = 1; k < levels; ++k) {
+            const int* prev = table_.data() + static_cast<size_t>(k - 1) * b;
+            int* cur = table_.data() + static_cast<size_t>(k) * b;
+            const int half = 1 << (k - 1);
+            for (int i = 0; i + (1 << k) <= blocks_; ++i) {
+                cur[i] = pick(prev[i], prev[i + half]);
+            }
+        }
+    }
+};
+
+} // namespace ds::range_query::sparse_table
@@ -0,0 +1,189 @@
+#pragma once
+
+#include <algorithm>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <vector>
+
+namespace ds::range_query::sparse_table {
+
+// Operation policies.
+//
+// A policy provides identity() and an associative op(a, b). SparseTable
+// additionally needs op to be idempotent (op(a, a) == a), so that two
+// overlapping power-of-two windows can be combined. identity() is what an
+// empty or invalid range returns.
+
+template <typename T> struct MinOp {
+    static constexpr bool kIdempotent = true;
+    static T identity() { return std::numeric_limits<T>::max(); }
+    static T op(const T& a, const T& b) { return std::min(a, b); }
+};
+
+template <typename T> struct MaxOp {
+    static constexpr bool kIdempotent = true;
+    static T identity() { return std::numeric_limits<T>::lowest(); }
+    static T op(const T& a, const T& b) { return std::max(a, b); }
+};
+
+template <typename T> struct GcdOp {
+    static constexpr bool kIdempotent = true;
+    static T identity() { return T{}; }
+    static T op(const T& a, const T& b) { return std::gcd(a, b); }
+};
+
+template <typename T> struct AndOp {
+    static constexpr bool kIdempotent = true;
+    static T identity() { return static_cast<T>(~T{}); }
+    static T op(const T& a, const T& b) { return a & b; }
+};
+
+template <typename T> struct OrOp {
+    static constexpr bool kIdempotent = true;
+    static T identity() { return T{}; }
+    static T op(const T& a, const T& b) { return a | b; }
+};
+
+// Not idempotent: only for DisjointSparseTable.
+template <typename T> struct SumOp {
+    static constexpr bool kIdempotent = false;
+    static T identity() { return T{}; }
+    static T op(const T& a, const T& b) { return a + b; }
+};
+
+// Static range queries for an idempotent operation (RMQ and friends).
+//
+// Level k stores op over every window [i .. i + 2^k - 1]; a query combines
+// the two (possibly overlapping) windows of length 2^floor(log2(len)) that
+// cover [l..r]. Levels live back to back in one array, and level k is built
+// from level k - 1 by a single branch-free pass
+//
+//   cur[i] = op(prev[i], prev[i + 2^(k-1)])
+//
+// over two contiguous ranges, which the compiler vectorizes for arithmetic
+// min / max / and / or.
+//
+// Complexity: build O(n log n), query O(1), memory n * (floor(log2 n) + 1).
+// Same defensive API as the other range-query structures: queries clamp to
+// [0..n-1] and return Op::identity() for empty ranges.
+template <typename T, typename Op = MinOp<T>> class SparseTable {
+    static_assert(Op::kIdempotent, "SparseTable needs an idempotent op; use DisjointSparseTable");
+
+  public:
+    SparseTable() = default;
+
+    explicit SparseTable(const std::vector<T>& arr) {
+        n_ = static_cast<int>(arr.size());
+        levels_ = n_ > 0 ? std::bit_width(static_cast<unsigned>(n_)) : 0;
+        const auto n = static_cast<size_t>(n_);
+        table_.resize(n * static_cast<size_t>(levels_));
+        std::copy(arr.begin(), arr.end(), table_.begin());
+        for (int k = 1; k < levels_; ++k) {
+            const T* prev = table_.data() + static_cast<size_t>(k - 1) * n;
+            T* cur = table_.data() + static_cast<size_t>(k) * n;
+            const size_t half = size_t{1} << (k - 1);
+            const size_t count = n - (size_t{1} << k) + 1;
+            for (size_t i = 0; i < count; ++i) {
+                cur[i] = Op::op(prev[i], prev[i + half]);
+            }
+        }
+    }
+
+    int size() const { return n_; }
+
+    // op over A[l..r]. Op::identity() for empty/invalid ranges; clamps to [0..n-1].
+    T query(int l, int r) const {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r) {
+            return Op::identity();
+        }
+        const int k = std::bit_width(static_cast<unsigned>(r - l + 1)) - 1;
+        const T* level = table_.data() + static_cast<size_t>(k) * static_cast<size_t>(n_);
+        return Op::op(level[l], level[r - (1 << k) + 1]);
+    }
+
+    // Bytes held by the table.
+    size_t memory_bytes() const { return table_.capacity() * sizeof(T); }
+
+  private:
+    int n_ = 0;
+    int levels_ = 0;
+    std::vector<T> table_; // level k at [k * n, k * n + n - 2^k]
+};
+
+// Static range queries for any associative operation (sum, product, matrix
+// product, ...), still O(1) per query with exactly one op.
+//
+// The index range is padded to a power of two m. On level h the array is cut
+// into blocks of 2^(h+1); for every block with midpoint mid, the table holds
+// suffix folds A[i .. mid-1] for i in the left half and prefix folds
+// A[mid .. i] for i in the right half. For l < r, the highest differing bit
+// h of l and r names the unique level where l and r fall in opposite halves
+// of the same block, so the answer is op(level[h][l], level[h][r]).
+//
+// Complexity: build O(m log m), query O(1), memory m * log2(m). Queries
+// clamp to [0..n-1] and return Op::identity() for empty ranges.
+template <typename T, typename Op = SumOp<T>> class DisjointSparseTable {
+  public:
+    DisjointSparseTable() = default;
+
+    explicit DisjointSparseTable(const std::vector<T>& arr) : a_(arr) {
+        n_ = static_cast<int>(arr.size());
+        if (n_ <= 1) {
+            return;
+        }
+        levels_ = std::bit_width(static_cast<unsigned>(n_ - 1));
+        m_ = 1 << levels_;
+        table_.assign(static_cast<size_t>(m_) * static_cast<size_t>(levels_), Op::identity());
+        for (int h = 0; h < levels_; ++h) {
+            T* level = table_.data() + static_cast<size_t>(h) * static_cast<size_t>(m_);
+            const int half = 1 << h;
+            for (int mid = half; mid < n_; mid += 2 * half) {
+                T acc = a_[static_cast<size_t>(mid - 1)];
+                level[mid - 1] = acc;
+                for (int i = mid - 2; i >= mid - half; --i) {
+                    acc = Op::op(a_[static_cast<size_t>(i)], acc);
+                    level[i] = acc;
+                }
+                const int end = std::min(mid + half, n_);
+                acc = a_[static_cast<size_t>(mid)];
+                level[mid] = acc;
+                for (int i = mid + 1; i < end; ++i) {
+                    acc = Op::op(acc, a_[static_cast<size_t>(i)]);
+                    level[i] = acc;
+                }
+            }
+        }
+    }
+
+    int size() const { return n_; }
+
+    // op over A[l..r] in index order. Op::identity() for empty/invalid
+    // ranges; clamps to [0..n-1].
+    T query(int l, int r) const {
+        l = std::max(l, 0);
+        r = std::min(r, n_ - 1);
+        if (l > r) {
+            return Op::identity();
+        }
+        if (l == r) {
+            return a_[static_cast<size_t>(l)];
+        }
+        const int h = std::bit_width(static_cast<unsigned>(l ^ r)) - 1;
+        const T* level = table_.data() + static_cast<size_t>(h) * static_cast<size_t>(m_);
+        return Op::op(level[l], level[r]);
+    }
+
+  private:
+    int n_ = 0;
+    int m_ = 0;
+    int levels_ = 0;
+    std::vector<T> a_;     // single elements (l == r)
+    std::vector<T> table_; // level h at [h * m, (h + 1) * m)
+};
+
+} // namespace ds::range_query::sparse_table
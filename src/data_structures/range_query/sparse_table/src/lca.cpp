@@ -0,0 +1,92 @@
+#include <algorithm>
+#include <data_structures/range_query/sparse_table/lca.h>
+
+namespace ds::range_query::sparse_table {
+
+EulerTourLca::EulerTourLca(const AdjList& tree, int32_t root) {
+    const auto n = static_cast<int32_t>(tree.size());
+    first_.assign(tree.size(), -1);
+    depth_.assign(tree.size(), -1);
+    if (root < 0 || root >= n) {
+        return;
+    }
+    tour_.reserve(2 * tree.size());
+    std::vector<int32_t> tour_depth;
+    tour_depth.reserve(2 * tree.size());
+
+    // Iterative DFS: (vertex, next neighbour index). Re-append the parent to
+    // the tour each time a child's subtree finishes.
+    std::vector<std::pair<int32_t, size_t>> stack;
+    stack.emplace_back(root, 0);
+    depth_[static_cast<size_t>(root)] = 0;
+    first_[static_cast<size_t>(root)] = 0;
+    tour_.push_back(root);
+    tour_depth.push_back(0);
+    while (!stack.empty()) {
+        auto& [v, next] = stack.back();
+        const auto& adj = tree[static_cast<size_t>(v)];
+        if (next < adj.size()) {
+            const int32_t to = adj[next++];
+            if (to < 0 || to >= n || depth_[static_cast<size_t>(to)] != -1) {
+                continue; // parent edge, out of range, or non-tree edge
+            }
+            const int32_t d = depth_[static_cast<size_t>(v)] + 1;
+            depth_[static_cast<size_t>(to)] = d;
+            first_[static_cast<size_t>(to)] = static_cast<int32_t>(tour_.size());
+            tour_.push_back(to);
+            tour_depth.push_back(d);
+            stack.emplace_back(to, 0);
+            continue;
+        }
+        stack.pop_back();
+        if (!stack.empty()) {
+            const int32_t parent = stack.back().first;
+            tour_.push_back(parent);
+            tour_depth.push_back(depth_[static_cast<size_t>(parent)]);
+        }
+    }
+    rmq_ = LinearRmq<int32_t>(std::move(tour_depth));
+}
+
+bool EulerTourLca::visited(int32_t v) const {
+    return v >= 0 && v < static_cast<int32_t>(first_.size()) &&
+           first_[static_cast<size_t>(v)] != -1;
+}
+
+int32_t EulerTourLca::lca(int32_t u, int32_t v) const {
+    if (!visited(u) || !visited(v)) {
+        return -1;
+    }
+    int l = first_[static_cast<size_t>(u)];
+    int r = first_[static_cast<size_t>(v)];
+    if (l > r) {
+        std::swap(l, r);
+    }
+    return tour_[static_cast<size_t>(rmq_.argmin(l, r))];
+}
+
+void EulerTourLca::lca_batch(const std::vector<std::pair<int32_t, int32_t>>& queries,
+                             std::vector<int32_t>& out) const {
+    // Map vertices to tour ranges first, then let the RMQ batch overlap the misses.
+    std::vector<std::pair<int, int>> ranges(queries.size(), {0, -1}); // empty by default
+    for (size_t i = 0; i < queries.size(); ++i) {
+        const auto [u, v] = queries[i];
+        if (visited(u) && visited(v)) {
+            const int a = first_[static_cast<size_t>(u)];
+            const int b = first_[static_cast<size_t>(v)];
+            ranges[i] = {std::min(a, b), std::max(a, b)};
+        }
+    }
+    std::vector<int> idx;
+    rmq_.argmin_batch(ranges, idx);
+    out.resize(queries.size());
+    for (size_t i = 0; i < queries.size(); ++i) {
+        out[i] = idx[i] < 0 ? -1 : tour_[static_cast<size_t>(idx[i])];
+    }
+}
+
+int32_t EulerTourLca::depth(int32_t v) const {
+    return visited(v) ? depth_[static_cast<size_t>(v)] : -1;
+}
+
+} // namespace ds::range_query::sparse_table
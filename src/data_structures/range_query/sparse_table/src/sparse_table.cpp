@@ -0,0 +1,9 @@
+// Template instantiation unit — keeps the header compilable as a standalone TU.
+#include <data_structures/range_query/sparse_table/linear_rmq.h>
+#include <data_structures/range_query/sparse_table/sparse_table.h>
+
+namespace ds::range_query::sparse_table {
+template class SparseTable<int64_t, MinOp<int64_t>>;
+template class DisjointSparseTable<int64_t, SumOp<int64_t>>;
+template class LinearRmq<int64_t>;
+} // namespace ds::range_query::sparse_table
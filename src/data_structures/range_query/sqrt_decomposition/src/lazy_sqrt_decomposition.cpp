@@ -0,0 +1,7 @@
+// Template instantiation unit — keeps the header compilable as a standalone TU.
+#include <data_structures/range_query/sqrt_decomposition/lazy_sqrt_decomposition.h>
+
+namespace ds::range_query::sqrt_decomposition {
+template class LazySqrtDecomposition<SumMonoid<int64_t>, AddAction<int64_t>>;
+template class LazySqrtDecomposition<MinMonoid<int64_t>, AssignAction<int64_t>>;
+} // namespace ds::range_query::sqrt_decomposition
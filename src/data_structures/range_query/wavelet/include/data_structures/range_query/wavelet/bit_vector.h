@@ -0,0 +1,67 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+namespace ds::range_query::wavelet {
+
+// Static bit vector with O(1) rank and O(log n) select.
+//
+// Bits live in 256-bit blocks. Each block stores the number of ones before
+// it and, for its 2nd..4th word, the ones before that word inside the
+// block, right next to the bits:
+//
+//   struct Block { uint64_t words[4]; uint32_t rank; uint8_t sub[4]; };  // 40 bytes
+//
+// so rank1(i) is one block access plus one popcount of a masked word, and
+// the directory costs 25 % on top of the bits. A trailing block past the
+// last bit makes rank1(size()) branch-free. select binary-searches the
+// block ranks, then the sub-ranks, then the bits of one word.
+//
+// Usage: construct with the length, set() the one bits, then build().
+// Positions are 0-based; rank counts are over the prefix [0, i).
+class BitVector {
+  public:
+    BitVector() = default;
+    explicit BitVector(size_t n);
+
+    // Set bit i to 1. Only valid before build(); no-op if i is out of range.
+    void set(size_t i);
+    // Compute the rank directory. Must be called once after the last set().
+    void build();
+
+    size_t size() const { return n_; }
+    size_t ones() const { return ones_; }
+
+    bool get(size_t i) const;
+
+    // Number of ones / zeros in [0, i). i is clamped to size().
+    size_t rank1(size_t i) const;
+    size_t rank0(size_t i) const { return (i < n_ ? i : n_) - rank1(i); }
+
+    // Position of the k-th one / zero (0-based); size() if there are not
+    // that many.
+    size_t select1(size_t k) const;
+    size_t select0(size_t k) const;
+
+    size_t memory_bytes() const { return blocks_.size() * sizeof(Block); }
+
+  private:
+    static constexpr size_t kWords = 4;
+    static constexpr size_t kBlockBits = 64 * kWords;
+
+    struct Block {
+        uint64_t words[kWords]{};
+        uint32_t rank = 0;      // ones in all earlier blocks
+        uint8_t sub[kWords]{};  // sub[j]: ones in words[0 .. j-1]
+    };
+
+    size_t n_ = 0;
+    size_t ones_ = 0;
+    std::vector<Block> blocks_;
+
+    template <bool kOne> size_t select(size_t k) const;
+};
+
+} // namespace ds::range_query::wavelet
@@ -0,0 +1,118 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <data_structures/range_query/wavelet/bit_vector.h>
+#include <optional>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace ds::range_query::wavelet {
+
+// Wavelet matrix over non-negative integers: order statistics and value
+// counts on any subarray, online.
+//
+// With L = bit_width(max value) levels, level d holds one bit per element:
+// bit (L - 1 - d) of each value, with the elements stably reordered so that
+// those whose previous bit was 0 come first (zeros_[d] of them). An index
+// range [l, r) at one level maps to the range of the same elements at the
+// next level with two rank queries, so every operation walks the levels
+// once, top bit first:
+//
+//   kth_smallest(l, r, k)  k-th (0-based) smallest of A[l..r]
+//   rank_less(l, r, x)     #{i in [l..r] : A[i] < x}
+//   range_freq(l, r, lo, hi)  #{i in [l..r] : lo <= A[i] < hi}
+//   count(l, r, x)         occurrences of x in A[l..r]
+//   select(x, k)           position of the k-th (0-based) occurrence of x
+//   top_k(l, r, k)         k most frequent values of A[l..r]
+//
+// Same conventions as the other range-query structures: inclusive [l..r],
+// ranges clamp to [0..n-1], empty ranges count nothing.
+//
+// Complexity with sigma = 2^L: build O(n log sigma); access, kth_smallest,
+// rank_less, range_freq, count O(log sigma); select O(log sigma log n).
+// Memory about 1.25 n log sigma bits.
+//
+// top_k is a best-first search that always expands the value range holding
+// the most elements. It touches every range more frequent than the k-th
+// answer: O(k log sigma) range expansions when a few values dominate, but up
+// to one per distinct value on flat data, where every value occurs once or
+// twice.
+class WaveletMatrix {
+  public:
+    WaveletMatrix() = default;
+    explicit WaveletMatrix(const std::vector<uint64_t>& a);
+
+    int size() const { return n_; }
+    int levels() const { return static_cast<int>(levels_.size()); }
+
+    // A[i]; 0 if i is out of range.
+    uint64_t access(int i) const;
+
+    // k-th (0-based) smallest value in A[l..r]; nullopt if the range is
+    // empty or k is not in [0, r - l].
+    std::optional<uint64_t> kth_smallest(int l, int r, int k) const;
+
+    // Number of i in [l..r] with A[i] < x.
+    int rank_less(int l, int r, uint64_t x) const;
+
+    // Number of i in [l..r] with lo <= A[i] < hi; 0 if lo >= hi.
+    int range_freq(int l, int r, uint64_t lo, uint64_t hi) const;
+
+    // Number of i in [l..r] with A[i] == x.
+    int count(int l, int r, uint64_t x) const;
+
+    // Position of the k-th (0-based) occurrence of x in A; -1 if none.
+    int select(uint64_t x, int k) const;
+
+    // Up to k (value, count) pairs of A[l..r], most frequent first, ties by
+    // smaller value.
+    std::vector<std::pair<uint64_t, int>> top_k(int l, int r, int k) const;
+
+    size_t memory_bytes() const;
+
+  private:
+    int n_ = 0;
+    std::vector<BitVector> levels_; // levels_[0] holds the top bit
+    std::vector<size_t> zeros_;     // zeros_[d]: zero bits at level d
+
+    int bit_of(int d) const { return levels() - 1 - d; }
+
+    // Clamp [l..r] to a half-open [lo, hi); false if empty.
+    bool clamp(int l, int r, size_t& lo, size_t& hi) const;
+};
+
+// Number of distinct values in A[l..r], online, in O(log n).
+//
+// With prev[i] the last index before i holding A[i]'s value (-1 if none),
+// A[l..r] has one distinct value per i in [l..r] with prev[i] < l: the
+// first occurrence inside the range. A WaveletMatrix over prev[i] + 1
+// counts those with one rank_less. Build O(n log n) expected, memory about
+// 1.25 n log n bits.
+class RangeDistinct {
+  public:
+    RangeDistinct() = default;
+
+    template <typename T> explicit RangeDistinct(const std::vector<T>& a) {
+        std::vector<uint64_t> prev1(a.size());
+        std::unordered_map<T, size_t> last; // value -> last index + 1
+        last.reserve(a.size());
+        for (size_t i = 0; i < a.size(); ++i) {
+            auto [it, inserted] = last.try_emplace(a[i], i + 1);
+            prev1[i] = inserted ? 0 : it->second;
+            it->second = i + 1;
+        }
+        wm_ = WaveletMatrix(prev1);
+    }
+
+    int size() const { return wm_.size(); }
+
+    // Distinct values in A[l..r]; 0 for empty ranges. Clamps to [0..n-1].
+    int distinct(int l, int r) const;
+
+  private:
+    WaveletMatrix wm_; // over prev[i] + 1
+};
+
+} // namespace ds::range_query::wavelet
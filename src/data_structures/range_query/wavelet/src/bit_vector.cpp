@@ -0,0 +1,84 @@
+#include <bit>
+#include <bit_manipulation/bit_tricks/bit_tricks.h>
+#include <data_structures/range_query/wavelet/bit_vector.h>
+
+namespace ds::range_query::wavelet {
+
+namespace bt = bit_manipulation::bit_tricks;
+
+BitVector::BitVector(size_t n) : n_(n), blocks_(n / kBlockBits + 1) {}
+
+void BitVector::set(size_t i) {
+    if (i >= n_) {
+        return;
+    }
+    blocks_[i / kBlockBits].words[(i / 64) % kWords] |= uint64_t{1} << (i % 64);
+}
+
+void BitVector::build() {
+    uint32_t rank = 0;
+    for (auto& b : blocks_) {
+        b.rank = rank;
+        uint32_t sub = 0; // at most 192 before the last word, so sub[] fits a byte
+        for (size_t j = 0; j < kWords; ++j) {
+            b.sub[j] = static_cast<uint8_t>(sub);
+            sub += static_cast<uint32_t>(bt::popcount(b.words[j]));
+        }
+        rank += sub;
+    }
+    ones_ = rank;
+}
+
+bool BitVector::get(size_t i) const {
+    if (i >= n_) {
+        return false;
+    }
+    return (blocks_[i / kBlockBits].words[(i / 64) % kWords] >> (i % 64)) & 1;
+}
+
+size_t BitVector::rank1(size_t i) const {
+    if (i > n_) {
+        i = n_;
+    }
+    const Block& b = blocks_[i / kBlockBits];
+    const size_t w = (i / 64) % kWords;
+    const uint64_t below = (uint64_t{1} << (i % 64)) - 1;
+    return b.rank + b.sub[w] + static_cast<size_t>(bt::popcount(b.words[w] & below));
+}
+
+template <bool kOne> size_t BitVector::select(size_t k) const {
+    if (k >= (kOne ? ones_ : n_ - ones_)) {
+        return n_;
+    }
+    // Ones (or zeros) before block b / before word j of a block.
+    auto before_block = [&](size_t b) -> size_t {
+        return kOne ? blocks_[b].rank : b * kBlockBits - blocks_[b].rank;
+    };
+    // Last block with fewer than k + 1 matches before it.
+    size_t lo = 0, hi = blocks_.size();
+    while (hi - lo > 1) {
+        const size_t mid = lo + (hi - lo) / 2;
+        if (before_block(mid) <= k) {
+            lo = mid;
+        } else {
+            hi = mid;
+        }
+    }
+    const Block& b = blocks_[lo];
+    k -= before_block(lo);
+    size_t j = kWords - 1;
+    while (j > 0 && (kOne ? b.sub[j] : j * 64 - b.sub[j]) > k) {
+        --j;
+    }
+    k -= kOne ? b.sub[j] : j * 64 - b.sub[j];
+    uint64_t x = kOne ? b.words[j] : ~b.words[j];
+    for (; k > 0; --k) {
+        x = bt::clear_lowest_set_bit(x);
+    }
+    return lo * kBlockBits + j * 64 + static_cast<size_t>(std::countr_zero(x));
+}
+
+size_t BitVector::select1(size_t k) const { return select<true>(k); }
+size_t BitVector::select0(size_t k) const { return select<false>(k); }
+
+} // namespace ds::range_query::wavelet
@@ -0,0 +1,231 @@
+#include <algorithm>
+#include <bit>
+#include <data_structures/range_query/wavelet/wavelet_matrix.h>
+#include <queue>
+
+namespace ds::range_query::wavelet {
+
+WaveletMatrix::WaveletMatrix(const std::vector<uint64_t>& a) : n_(static_cast<int>(a.size())) {
+    const uint64_t mx = a.empty() ? 0 : *std::max_element(a.begin(), a.end());
+    const int L = std::max(1, static_cast<int>(std::bit_width(mx)));
+    zeros_.assign(static_cast<size_t>(L), 0);
+    levels_.reserve(static_cast<size_t>(L));
+
+    // cur holds the values in level d's order; a stable partition by the
+    // level's bit gives the next level's order.
+    std::vector<uint64_t> cur = a, next(a.size());
+    for (int d = 0; d < L; ++d) {
+        const int b = L - 1 - d;
+        BitVector bv(a.size());
+        size_t z = 0;
+        for (size_t i = 0; i < cur.size(); ++i) {
+            if ((cur[i] >> b) & 1) {
+                bv.set(i);
+            } else {
+                ++z;
+            }
+        }
+        bv.build();
+        levels_.push_back(std::move(bv));
+        zeros_[static_cast<size_t>(d)] = z;
+        size_t zi = 0, oi = z;
+        for (uint64_t v : cur) {
+            next[(v >> b) & 1 ? oi++ : zi++] = v;
+        }
+        cur.swap(next);
+    }
+}
+
+bool WaveletMatrix::clamp(int l, int r, size_t& lo, size_t& hi) const {
+    l = std::max(l, 0);
+    r = std::min(r, n_ - 1);
+    if (l > r) {
+        return false;
+    }
+    lo = static_cast<size_t>(l);
+    hi = static_cast<size_t>(r) + 1;
+    return true;
+}
+
+uint64_t WaveletMatrix::access(int i) const {
+    if (i < 0 || i >= n_) {
+        return 0;
+    }
+    auto pos = static_cast<size_t>(i);
+    uint64_t v = 0;
+    for (int d = 0; d < levels(); ++d) {
+        const BitVector& bv = levels_[static_cast<size_t>(d)];
+        const bool bit = bv.get(pos);
+        v = v << 1 | static_cast<uint64_t>(bit);
+        pos = bit ? zeros_[static_cast<size_t>(d)] + bv.rank1(pos) : bv.rank0(pos);
+    }
+    return v;
+}
+
+std::optional<uint64_t> WaveletMatrix::kth_smallest(int l, int r, int k) const {
+    size_t lo, hi;
+    if (!clamp(l, r, lo, hi) || k < 0 || static_cast<size_t>(k) >= hi - lo) {
+        return std::nullopt;
+    }
+    auto kk = static_cast<size_t>(k);
+    uint64_t v = 0;
+    for (int d = 0; d < levels(); ++d) {
+        const BitVector& bv = levels_[static_cast<size_t>(d)];
+        const size_t r0lo = bv.rank0(lo), r0hi = bv.rank0(hi);
+        const size_t z = r0hi - r0lo;
+        if (kk < z) {
+            lo = r0lo;
+            hi = r0hi;
+            v <<= 1;
+        } else {
+            kk -= z;
+            lo = zeros_[static_cast<size_t>(d)] + (lo - r0lo);
+            hi = zeros_[static_cast<size_t>(d)] + (hi - r0hi);
+            v = v << 1 | 1;
+        }
+    }
+    return v;
+}
+
+int WaveletMatrix::rank_less(int l, int r, uint64_t x) const {
+    size_t lo, hi;
+    if (!clamp(l, r, lo, hi)) {
+        return 0;
+    }
+    if (levels() < 64 && (x >> levels()) != 0) {
+        return static_cast<int>(hi - lo); // x exceeds every value
+    }
+    size_t res = 0;
+    for (int d = 0; d < levels(); ++d) {
+        const BitVector& bv = levels_[static_cast<size_t>(d)];
+        const size_t r0lo = bv.rank0(lo), r0hi = bv.rank0(hi);
+        if ((x >> bit_of(d)) & 1) {
+            res += r0hi - r0lo; // the 0-branch is entirely below x
+            lo = zeros_[static_cast<size_t>(d)] + (lo - r0lo);
+            hi = zeros_[static_cast<size_t>(d)] + (hi - r0hi);
+        } else {
+            lo = r0lo;
+            hi = r0hi;
+        }
+    }
+    return static_cast<int>(res);
+}
+
+int WaveletMatrix::range_freq(int l, int r, uint64_t lo, uint64_t hi) const {
+    if (lo >= hi) {
+        return 0;
+    }
+    return rank_less(l, r, hi) - rank_less(l, r, lo);
+}
+
+int WaveletMatrix::count(int l, int r, uint64_t x) const {
+    size_t lo, hi;
+    if (!clamp(l, r, lo, hi) || (levels() < 64 && (x >> levels()) != 0)) {
+        return 0;
+    }
+    for (int d = 0; d < levels() && lo < hi; ++d) {
+        const BitVector& bv = levels_[static_cast<size_t>(d)];
+        if ((x >> bit_of(d)) & 1) {
+            lo = zeros_[static_cast<size_t>(d)] + bv.rank1(lo);
+            hi = zeros_[static_cast<size_t>(d)] + bv.rank1(hi);
+        } else {
+            lo = bv.rank0(lo);
+            hi = bv.rank0(hi);
+        }
+    }
+    return static_cast<int>(hi - lo);
+}
+
+int WaveletMatrix::select(uint64_t x, int k) const {
+    if (k < 0 || n_ == 0 || (levels() < 64 && (x >> levels()) != 0)) {
+        return -1;
+    }
+    // Down: the block of x's occurrences at the bottom level ...
+    size_t lo = 0, hi = static_cast<size_t>(n_);
+    for (int d = 0; d < levels(); ++d) {
+        const BitVector& bv = levels_[static_cast<size_t>(d)];
+        if ((x >> bit_of(d)) & 1) {
+            lo = zeros_[static_cast<size_t>(d)] + bv.rank1(lo);
+            hi = zeros_[static_cast<size_t>(d)] + bv.rank1(hi);
+        } else {
+            lo = bv.rank0(lo);
+            hi = bv.rank0(hi);
+        }
+    }
+    if (static_cast<size_t>(k) >= hi - lo) {
+        return -1;
+    }
+    // ... up: undo each level's reordering with select.
+    size_t pos = lo + static_cast<size_t>(k);
+    for (int d = levels() - 1; d >= 0; --d) {
+        const BitVector& bv = levels_[static_cast<size_t>(d)];
+        pos = (x >> bit_of(d)) & 1 ? bv.select1(pos - zeros_[static_cast<size_t>(d)])
+                                   : bv.select0(pos);
+    }
+    return static_cast<int>(pos);
+}
+
+std::vector<std::pair<uint64_t, int>> WaveletMatrix::top_k(int l, int r, int k) const {
+    std::vector<std::pair<uint64_t, int>> out;
+    size_t lo, hi;
+    if (!clamp(l, r, lo, hi) || k <= 0) {
+        return out;
+    }
+    // A value range: elements [lo, hi) at level depth, values with the
+    // given depth-bit prefix.
+    struct Node {
+        size_t lo, hi;
+        int depth;
+        uint64_t prefix;
+    };
+    const int L = levels();
+    auto min_value = [L](const Node& x) { return x.depth == 0 ? 0 : x.prefix << (L - x.depth); };
+    // Most elements first; among equal counts the range with the smallest
+    // values, so equal-count leaves come out in increasing value order.
+    auto after = [&](const Node& x, const Node& y) {
+        if (x.hi - x.lo != y.hi - y.lo) {
+            return x.hi - x.lo < y.hi - y.lo;
+        }
+        return min_value(x) > min_value(y);
+    };
+    std::priority_queue<Node, std::vector<Node>, decltype(after)> pq(after);
+    pq.push({lo, hi, 0, 0});
+    while (!pq.empty() && out.size() < static_cast<size_t>(k)) {
+        const Node x = pq.top();
+        pq.pop();
+        if (x.depth == L) {
+            out.emplace_back(x.prefix, static_cast<int>(x.hi - x.lo));
+            continue;
+        }
+        const BitVector& bv = levels_[static_cast<size_t>(x.depth)];
+        const size_t z = zeros_[static_cast<size_t>(x.depth)];
+        const size_t r0lo = bv.rank0(x.lo), r0hi = bv.rank0(x.hi);
+        if (r0lo < r0hi) {
+            pq.push({r0lo, r0hi, x.depth + 1, x.prefix << 1});
+        }
+        if (x.hi - x.lo > r0hi - r0lo) {
+            pq.push({z + (x.lo - r0lo), z + (x.hi - r0hi), x.depth + 1, x.prefix << 1 | 1});
+        }
+    }
+    return out;
+}
+
+size_t WaveletMatrix::memory_bytes() const {
+    size_t bytes = zeros_.size() * sizeof(size_t);
+    for (const auto& bv : levels_) {
+        bytes += bv.memory_bytes();
+    }
+    return bytes;
+}
+
+int RangeDistinct::distinct(int l, int r) const {
+    l = std::max(l, 0);
+    r = std::min(r, size() - 1);
+    if (l > r) {
+        return 0;
+    }
+    // First occurrences inside [l..r]: prev[i] < l, i.e. prev[i] + 1 < l + 1.
+    return wm_.rank_less(l, r, static_cast<uint64_t>(l) + 1);
+}
+
+} // namespace ds::range_query::wavelet
@@ -0,0 +1,181 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ds::trie {
+
+/**
+ * @brief Trie for many concurrent readers and a writer, with lock-free reads.
+ *
+ * Same alphabet ('a'..'z'), API and defensive behavior as Trie. Every method
+ * is thread-safe. Readers never lock, wait or write to shared memory other
+ * than their own reader slot. Writers (insert, erase, clear) are serialized
+ * by an internal mutex, so a rebuild can run while lookups are being served
+ * without copying the dictionary.
+ *
+ * - **Publication.** A new node is fully initialized before its index is
+ *   stored into the parent's child slot with a release store. Readers load
+ *   child slots with acquire, so they see either no child or a complete one.
+ * - **Segmented pool.** Nodes live in segments of 1K, 2K, 4K, ... nodes that
+ *   are allocated once and never moved or freed before the trie is
+ *   destroyed, so node references stay valid while the pool grows. Unlike a
+ *   std::vector, growth never copies the nodes.
+ * - **Epoch reclamation.** erase and clear unlink nodes that no longer lead
+ *   to a word. An unlinked node is reused only after every read that might
+ *   still hold it has finished. Readers announce themselves in one of two
+ *   epoch counters (striped per thread). The writer recycles a batch once
+ *   the counters of the epoch it was retired in have drained. It never
+ *   blocks on readers: it simply checks again on its next operation.
+ *
+ * Each query is atomic with respect to single-node updates. Multi-node
+ * results (words_with_prefix, count_with_prefix) reflect writes that land
+ * during the call either fully or not at all per word, but not necessarily a
+ * single instant for the whole result.
+ */
+class ConcurrentTrie {
+  public:
+    static constexpr int ALPHABET_SIZE = 26;
+
+    ConcurrentTrie();
+    ~ConcurrentTrie();
+
+    ConcurrentTrie(const ConcurrentTrie&) = delete;
+    ConcurrentTrie& operator=(const ConcurrentTrie&) = delete;
+
+    /**
+     * @brief Insert a word. Inserting an existing word is a no-op.
+     * @param word Only lowercase 'a'..'z' characters; other words are ignored.
+     */
+    void insert(std::string_view word);
+
+    /**
+     * @brief Check whether a word exists in the trie.
+     */
+    [[nodiscard]] bool search(std::string_view word) const;
+
+    /**
+     * @brief Check whether any inserted word starts with the given prefix.
+     */
+    [[nodiscard]] bool starts_with(std::string_view prefix) const;
+
+    /**
+     * @brief Remove a word from the trie.
+     * @return true if the word was found and removed, false otherwise.
+     */
+    bool erase(std::string_view word);
+
+    /**
+     * @brief Count the number of inserted words that share the given prefix.
+     */
+    [[nodiscard]] int count_with_prefix(std::string_view prefix) const;
+
+    /**
+     * @brief Return all inserted words that share the given prefix.
+     * @return Matching words in lexicographic order.
+     */
+    [[nodiscard]] std::vector<std::string> words_with_prefix(std::string_view prefix) const;
+
+    /**
+     * @brief Find the longest prefix of the given string that is a word in the trie.
+     * @return The longest prefix that was inserted, or "" if none.
+     */
+    [[nodiscard]] std::string longest_prefix_of(std::string_view word) const;
+
+    /**
+     * @brief Return the total number of distinct words stored.
+     */
+    [[nodiscard]] int size() const;
+
+    /**
+     * @brief Check whether the trie is empty.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Remove all words. Nodes are recycled once current readers finish.
+     */
+    void clear();
+
+    /**
+     * @brief Bytes held by allocated segments and the writer's bookkeeping.
+     */
+    [[nodiscard]] size_t memory_bytes() const;
+
+  private:
+    struct Node {
+        std::atomic<int32_t> children[ALPHABET_SIZE]; // node index, or -1
+        std::atomic<int32_t> prefix_count;            // words ending in this subtree
+        std::atomic<bool> is_end;
+    };
+
+    // Segment s holds kFirstSegment << s nodes, so 32 segments never run out.
+    static constexpr int kFirstSegmentLog = 10;
+    static constexpr int kFirstSegment = 1 << kFirstSegmentLog;
+    static constexpr int kSegments = 32 - kFirstSegmentLog;
+
+    // A reader increments active[parity of the epoch] of its slot for the
+    // duration of a query. Slots are cache-line sized so that readers on
+    // different threads do not share a line.
+    static constexpr int kReaderSlots = 64;
+    struct alignas(64) ReaderSlot {
+        std::atomic<int64_t> active[2];
+    };
+
+    std::atomic<Node*> segments_[kSegments];
+    mutable ReaderSlot readers_[kReaderSlots];
+    std::atomic<uint64_t> epoch_;
+    std::atomic<int> word_count_;
+
+    // Writer state, guarded by writer_.
+    mutable std::mutex writer_;
+    int32_t next_;                 // first never-used node index
+    std::vector<int32_t> free_;    // reclaimed, ready for reuse
+    std::vector<int32_t> retired_; // unlinked in the current epoch
+    std::vector<int32_t> waiting_; // unlinked before the last epoch flip
+
+    [[nodiscard]] Node& node(int32_t v) const;
+    int32_t new_node();
+
+    /**
+     * @brief Read-side critical section: nodes reachable while it is held are
+     * not recycled.
+     */
+    class ReadGuard {
+      public:
+        explicit ReadGuard(const ConcurrentTrie& trie);
+        ~ReadGuard();
+        ReadGuard(const ReadGuard&) = delete;
+        ReadGuard& operator=(const ReadGuard&) = delete;
+
+      private:
+        std::atomic<int64_t>* active_;
+    };
+
+    /**
+     * @brief Recycle waiting_ if no reader of its epoch is left, then start a new epoch.
+     */
+    void try_reclaim();
+
+    /**
+     * @brief Unlink child idx of parent and retire its whole subtree.
+     */
+    void retire_subtree(int32_t parent, int idx);
+
+    static int char_to_idx(char c);
+
+    /**
+     * @brief Follow key from the root.
+     * @return The node reached, or -1. Call under a ReadGuard or the writer lock.
+     */
+    [[nodiscard]] int32_t traverse(std::string_view key) const;
+
+    void collect(int32_t v, std::string& current, std::vector<std::string>& result) const;
+};
+
+} // namespace ds::trie
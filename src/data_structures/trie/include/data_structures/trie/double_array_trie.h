@@ -0,0 +1,152 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <optional>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ds::trie {
+
+/**
+ * @brief Read-only double-array trie (DAT), produced by Trie::freeze().
+ *
+ * Every state is one 8-byte unit {base, check}. The transition from state s on
+ * character c goes to t = base[s] + code(c) and exists iff check[t] == s, so a
+ * lookup costs one unit load per key character and no search among children.
+ * Keys use the same alphabet as Trie ('a'..'z'); any other byte simply fails
+ * to match.
+ *
+ * Units are stored as one flat array, which is also the file format: save()
+ * writes a small header followed by the units, and load() maps the file with
+ * mmap (where available) instead of reading it, so loading is O(1) and the
+ * pages are shared between processes that use the same dictionary. Files are
+ * in native byte order; load() rejects files written with another order, an
+ * unknown version or an inconsistent size. Transitions are bounds-checked, so
+ * even a corrupted unit array cannot cause an out-of-range read.
+ *
+ * A DoubleArrayTrie owns either its unit vector or its mapping: it is
+ * move-only.
+ */
+class DoubleArrayTrie {
+  public:
+    /**
+     * @brief An empty dictionary: every query fails.
+     */
+    DoubleArrayTrie();
+    ~DoubleArrayTrie();
+
+    DoubleArrayTrie(const DoubleArrayTrie&) = delete;
+    DoubleArrayTrie& operator=(const DoubleArrayTrie&) = delete;
+    DoubleArrayTrie(DoubleArrayTrie&& other) noexcept;
+    DoubleArrayTrie& operator=(DoubleArrayTrie&& other) noexcept;
+
+    /**
+     * @brief Check whether a word exists in the dictionary.
+     */
+    [[nodiscard]] bool search(std::string_view word) const;
+
+    /**
+     * @brief Check whether any word starts with the given prefix.
+     */
+    [[nodiscard]] bool starts_with(std::string_view prefix) const;
+
+    /**
+     * @brief Length of the longest prefix of word that is in the dictionary,
+     * or 0 if none. Allocation-free variant of longest_prefix_of().
+     */
+    [[nodiscard]] size_t longest_prefix_length(std::string_view word) const;
+
+    /**
+     * @brief Find the longest prefix of the given string that is a word.
+     * @return The longest prefix that was inserted, or "" if none.
+     */
+    [[nodiscard]] std::string longest_prefix_of(std::string_view word) const;
+
+    /**
+     * @brief Number of words in the dictionary.
+     */
+    [[nodiscard]] int size() const;
+
+    /**
+     * @brief Check whether the dictionary is empty.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Number of units in the double array (states plus unused slots).
+     */
+    [[nodiscard]] size_t units() const;
+
+    /**
+     * @brief Bytes of the unit array, whether owned or mapped.
+     */
+    [[nodiscard]] size_t memory_bytes() const;
+
+    /**
+     * @brief True if the units live in a file mapping rather than on the heap.
+     */
+    [[nodiscard]] bool mapped() const;
+
+    /**
+     * @brief Write the dictionary to a file.
+     * @return false if the file could not be written.
+     */
+    bool save(const std::string& path) const;
+
+    /**
+     * @brief Open a file written by save(), mapping it read-only where mmap is
+     * available and reading it otherwise.
+     * @return std::nullopt if the file is missing, truncated or not a
+     * compatible dictionary.
+     */
+    [[nodiscard]] static std::optional<DoubleArrayTrie> load(const std::string& path);
+
+  private:
+    friend class Trie;
+
+    struct Unit {
+        uint32_t base;  // bit 31: a word ends here; bits 0-30: offset of the children
+        uint32_t check; // parent state, or kFree
+    };
+    static_assert(sizeof(Unit) == 8);
+
+    struct Header {
+        char magic[8];
+        uint32_t version;
+        uint32_t byte_order;
+        uint64_t units;
+        uint64_t words;
+    };
+    static_assert(sizeof(Header) == 32);
+
+    static constexpr uint32_t kEnd = 1u << 31;
+    static constexpr uint32_t kOffsetMask = kEnd - 1;
+    static constexpr uint32_t kFree = UINT32_MAX;
+
+    std::vector<Unit> owned_;
+    const Unit* units_;
+    size_t unit_count_;
+    int word_count_;
+    void* map_;        // mmap base, or nullptr when units_ points into owned_
+    size_t map_bytes_;
+
+    // Built by Trie::freeze().
+    DoubleArrayTrie(std::vector<Unit> units, int words);
+
+    void release();
+
+    /**
+     * @brief Map a character to its transition code: 'a'..'z' -> 1..26, else 0.
+     */
+    static uint32_t code(char c);
+
+    /**
+     * @brief Follow key from the root.
+     * @return The state reached, or kFree if the path does not exist.
+     */
+    [[nodiscard]] uint32_t traverse(std::string_view key) const;
+};
+
+} // namespace ds::trie
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace ds::trie {
+
+/**
+ * @brief Radix (Patricia) trie over arbitrary byte strings.
+ *
+ * Same operations as Trie, but any 8-bit key is accepted (URLs, paths, binary
+ * identifiers), and the structure is compressed in two ways:
+ *
+ * - **Path compression.** Every non-root node that is not a word end has at
+ *   least two children, so chains of single-child nodes are collapsed into one
+ *   edge. An edge label is a (begin, length) span into one shared key arena
+ *   rather than a per-node string, so a node is a fixed 20 bytes.
+ * - **Adaptive fan-out.** Children live in blocks of 4, 16, 48 or 256 slots
+ *   (as in the Adaptive Radix Tree). A node moves to the next size when it
+ *   fills up and back down when it empties, so a node with 3 children costs
+ *   20 bytes of child block instead of 256 pointers.
+ *
+ * erase() removes nodes that no longer lead to a word and re-merges chains,
+ * so the tree stays compressed. Labels of removed nodes leave dead bytes in
+ * the arena, which is compacted once more than half of it is dead.
+ *
+ * Operations are O(L) in the key length (plus a scan of at most 16 keys per
+ * node); words_with_prefix returns words in byte-wise lexicographic order
+ * without sorting.
+ */
+class RadixTrie {
+  public:
+    RadixTrie();
+
+    /**
+     * @brief Insert a word. Inserting an existing word is a no-op.
+     * @param word Any byte string, including "" and strings containing '\0'.
+     */
+    void insert(std::string_view word);
+
+    /**
+     * @brief Check whether a word exists in the trie.
+     * @param word The string to search for.
+     * @return true if the exact word was previously inserted.
+     */
+    [[nodiscard]] bool search(std::string_view word) const;
+
+    /**
+     * @brief Check whether any inserted word starts with the given prefix.
+     * @param prefix The prefix to check.
+     * @return true if at least one word in the trie starts with prefix.
+     */
+    [[nodiscard]] bool starts_with(std::string_view prefix) const;
+
+    /**
+     * @brief Remove a word from the trie.
+     * @param word The string to remove.
+     * @return true if the word was found and removed, false otherwise.
+     */
+    bool erase(std::string_view word);
+
+    /**
+     * @brief Count the number of inserted words that share the given prefix.
+     * @param prefix The prefix to count.
+     * @return Number of distinct words starting with prefix.
+     */
+    [[nodiscard]] int count_with_prefix(std::string_view prefix) const;
+
+    /**
+     * @brief Return all inserted words that share the given prefix.
+     * @param prefix The prefix to search for.
+     * @return Matching words in byte-wise lexicographic (std::string) order.
+     */
+    [[nodiscard]] std::vector<std::string> words_with_prefix(std::string_view prefix) const;
+
+    /**
+     * @brief Find the longest prefix of the given string that is a word in the trie.
+     * @param word The string to query.
+     * @return The longest prefix that was inserted, or "" if none.
+     */
+    [[nodiscard]] std::string longest_prefix_of(std::string_view word) const;
+
+    /**
+     * @brief Return the total number of distinct words stored.
+     */
+    [[nodiscard]] int size() const;
+
+    /**
+     * @brief Check whether the trie is empty.
+     */
+    [[nodiscard]] bool empty() const;
+
+    /**
+     * @brief Remove all words and reset to initial state.
+     */
+    void clear();
+
+    /**
+     * @brief Number of live nodes, root included.
+     */
+    [[nodiscard]] size_t nodes() const;
+
+    /**
+     * @brief Heap bytes held by the structure (nodes, child blocks, key arena,
+     * free lists), counted by capacity.
+     */
+    [[nodiscard]] size_t memory_bytes() const;
+
+  private:
+    static constexpr uint32_t kNone = 0; // child slot value: no child (root is never a child)
+
+    enum class Kind : uint8_t { Leaf, N4, N16, N48, N256 };
+
+    struct Node {
+        uint32_t label_begin; // edge label = arena_[label_begin, label_begin + label_len)
+        uint32_t label_len;
+        int prefix_count;     // words ending in this subtree
+        uint32_t block;       // index into the pool of `kind`; unused for Leaf
+        uint16_t children;    // number of children
+        Kind kind;
+        bool is_end;
+    };
+
+    // Node4 / Node16: keys kept sorted, searched linearly.
+    template <int N> struct SmallBlock {
+        uint8_t keys[N];
+        uint32_t child[N];
+    };
+    // Node48: index[byte] is 1 + slot in child[], or 0 if absent.
+    struct Block48 {
+        uint8_t index[256];
+        uint32_t child[48];
+    };
+    struct Block256 {
+        uint32_t child[256];
+    };
+
+    template <typename Block> struct Pool {
+        std::vector<Block> blocks;
+        std::vector<uint32_t> free;
+
+        uint32_t allocate();
+        void release(uint32_t b);
+        size_t memory_bytes() const;
+    };
+
+    // Where a key ends: inside node's label after `matched` bytes (matched ==
+    // label_len means exactly at the node). node == kMissing if the key leaves the tree.
+    struct Locate {
+        uint32_t node;
+        uint32_t matched;
+    };
+    static constexpr uint32_t kMissing = UINT32_MAX;
+
+    std::vector<Node> nodes_;
+    std::vector<uint32_t> free_nodes_;
+    Pool<SmallBlock<4>> pool4_;
+    Pool<SmallBlock<16>> pool16_;
+    Pool<Block48> pool48_;
+    Pool<Block256> pool256_;
+    std::string arena_;  // all edge labels
+    size_t dead_bytes_;  // arena bytes no label refers to
+    int word_count_;
+
+    uint32_t new_node(uint32_t label_begin, uint32_t label_len);
+    void free_node(uint32_t v);
+    uint32_t append_label(std::string_view label);
+    std::string_view label(const Node& n) const;
+
+    uint32_t find_child(const Node& n, uint8_t c) const;
+    void add_child(uint32_t v, uint8_t c, uint32_t child);
+    void replace_child(uint32_t v, uint8_t c, uint32_t child);
+    void remove_child(uint32_t v, uint8_t c);
+    uint32_t first_child(const Node& n) const;
+    void release_block(const Node& n);
+    // Call f(child) for every child of n, in byte order.
+    template <typename F> void for_each_child(const Node& n, F&& f) const;
+
+    [[nodiscard]] Locate locate(std::string_view key) const;
+    void merge_with_child(uint32_t v);
+    void compact_arena();
+    void collect(uint32_t v, std::string& current, std::vector<std::string>& result) const;
+};
+
+} // namespace ds::trie
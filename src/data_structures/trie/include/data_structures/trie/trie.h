@@ -1,8 +1,13 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <data_structures/trie/double_array_trie.h>
+#include <optional>
+#include <span>
 #include <string>
 #include <string_view>
+#include <utility>
 #include <vector>
 
 namespace ds::trie {
@@ -20,6 +25,52 @@ class Trie {
   public:
     static constexpr int ALPHABET_SIZE = 26;
 
+    /**
+     * @brief One result of top_k_with_prefix: a stored word and its score.
+     */
+    struct Completion {
+        std::string_view word; // points into the CompletionBuffer that holds it
+        int64_t score;
+    };
+
+    /**
+     * @brief Reusable output and scratch space for top_k_with_prefix.
+     *
+     * Keep one per thread and pass it to every query: once its vectors have
+     * grown to the working size, a query allocates nothing. Results stay valid
+     * until the buffer is used for the next query.
+     */
+    class CompletionBuffer {
+      public:
+        [[nodiscard]] std::span<const Completion> results() const;
+
+      private:
+        friend class Trie;
+
+        struct Record {
+            int node;
+            int parent; // index into records_, -1 for the prefix node
+            char ch;    // character on the edge from the parent
+        };
+        struct Entry {
+            int64_t score;
+            int record;
+            bool word; // the word at the node itself rather than its subtree
+        };
+
+        struct Span {
+            size_t offset; // in words_
+            size_t length;
+            int64_t score;
+        };
+
+        std::vector<Completion> results_;
+        std::vector<Span> spans_;
+        std::string words_;
+        std::vector<Record> records_;
+        std::vector<Entry> heap_;
+    };
+
     Trie();
 
     /**
@@ -30,6 +81,22 @@ class Trie {
      */
     void insert(std::string_view word);
 
+    /**
+     * @brief Insert a word with a score, or update the score of an existing word.
+     * @param word The string to insert.
+     * @param score Ranking weight used by top_k_with_prefix (higher is better).
+     *
+     * Words inserted without a score have score 0. INT64_MIN is stored as
+     * INT64_MIN + 1.
+     */
+    void insert(std::string_view word, int64_t score);
+
+    /**
+     * @brief Score of a stored word.
+     * @return The score, or std::nullopt if the word is not stored.
+     */
+    [[nodiscard]] std::optional<int64_t> score(std::string_view word) const;
+
     /**
      * @brief Check whether a word exists in the trie.
      * @param word The string to search for.
@@ -67,6 +134,26 @@ class Trie {
      */
     [[nodiscard]] std::vector<std::string> words_with_prefix(std::string_view prefix) const;
 
+    /**
+     * @brief The k highest-scoring words that start with prefix, best first.
+     * @param prefix The prefix to complete.
+     * @param k Maximum number of results; k <= 0 gives none.
+     * @param buffer Receives the results (see CompletionBuffer::results()).
+     *
+     * Every node caches the best score in its subtree, so a best-first walk
+     * reaches the answers directly: it expands only nodes on the paths to the
+     * k results, O(k · depth · ALPHABET_SIZE) heap operations regardless of
+     * how many words share the prefix. Words with equal scores come out in an
+     * unspecified order.
+     */
+    void top_k_with_prefix(std::string_view prefix, int k, CompletionBuffer& buffer) const;
+
+    /**
+     * @brief Convenience overload returning owned strings.
+     */
+    [[nodiscard]] std::vector<std::pair<std::string, int64_t>>
+    top_k_with_prefix(std::string_view prefix, int k) const;
+
     /**
      * @brief Find the longest prefix of the given string that is a word in the trie.
      * @param word The string to query.
@@ -74,6 +161,22 @@ class Trie {
      */
     [[nodiscard]] std::string longest_prefix_of(std::string_view word) const;
 
+    /**
+     * @brief All stored words within Levenshtein distance k of word.
+     * @param word The query; any characters (those outside 'a'..'z' never match).
+     * @param k Maximum number of insertions, deletions and substitutions.
+     * @return (word, distance) pairs in lexicographic order; empty if k < 0.
+     *
+     * Walks the trie carrying one column of the edit-distance matrix per
+     * depth, and skips a subtree as soon as no entry of its column is within
+     * k, so only the neighborhood of the query is visited. For queries of
+     * 1..64 characters the column is two 64-bit delta vectors updated with
+     * the Myers/Hyyrö bit-parallel recurrence, O(1) per node. Longer queries
+     * fall back to an explicit O(|word|) row per node.
+     */
+    [[nodiscard]] std::vector<std::pair<std::string, int>>
+    search_within_distance(std::string_view word, int k) const;
+
     /**
      * @brief Return the total number of distinct words stored.
      * @return Number of words.
@@ -91,6 +194,20 @@ class Trie {
      */
     void clear();
 
+    /**
+     * @brief Heap bytes held by the node pool and its scores, counted by capacity.
+     */
+    [[nodiscard]] size_t memory_bytes() const;
+
+    /**
+     * @brief Build a read-only double-array copy of the current words.
+     * @return A DoubleArrayTrie answering search / starts_with /
+     * longest_prefix_of exactly like this trie, with O(1) work per character.
+     *
+     * Erased words are left out. Later changes to this trie do not affect it.
+     */
+    [[nodiscard]] DoubleArrayTrie freeze() const;
+
   private:
     struct Node {
         int children[ALPHABET_SIZE];
@@ -100,7 +217,15 @@ class Trie {
         Node();
     };
 
+    // Per-node scores, parallel to nodes_ so that plain lookups do not load them.
+    struct Weight {
+        int64_t score; // score of the word ending here, if is_end
+        int64_t best;  // best score in the subtree; NO_SCORE if it holds no word
+    };
+    static constexpr int64_t NO_SCORE = INT64_MIN;
+
     std::vector<Node> nodes_;
+    std::vector<Weight> weights_;
     int word_count_;
 
     /**
@@ -109,6 +234,19 @@ class Trie {
      */
     int new_node();
 
+    /**
+     * @brief Shared body of both insert overloads.
+     * @param score New score, or std::nullopt to keep an existing word's score
+     * (new words then get 0).
+     */
+    void insert_word(std::string_view word, std::optional<int64_t> score);
+
+    /**
+     * @brief Recompute the cached best scores on the path spelling word,
+     * bottom-up, after a score on it went down or a word was removed.
+     */
+    void refresh_best(std::string_view word);
+
     /**
      * @brief Convert a character to an index in [0, ALPHABET_SIZE).
      * @param c The character to convert.
@@ -130,6 +268,21 @@ class Trie {
      * @param result Output vector of collected words.
      */
     void collect(int node_idx, std::string& current, std::vector<std::string>& result) const;
+
+    // Query state of search_within_distance, defined in trie.cpp.
+    struct FuzzyQuery;
+
+    /**
+     * @brief search_within_distance below node, for queries of 1..64 characters.
+     * @param vp, vn Vertical +1 / -1 deltas of the column for current.
+     */
+    void fuzzy_bit_parallel(FuzzyQuery& q, int node, uint64_t vp, uint64_t vn) const;
+
+    /**
+     * @brief search_within_distance below node with explicit DP rows; the row
+     * for current is the last |word| + 1 entries of q's row stack.
+     */
+    void fuzzy_rows(FuzzyQuery& q, int node) const;
 };
 
 } // namespace ds::trie
@@ -0,0 +1,319 @@
+#include <bit>
+#include <data_structures/trie/concurrent_trie.h>
+
+namespace ds::trie {
+
+namespace {
+// Reader slot of the calling thread: threads are spread round-robin over the
+// slots on their first query.
+size_t reader_slot(size_t slots) {
+    static std::atomic<size_t> next{0};
+    thread_local const size_t slot = next.fetch_add(1, std::memory_order_relaxed);
+    return slot % slots;
+}
+} // namespace
+
+// --- Read-side critical sections ---------------------------------------------
+
+ConcurrentTrie::ReadGuard::ReadGuard(const ConcurrentTrie& trie) {
+    ReaderSlot& slot = trie.readers_[reader_slot(kReaderSlots)];
+    for (;;) {
+        const uint64_t e = trie.epoch_.load(std::memory_order_seq_cst);
+        active_ = &slot.active[e & 1];
+        active_->fetch_add(1, std::memory_order_seq_cst);
+        // Pairs with the fence in try_reclaim: either the writer sees this
+        // reader, or this reader sees every unlink made before the writer's check.
+        std::atomic_thread_fence(std::memory_order_seq_cst);
+        if (trie.epoch_.load(std::memory_order_seq_cst) == e) {
+            return;
+        }
+        // The epoch moved on: register under the new one instead.
+        active_->fetch_sub(1, std::memory_order_release);
+    }
+}
+
+ConcurrentTrie::ReadGuard::~ReadGuard() {
+    active_->fetch_sub(1, std::memory_order_release);
+}
+
+// --- ConcurrentTrie public API -------------------------------------------------
+
+ConcurrentTrie::ConcurrentTrie() : epoch_(0), word_count_(0), next_(0) {
+    for (auto& segment : segments_) {
+        segment.store(nullptr, std::memory_order_relaxed);
+    }
+    for (auto& slot : readers_) {
+        slot.active[0].store(0, std::memory_order_relaxed);
+        slot.active[1].store(0, std::memory_order_relaxed);
+    }
+    new_node(); // root is always index 0
+}
+
+ConcurrentTrie::~ConcurrentTrie() {
+    for (auto& segment : segments_) {
+        delete[] segment.load(std::memory_order_relaxed);
+    }
+}
+
+void ConcurrentTrie::insert(std::string_view word) {
+    for (char c : word) {
+        if (char_to_idx(c) < 0) {
+            return; // invalid character — reject silently
+        }
+    }
+
+    std::lock_guard lock(writer_);
+    const int32_t found = traverse(word);
+    if (found != -1 && node(found).is_end.load(std::memory_order_relaxed)) {
+        return;
+    }
+
+    // Only this thread writes, so counts are read-modify-written without RMWs.
+    auto bump = [](std::atomic<int32_t>& count) {
+        count.store(count.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+    };
+    int32_t cur = 0;
+    bump(node(cur).prefix_count);
+    for (char c : word) {
+        std::atomic<int32_t>& slot = node(cur).children[char_to_idx(c)];
+        int32_t child = slot.load(std::memory_order_relaxed);
+        if (child == -1) {
+            child = new_node();
+            bump(node(child).prefix_count);
+            slot.store(child, std::memory_order_release); // publish the initialized node
+        } else {
+            bump(node(child).prefix_count);
+        }
+        cur = child;
+    }
+    node(cur).is_end.store(true, std::memory_order_release);
+    word_count_.fetch_add(1, std::memory_order_relaxed);
+    try_reclaim();
+}
+
+bool ConcurrentTrie::search(std::string_view word) const {
+    ReadGuard guard(*this);
+    const int32_t v = traverse(word);
+    return v != -1 && node(v).is_end.load(std::memory_order_acquire);
+}
+
+bool ConcurrentTrie::starts_with(std::string_view prefix) const {
+    ReadGuard guard(*this);
+    const int32_t v = traverse(prefix);
+    return v != -1 && node(v).prefix_count.load(std::memory_order_relaxed) > 0;
+}
+
+bool ConcurrentTrie::erase(std::string_view word) {
+    std::lock_guard lock(writer_);
+    const int32_t found = traverse(word);
+    if (found == -1 || !node(found).is_end.load(std::memory_order_relaxed)) {
+        return false;
+    }
+
+    node(found).is_end.store(false, std::memory_order_release);
+    auto drop = [](std::atomic<int32_t>& count) {
+        const int32_t left = count.load(std::memory_order_relaxed) - 1;
+        count.store(left, std::memory_order_relaxed);
+        return left;
+    };
+    drop(node(0).prefix_count);
+    int32_t cur = 0;
+    for (char c : word) {
+        const int idx = char_to_idx(c);
+        const int32_t child = node(cur).children[idx].load(std::memory_order_relaxed);
+        if (drop(node(child).prefix_count) == 0) {
+            // No word below child any more: the rest of the path goes with it.
+            retire_subtree(cur, idx);
+            break;
+        }
+        cur = child;
+    }
+    word_count_.fetch_sub(1, std::memory_order_relaxed);
+    try_reclaim();
+    return true;
+}
+
+int ConcurrentTrie::count_with_prefix(std::string_view prefix) const {
+    ReadGuard guard(*this);
+    const int32_t v = traverse(prefix);
+    return v == -1 ? 0 : node(v).prefix_count.load(std::memory_order_relaxed);
+}
+
+std::vector<std::string> ConcurrentTrie::words_with_prefix(std::string_view prefix) const {
+    std::vector<std::string> result;
+    ReadGuard guard(*this);
+    const int32_t v = traverse(prefix);
+    if (v == -1) {
+        return result;
+    }
+    std::string current(prefix);
+    collect(v, current, result);
+    return result;
+}
+
+std::string ConcurrentTrie::longest_prefix_of(std::string_view word) const {
+    ReadGuard guard(*this);
+    int32_t cur = 0;
+    size_t last_end = 0;
+    for (size_t i = 0; i < word.size(); ++i) {
+        const int idx = char_to_idx(word[i]);
+        if (idx < 0) {
+            break;
+        }
+        cur = node(cur).children[idx].load(std::memory_order_acquire);
+        if (cur == -1) {
+            break;
+        }
+        if (node(cur).is_end.load(std::memory_order_acquire)) {
+            last_end = i + 1;
+        }
+    }
+    return std::string(word.substr(0, last_end));
+}
+
+int ConcurrentTrie::size() const {
+    return word_count_.load(std::memory_order_relaxed);
+}
+
+bool ConcurrentTrie::empty() const {
+    return size() == 0;
+}
+
+void ConcurrentTrie::clear() {
+    std::lock_guard lock(writer_);
+    for (int i = 0; i < ALPHABET_SIZE; ++i) {
+        if (node(0).children[i].load(std::memory_order_relaxed) != -1) {
+            retire_subtree(0, i);
+        }
+    }
+    node(0).is_end.store(false, std::memory_order_release);
+    node(0).prefix_count.store(0, std::memory_order_relaxed);
+    word_count_.store(0, std::memory_order_relaxed);
+    try_reclaim();
+}
+
+size_t ConcurrentTrie::memory_bytes() const {
+    std::lock_guard lock(writer_);
+    size_t bytes = 0;
+    for (int s = 0; s < kSegments; ++s) {
+        if (segments_[s].load(std::memory_order_relaxed) != nullptr) {
+            bytes += (static_cast<size_t>(kFirstSegment) << s) * sizeof(Node);
+        }
+    }
+    return bytes + (free_.capacity() + retired_.capacity() + waiting_.capacity()) * sizeof(int32_t);
+}
+
+// --- Private helpers ---------------------------------------------------------
+
+ConcurrentTrie::Node& ConcurrentTrie::node(int32_t v) const {
+    // Index v is slot v + kFirstSegment of a pool whose segment s starts at
+    // kFirstSegment << s, so the segment is given by the highest set bit.
+    const auto j = static_cast<uint32_t>(v) + kFirstSegment;
+    const int s = std::bit_width(j) - 1 - kFirstSegmentLog;
+    return segments_[s].load(std::memory_order_acquire)[j - (uint32_t{kFirstSegment} << s)];
+}
+
+int32_t ConcurrentTrie::new_node() {
+    int32_t v;
+    if (!free_.empty()) {
+        v = free_.back();
+        free_.pop_back();
+    } else {
+        v = next_++;
+        const auto j = static_cast<uint32_t>(v) + kFirstSegment;
+        const int s = std::bit_width(j) - 1 - kFirstSegmentLog;
+        if (segments_[s].load(std::memory_order_relaxed) == nullptr) {
+            segments_[s].store(new Node[static_cast<size_t>(kFirstSegment) << s],
+                               std::memory_order_release);
+        }
+    }
+
+    // No reader can reach v until the caller publishes it.
+    Node& n = node(v);
+    for (auto& child : n.children) {
+        child.store(-1, std::memory_order_relaxed);
+    }
+    n.prefix_count.store(0, std::memory_order_relaxed);
+    n.is_end.store(false, std::memory_order_relaxed);
+    return v;
+}
+
+void ConcurrentTrie::try_reclaim() {
+    if (retired_.empty() && waiting_.empty()) {
+        return;
+    }
+
+    // waiting_ was unlinked before the flip to epoch e, so only readers still
+    // registered under e - 1 can hold its nodes.
+    std::atomic_thread_fence(std::memory_order_seq_cst);
+    const uint64_t e = epoch_.load(std::memory_order_relaxed);
+    for (const auto& slot : readers_) {
+        if (slot.active[(e - 1) & 1].load(std::memory_order_acquire) != 0) {
+            return; // try again on the next write
+        }
+    }
+
+    free_.insert(free_.end(), waiting_.begin(), waiting_.end());
+    waiting_.swap(retired_);
+    retired_.clear();
+    epoch_.store(e + 1, std::memory_order_seq_cst);
+}
+
+void ConcurrentTrie::retire_subtree(int32_t parent, int idx) {
+    std::atomic<int32_t>& slot = node(parent).children[idx];
+    std::vector<int32_t> stack{slot.load(std::memory_order_relaxed)};
+    slot.store(-1, std::memory_order_release);
+
+    // Readers already inside the subtree may keep walking it: its nodes are
+    // left untouched until they are recycled.
+    while (!stack.empty()) {
+        const int32_t v = stack.back();
+        stack.pop_back();
+        retired_.push_back(v);
+        for (const auto& child : node(v).children) {
+            const int32_t c = child.load(std::memory_order_relaxed);
+            if (c != -1) {
+                stack.push_back(c);
+            }
+        }
+    }
+}
+
+int ConcurrentTrie::char_to_idx(char c) {
+    if (c >= 'a' && c <= 'z') {
+        return c - 'a';
+    }
+    return -1;
+}
+
+int32_t ConcurrentTrie::traverse(std::string_view key) const {
+    int32_t cur = 0;
+    for (char c : key) {
+        const int idx = char_to_idx(c);
+        if (idx < 0) {
+            return -1;
+        }
+        cur = node(cur).children[idx].load(std::memory_order_acquire);
+        if (cur == -1) {
+            return -1;
+        }
+    }
+    return cur;
+}
+
+void ConcurrentTrie::collect(int32_t v, std::string& current,
+                             std::vector<std::string>& result) const {
+    if (node(v).is_end.load(std::memory_order_acquire)) {
+        result.push_back(current);
+    }
+    for (int i = 0; i < ALPHABET_SIZE; ++i) {
+        const int32_t child = node(v).children[i].load(std::memory_order_acquire);
+        if (child != -1) {
+            current.push_back(static_cast<char>('a' + i));
+            collect(child, current, result);
+            current.pop_back();
+        }
+    }
+}
+
+} // namespace ds::trie
@@ -0,0 +1,229 @@
+#include <cstdio>
+#include <cstring>
+#include <data_structures/trie/double_array_trie.h>
+#include <utility>
+
+#if defined(__unix__) || defined(__APPLE__)
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#define DS_TRIE_HAVE_MMAP 1
+#endif
+
+namespace ds::trie {
+
+namespace {
+constexpr char kMagic[8] = {'D', 'S', 'D', 'A', 'T', 'R', 'I', 'E'};
+constexpr uint32_t kVersion = 1;
+constexpr uint32_t kByteOrder = 0x01020304;
+} // namespace
+
+DoubleArrayTrie::DoubleArrayTrie() : DoubleArrayTrie(std::vector<Unit>{{0, 0}}, 0) {}
+
+DoubleArrayTrie::DoubleArrayTrie(std::vector<Unit> units, int words)
+    : owned_(std::move(units)), units_(owned_.data()), unit_count_(owned_.size()),
+      word_count_(words), map_(nullptr), map_bytes_(0) {}
+
+DoubleArrayTrie::~DoubleArrayTrie() {
+    release();
+}
+
+DoubleArrayTrie::DoubleArrayTrie(DoubleArrayTrie&& other) noexcept
+    : owned_(std::move(other.owned_)), units_(other.units_), unit_count_(other.unit_count_),
+      word_count_(other.word_count_), map_(std::exchange(other.map_, nullptr)),
+      map_bytes_(std::exchange(other.map_bytes_, 0)) {
+    if (map_ == nullptr) {
+        units_ = owned_.data();
+    }
+    other.units_ = nullptr;
+    other.unit_count_ = 0;
+    other.word_count_ = 0;
+}
+
+DoubleArrayTrie& DoubleArrayTrie::operator=(DoubleArrayTrie&& other) noexcept {
+    if (this != &other) {
+        release();
+        owned_ = std::move(other.owned_);
+        map_ = std::exchange(other.map_, nullptr);
+        map_bytes_ = std::exchange(other.map_bytes_, 0);
+        units_ = map_ == nullptr ? owned_.data() : other.units_;
+        unit_count_ = std::exchange(other.unit_count_, 0);
+        word_count_ = std::exchange(other.word_count_, 0);
+        other.units_ = nullptr;
+    }
+    return *this;
+}
+
+bool DoubleArrayTrie::search(std::string_view word) const {
+    const uint32_t s = traverse(word);
+    return s != kFree && (units_[s].base & kEnd) != 0;
+}
+
+bool DoubleArrayTrie::starts_with(std::string_view prefix) const {
+    // Only live words were frozen, so every reachable state leads to one.
+    return word_count_ > 0 && traverse(prefix) != kFree;
+}
+
+size_t DoubleArrayTrie::longest_prefix_length(std::string_view word) const {
+    if (unit_count_ == 0) {
+        return 0;
+    }
+    uint32_t s = 0;
+    size_t last_end = 0;
+    for (size_t i = 0; i < word.size(); ++i) {
+        const uint32_t c = code(word[i]);
+        const uint32_t t = (units_[s].base & kOffsetMask) + c;
+        if (c == 0 || t >= unit_count_ || units_[t].check != s) {
+            break;
+        }
+        s = t;
+        if ((units_[s].base & kEnd) != 0) {
+            last_end = i + 1;
+        }
+    }
+    return last_end;
+}
+
+std::string DoubleArrayTrie::longest_prefix_of(std::string_view word) const {
+    return std::string(word.substr(0, longest_prefix_length(word)));
+}
+
+int DoubleArrayTrie::size() const {
+    return word_count_;
+}
+
+bool DoubleArrayTrie::empty() const {
+    return word_count_ == 0;
+}
+
+size_t DoubleArrayTrie::units() const {
+    return unit_count_;
+}
+
+size_t DoubleArrayTrie::memory_bytes() const {
+    return unit_count_ * sizeof(Unit);
+}
+
+bool DoubleArrayTrie::mapped() const {
+    return map_ != nullptr;
+}
+
+bool DoubleArrayTrie::save(const std::string& path) const {
+    Header header{};
+    std::memcpy(header.magic, kMagic, sizeof(kMagic));
+    header.version = kVersion;
+    header.byte_order = kByteOrder;
+    header.units = unit_count_;
+    header.words = static_cast<uint64_t>(word_count_);
+
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    if (f == nullptr) {
+        return false;
+    }
+    bool ok = std::fwrite(&header, sizeof(header), 1, f) == 1;
+    if (ok && unit_count_ > 0) {
+        ok = std::fwrite(units_, sizeof(Unit), unit_count_, f) == unit_count_;
+    }
+    return std::fclose(f) == 0 && ok;
+}
+
+std::optional<DoubleArrayTrie> DoubleArrayTrie::load(const std::string& path) {
+    // Validate a header against the total file size.
+    auto valid = [](const Header& h, size_t file_bytes) {
+        return std::memcmp(h.magic, kMagic, sizeof(kMagic)) == 0 && h.version == kVersion &&
+               h.byte_order == kByteOrder && h.units > 0 &&
+               h.units <= (file_bytes - sizeof(Header)) / sizeof(Unit) &&
+               sizeof(Header) + h.units * sizeof(Unit) == file_bytes &&
+               h.words <= static_cast<uint64_t>(INT32_MAX);
+    };
+
+#if defined(DS_TRIE_HAVE_MMAP)
+    const int fd = ::open(path.c_str(), O_RDONLY);
+    if (fd < 0) {
+        return std::nullopt;
+    }
+    struct stat st{};
+    if (::fstat(fd, &st) != 0 || static_cast<size_t>(st.st_size) < sizeof(Header)) {
+        ::close(fd);
+        return std::nullopt;
+    }
+    const auto bytes = static_cast<size_t>(st.st_size);
+    void* map = ::mmap(nullptr, bytes, PROT_READ, MAP_SHARED, fd, 0);
+    ::close(fd); // the mapping keeps the file alive
+    if (map == MAP_FAILED) {
+        return std::nullopt;
+    }
+    Header header;
+    std::memcpy(&header, map, sizeof(header));
+    if (!valid(header, bytes)) {
+        ::munmap(map, bytes);
+        return std::nullopt;
+    }
+
+    DoubleArrayTrie dat(std::vector<Unit>{}, static_cast<int>(header.words));
+    dat.map_ = map;
+    dat.map_bytes_ = bytes;
+    dat.units_ = reinterpret_cast<const Unit*>(static_cast<const char*>(map) + sizeof(Header));
+    dat.unit_count_ = static_cast<size_t>(header.units);
+    return dat;
+#else
+    std::FILE* f = std::fopen(path.c_str(), "rb");
+    if (f == nullptr) {
+        return std::nullopt;
+    }
+    Header header;
+    long bytes = -1;
+    if (std::fseek(f, 0, SEEK_END) == 0) {
+        bytes = std::ftell(f);
+    }
+    if (bytes < static_cast<long>(sizeof(Header)) || std::fseek(f, 0, SEEK_SET) != 0 ||
+        std::fread(&header, sizeof(header), 1, f) != 1 ||
+        !valid(header, static_cast<size_t>(bytes))) {
+        std::fclose(f);
+        return std::nullopt;
+    }
+    std::vector<Unit> units(static_cast<size_t>(header.units));
+    const bool ok = std::fread(units.data(), sizeof(Unit), units.size(), f) == units.size();
+    std::fclose(f);
+    if (!ok) {
+        return std::nullopt;
+    }
+    return DoubleArrayTrie(std::move(units), static_cast<int>(header.words));
+#endif
+}
+
+void DoubleArrayTrie::release() {
+#if defined(DS_TRIE_HAVE_MMAP)
+    if (map_ != nullptr) {
+        ::munmap(map_, map_bytes_);
+    }
+#endif
+    map_ = nullptr;
+    map_bytes_ = 0;
+}
+
+uint32_t DoubleArrayTrie::code(char c) {
+    if (c >= 'a' && c <= 'z') {
+        return static_cast<uint32_t>(c - 'a') + 1;
+    }
+    return 0;
+}
+
+uint32_t DoubleArrayTrie::traverse(std::string_view key) const {
+    if (unit_count_ == 0) {
+        return kFree;
+    }
+    uint32_t s = 0;
+    for (char ch : key) {
+        const uint32_t c = code(ch);
+        const uint32_t t = (units_[s].base & kOffsetMask) + c;
+        if (c == 0 || t >= unit_count_ || units_[t].check != s) {
+            return kFree;
+        }
+        s = t;
+    }
+    return s;
+}
+
+} // namespace ds::trie
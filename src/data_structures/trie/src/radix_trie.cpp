@@ -0,0 +1,620 @@
+#include <algorithm>
+#include <data_structures/trie/radix_trie.h>
+#include <utility>
+
+namespace ds::trie {
+
+namespace {
+// Shrink thresholds sit below the grow points (5, 17, 49 children), so a node
+// hovering around one boundary does not flip between two block sizes.
+constexpr uint16_t kShrinkTo4 = 3;
+constexpr uint16_t kShrinkTo16 = 12;
+constexpr uint16_t kShrinkTo48 = 37;
+
+// Compact the arena only past this many dead bytes, so that small tries never do.
+constexpr size_t kMinCompaction = 4096;
+
+template <typename Block> uint32_t small_find(const Block& b, uint16_t count, uint8_t c) {
+    for (uint16_t i = 0; i < count; ++i) {
+        if (b.keys[i] == c) {
+            return b.child[i];
+        }
+    }
+    return 0;
+}
+
+// Insert (c, child) into a sorted small block holding `count` < capacity keys.
+template <typename Block> void small_insert(Block& b, uint16_t count, uint8_t c, uint32_t child) {
+    uint16_t pos = count;
+    while (pos > 0 && b.keys[pos - 1] > c) {
+        b.keys[pos] = b.keys[pos - 1];
+        b.child[pos] = b.child[pos - 1];
+        --pos;
+    }
+    b.keys[pos] = c;
+    b.child[pos] = child;
+}
+
+template <typename Block> void small_erase(Block& b, uint16_t count, uint8_t c) {
+    uint16_t pos = 0;
+    while (pos < count && b.keys[pos] != c) {
+        ++pos;
+    }
+    for (; pos + 1 < count; ++pos) {
+        b.keys[pos] = b.keys[pos + 1];
+        b.child[pos] = b.child[pos + 1];
+    }
+}
+
+template <typename From, typename To> void small_copy(const From& from, To& to, uint16_t count) {
+    std::copy(from.keys, from.keys + count, to.keys);
+    std::copy(from.child, from.child + count, to.child);
+}
+} // namespace
+
+// --- Pool -------------------------------------------------------------------
+
+template <typename Block> uint32_t RadixTrie::Pool<Block>::allocate() {
+    if (!free.empty()) {
+        const uint32_t b = free.back();
+        free.pop_back();
+        blocks[b] = Block{};
+        return b;
+    }
+    blocks.emplace_back();
+    return static_cast<uint32_t>(blocks.size() - 1);
+}
+
+template <typename Block> void RadixTrie::Pool<Block>::release(uint32_t b) {
+    free.push_back(b);
+}
+
+template <typename Block> size_t RadixTrie::Pool<Block>::memory_bytes() const {
+    return blocks.capacity() * sizeof(Block) + free.capacity() * sizeof(uint32_t);
+}
+
+// --- RadixTrie public API ---------------------------------------------------
+
+RadixTrie::RadixTrie() : dead_bytes_(0), word_count_(0) {
+    nodes_.reserve(256);
+    new_node(0, 0); // root is always index 0, with an empty label
+}
+
+void RadixTrie::insert(std::string_view word) {
+    // Labels are addressed with 32-bit offsets.
+    if (word.size() > UINT32_MAX - arena_.size() || search(word)) {
+        return;
+    }
+
+    uint32_t v = 0;
+    size_t i = 0;
+    nodes_[v].prefix_count++;
+
+    while (i < word.size()) {
+        const auto c = static_cast<uint8_t>(word[i]);
+        uint32_t child = find_child(nodes_[v], c);
+
+        if (child == kNone) {
+            // The rest of the word becomes one leaf edge.
+            const uint32_t begin = append_label(word.substr(i));
+            const uint32_t leaf = new_node(begin, static_cast<uint32_t>(word.size() - i));
+            nodes_[leaf].prefix_count = 1;
+            nodes_[leaf].is_end = true;
+            add_child(v, c, leaf);
+            ++word_count_;
+            return;
+        }
+
+        const std::string_view edge = label(nodes_[child]);
+        const std::string_view rest = word.substr(i);
+        const size_t limit = std::min(edge.size(), rest.size());
+        size_t m = 1; // the first byte matched through find_child
+        while (m < limit && edge[m] == rest[m]) {
+            ++m;
+        }
+
+        if (m < edge.size()) {
+            // The word leaves the edge midway: split it. Both halves keep
+            // pointing into the same arena bytes.
+            const uint32_t mid = new_node(nodes_[child].label_begin, static_cast<uint32_t>(m));
+            Node& old = nodes_[child];
+            old.label_begin += static_cast<uint32_t>(m);
+            old.label_len -= static_cast<uint32_t>(m);
+            nodes_[mid].prefix_count = old.prefix_count;
+            add_child(mid, static_cast<uint8_t>(arena_[old.label_begin]), child);
+            replace_child(v, c, mid);
+            child = mid;
+        }
+
+        nodes_[child].prefix_count++;
+        v = child;
+        i += m;
+    }
+
+    nodes_[v].is_end = true;
+    ++word_count_;
+}
+
+bool RadixTrie::search(std::string_view word) const {
+    const Locate at = locate(word);
+    if (at.node == kMissing) {
+        return false;
+    }
+    const Node& n = nodes_[at.node];
+    return at.matched == n.label_len && n.is_end;
+}
+
+bool RadixTrie::starts_with(std::string_view prefix) const {
+    return count_with_prefix(prefix) > 0;
+}
+
+bool RadixTrie::erase(std::string_view word) {
+    if (!search(word)) {
+        return false;
+    }
+
+    uint32_t parent = 0;
+    uint32_t v = 0;
+    size_t i = 0;
+    nodes_[v].prefix_count--;
+    while (i < word.size()) {
+        parent = v;
+        v = find_child(nodes_[v], static_cast<uint8_t>(word[i]));
+        i += nodes_[v].label_len;
+        nodes_[v].prefix_count--;
+    }
+    nodes_[v].is_end = false;
+    --word_count_;
+
+    if (v != 0) {
+        if (nodes_[v].prefix_count == 0) {
+            // No word left below v, so v is a leaf: drop it. Its parent may
+            // now be a pass-through node with a single child.
+            dead_bytes_ += nodes_[v].label_len;
+            remove_child(parent, static_cast<uint8_t>(arena_[nodes_[v].label_begin]));
+            free_node(v);
+            if (parent != 0 && !nodes_[parent].is_end && nodes_[parent].children == 1) {
+                merge_with_child(parent);
+            }
+        } else if (nodes_[v].children == 1) {
+            merge_with_child(v);
+        }
+    }
+
+    if (dead_bytes_ > kMinCompaction && 2 * dead_bytes_ > arena_.size()) {
+        compact_arena();
+    }
+    return true;
+}
+
+int RadixTrie::count_with_prefix(std::string_view prefix) const {
+    const Locate at = locate(prefix);
+    if (at.node == kMissing) {
+        return 0;
+    }
+    return nodes_[at.node].prefix_count;
+}
+
+std::vector<std::string> RadixTrie::words_with_prefix(std::string_view prefix) const {
+    std::vector<std::string> result;
+    const Locate at = locate(prefix);
+    if (at.node == kMissing || nodes_[at.node].prefix_count == 0) {
+        return result;
+    }
+    // The prefix may end inside the node's label: complete it.
+    std::string current(prefix);
+    current.append(label(nodes_[at.node]).substr(at.matched));
+    collect(at.node, current, result);
+    return result;
+}
+
+std::string RadixTrie::longest_prefix_of(std::string_view word) const {
+    uint32_t v = 0;
+    size_t i = 0;
+    size_t last_end = 0; // length of the longest prefix that is a word
+
+    while (i < word.size()) {
+        v = find_child(nodes_[v], static_cast<uint8_t>(word[i]));
+        if (v == kNone) {
+            break;
+        }
+        const std::string_view edge = label(nodes_[v]);
+        if (word.substr(i, edge.size()) != edge) {
+            break;
+        }
+        i += edge.size();
+        if (nodes_[v].is_end) {
+            last_end = i;
+        }
+    }
+    return std::string(word.substr(0, last_end));
+}
+
+int RadixTrie::size() const {
+    return word_count_;
+}
+
+bool RadixTrie::empty() const {
+    return word_count_ == 0;
+}
+
+void RadixTrie::clear() {
+    nodes_.clear();
+    free_nodes_.clear();
+    pool4_ = {};
+    pool16_ = {};
+    pool48_ = {};
+    pool256_ = {};
+    arena_.clear();
+    dead_bytes_ = 0;
+    word_count_ = 0;
+    nodes_.reserve(256);
+    new_node(0, 0); // recreate root
+}
+
+size_t RadixTrie::nodes() const {
+    return nodes_.size() - free_nodes_.size();
+}
+
+size_t RadixTrie::memory_bytes() const {
+    return nodes_.capacity() * sizeof(Node) + free_nodes_.capacity() * sizeof(uint32_t) +
+           pool4_.memory_bytes() + pool16_.memory_bytes() + pool48_.memory_bytes() +
+           pool256_.memory_bytes() + arena_.capacity();
+}
+
+// --- RadixTrie private helpers ----------------------------------------------
+
+uint32_t RadixTrie::new_node(uint32_t label_begin, uint32_t label_len) {
+    const Node fresh{label_begin, label_len, 0, 0, 0, Kind::Leaf, false};
+    if (!free_nodes_.empty()) {
+        const uint32_t v = free_nodes_.back();
+        free_nodes_.pop_back();
+        nodes_[v] = fresh;
+        return v;
+    }
+    nodes_.push_back(fresh);
+    return static_cast<uint32_t>(nodes_.size() - 1);
+}
+
+void RadixTrie::free_node(uint32_t v) {
+    release_block(nodes_[v]);
+    free_nodes_.push_back(v);
+}
+
+uint32_t RadixTrie::append_label(std::string_view label) {
+    const auto begin = static_cast<uint32_t>(arena_.size());
+    arena_.append(label);
+    return begin;
+}
+
+std::string_view RadixTrie::label(const Node& n) const {
+    return std::string_view(arena_).substr(n.label_begin, n.label_len);
+}
+
+uint32_t RadixTrie::find_child(const Node& n, uint8_t c) const {
+    switch (n.kind) {
+    case Kind::Leaf:
+        return kNone;
+    case Kind::N4:
+        return small_find(pool4_.blocks[n.block], n.children, c);
+    case Kind::N16:
+        return small_find(pool16_.blocks[n.block], n.children, c);
+    case Kind::N48: {
+        const Block48& b = pool48_.blocks[n.block];
+        return b.index[c] == 0 ? kNone : b.child[b.index[c] - 1];
+    }
+    case Kind::N256:
+        return pool256_.blocks[n.block].child[c];
+    }
+    return kNone;
+}
+
+void RadixTrie::add_child(uint32_t v, uint8_t c, uint32_t child) {
+    Node& n = nodes_[v];
+    switch (n.kind) {
+    case Kind::Leaf:
+        n.block = pool4_.allocate();
+        n.kind = Kind::N4;
+        small_insert(pool4_.blocks[n.block], 0, c, child);
+        break;
+    case Kind::N4:
+        if (n.children < 4) {
+            small_insert(pool4_.blocks[n.block], n.children, c, child);
+        } else {
+            const uint32_t grown = pool16_.allocate();
+            small_copy(pool4_.blocks[n.block], pool16_.blocks[grown], n.children);
+            small_insert(pool16_.blocks[grown], n.children, c, child);
+            pool4_.release(n.block);
+            n.block = grown;
+            n.kind = Kind::N16;
+        }
+        break;
+    case Kind::N16:
+        if (n.children < 16) {
+            small_insert(pool16_.blocks[n.block], n.children, c, child);
+        } else {
+            const uint32_t grown = pool48_.allocate();
+            const SmallBlock<16>& from = pool16_.blocks[n.block];
+            Block48& to = pool48_.blocks[grown];
+            for (uint16_t i = 0; i < n.children; ++i) {
+                to.child[i] = from.child[i];
+                to.index[from.keys[i]] = static_cast<uint8_t>(i + 1);
+            }
+            to.child[n.children] = child;
+            to.index[c] = static_cast<uint8_t>(n.children + 1);
+            pool16_.release(n.block);
+            n.block = grown;
+            n.kind = Kind::N48;
+        }
+        break;
+    case Kind::N48:
+        if (n.children < 48) {
+            Block48& b = pool48_.blocks[n.block];
+            uint8_t slot = 0;
+            while (b.child[slot] != kNone) {
+                ++slot;
+            }
+            b.child[slot] = child;
+            b.index[c] = static_cast<uint8_t>(slot + 1);
+        } else {
+            const uint32_t grown = pool256_.allocate();
+            const Block48& from = pool48_.blocks[n.block];
+            Block256& to = pool256_.blocks[grown];
+            for (int byte = 0; byte < 256; ++byte) {
+                if (from.index[byte] != 0) {
+                    to.child[byte] = from.child[from.index[byte] - 1];
+                }
+            }
+            to.child[c] = child;
+            pool48_.release(n.block);
+            n.block = grown;
+            n.kind = Kind::N256;
+        }
+        break;
+    case Kind::N256:
+        pool256_.blocks[n.block].child[c] = child;
+        break;
+    }
+    ++n.children;
+}
+
+void RadixTrie::replace_child(uint32_t v, uint8_t c, uint32_t child) {
+    const Node& n = nodes_[v];
+    switch (n.kind) {
+    case Kind::Leaf:
+        break;
+    case Kind::N4: {
+        SmallBlock<4>& b = pool4_.blocks[n.block];
+        for (uint16_t i = 0; i < n.children; ++i) {
+            if (b.keys[i] == c) {
+                b.child[i] = child;
+            }
+        }
+        break;
+    }
+    case Kind::N16: {
+        SmallBlock<16>& b = pool16_.blocks[n.block];
+        for (uint16_t i = 0; i < n.children; ++i) {
+            if (b.keys[i] == c) {
+                b.child[i] = child;
+            }
+        }
+        break;
+    }
+    case Kind::N48: {
+        Block48& b = pool48_.blocks[n.block];
+        b.child[b.index[c] - 1] = child;
+        break;
+    }
+    case Kind::N256:
+        pool256_.blocks[n.block].child[c] = child;
+        break;
+    }
+}
+
+void RadixTrie::remove_child(uint32_t v, uint8_t c) {
+    Node& n = nodes_[v];
+    switch (n.kind) {
+    case Kind::Leaf:
+        return;
+    case Kind::N4:
+        small_erase(pool4_.blocks[n.block], n.children, c);
+        --n.children;
+        if (n.children == 0) {
+            pool4_.release(n.block);
+            n.kind = Kind::Leaf;
+        }
+        return;
+    case Kind::N16:
+        small_erase(pool16_.blocks[n.block], n.children, c);
+        --n.children;
+        if (n.children == kShrinkTo4) {
+            const uint32_t shrunk = pool4_.allocate();
+            small_copy(pool16_.blocks[n.block], pool4_.blocks[shrunk], n.children);
+            pool16_.release(n.block);
+            n.block = shrunk;
+            n.kind = Kind::N4;
+        }
+        return;
+    case Kind::N48: {
+        Block48& b = pool48_.blocks[n.block];
+        b.child[b.index[c] - 1] = kNone;
+        b.index[c] = 0;
+        --n.children;
+        if (n.children == kShrinkTo16) {
+            const uint32_t shrunk = pool16_.allocate();
+            const Block48& from = pool48_.blocks[n.block];
+            SmallBlock<16>& to = pool16_.blocks[shrunk];
+            uint16_t k = 0;
+            for (int byte = 0; byte < 256; ++byte) {
+                if (from.index[byte] != 0) {
+                    to.keys[k] = static_cast<uint8_t>(byte);
+                    to.child[k] = from.child[from.index[byte] - 1];
+                    ++k;
+                }
+            }
+            pool48_.release(n.block);
+            n.block = shrunk;
+            n.kind = Kind::N16;
+        }
+        return;
+    }
+    case Kind::N256:
+        pool256_.blocks[n.block].child[c] = kNone;
+        --n.children;
+        if (n.children == kShrinkTo48) {
+            const uint32_t shrunk = pool48_.allocate();
+            const Block256& from = pool256_.blocks[n.block];
+            Block48& to = pool48_.blocks[shrunk];
+            uint8_t slot = 0;
+            for (int byte = 0; byte < 256; ++byte) {
+                if (from.child[byte] != kNone) {
+                    to.child[slot] = from.child[byte];
+                    to.index[byte] = static_cast<uint8_t>(slot + 1);
+                    ++slot;
+                }
+            }
+            pool256_.release(n.block);
+            n.block = shrunk;
+            n.kind = Kind::N48;
+        }
+        return;
+    }
+}
+
+uint32_t RadixTrie::first_child(const Node& n) const {
+    uint32_t first = kNone;
+    for_each_child(n, [&](uint32_t child) {
+        if (first == kNone) {
+            first = child;
+        }
+    });
+    return first;
+}
+
+void RadixTrie::release_block(const Node& n) {
+    switch (n.kind) {
+    case Kind::Leaf:
+        break;
+    case Kind::N4:
+        pool4_.release(n.block);
+        break;
+    case Kind::N16:
+        pool16_.release(n.block);
+        break;
+    case Kind::N48:
+        pool48_.release(n.block);
+        break;
+    case Kind::N256:
+        pool256_.release(n.block);
+        break;
+    }
+}
+
+template <typename F> void RadixTrie::for_each_child(const Node& n, F&& f) const {
+    switch (n.kind) {
+    case Kind::Leaf:
+        break;
+    case Kind::N4:
+        std::for_each(pool4_.blocks[n.block].child, pool4_.blocks[n.block].child + n.children, f);
+        break;
+    case Kind::N16:
+        std::for_each(pool16_.blocks[n.block].child, pool16_.blocks[n.block].child + n.children,
+                      f);
+        break;
+    case Kind::N48: {
+        const Block48& b = pool48_.blocks[n.block];
+        for (int byte = 0; byte < 256; ++byte) {
+            if (b.index[byte] != 0) {
+                f(b.child[b.index[byte] - 1]);
+            }
+        }
+        break;
+    }
+    case Kind::N256:
+        for (uint32_t child : pool256_.blocks[n.block].child) {
+            if (child != kNone) {
+                f(child);
+            }
+        }
+        break;
+    }
+}
+
+RadixTrie::Locate RadixTrie::locate(std::string_view key) const {
+    uint32_t v = 0;
+    size_t i = 0;
+    while (true) {
+        const std::string_view edge = label(nodes_[v]);
+        const size_t take = std::min(edge.size(), key.size() - i);
+        if (edge.substr(0, take) != key.substr(i, take)) {
+            return {kMissing, 0};
+        }
+        i += take;
+        if (i == key.size()) {
+            return {v, static_cast<uint32_t>(take)};
+        }
+        v = find_child(nodes_[v], static_cast<uint8_t>(key[i]));
+        if (v == kNone) {
+            return {kMissing, 0};
+        }
+    }
+}
+
+void RadixTrie::merge_with_child(uint32_t v) {
+    const uint32_t c = first_child(nodes_[v]);
+    const Node child = nodes_[c];
+    Node& n = nodes_[v];
+
+    if (n.label_begin + n.label_len == child.label_begin) {
+        // Still adjacent in the arena (e.g. the two halves of an old split).
+        n.label_len += child.label_len;
+    } else {
+        std::string joined(label(n));
+        joined.append(label(child));
+        dead_bytes_ += joined.size();
+        n.label_begin = append_label(joined);
+        n.label_len = static_cast<uint32_t>(joined.size());
+    }
+
+    // v takes over the child's children and end flag; prefix counts are equal.
+    release_block(n);
+    n.block = child.block;
+    n.children = child.children;
+    n.kind = child.kind;
+    n.is_end = child.is_end;
+    free_nodes_.push_back(c);
+}
+
+void RadixTrie::compact_arena() {
+    std::string fresh;
+    fresh.reserve(arena_.size() - dead_bytes_);
+    std::vector<uint32_t> stack{0};
+    while (!stack.empty()) {
+        const uint32_t v = stack.back();
+        stack.pop_back();
+        Node& n = nodes_[v];
+        const auto begin = static_cast<uint32_t>(fresh.size());
+        fresh.append(label(n));
+        n.label_begin = begin;
+        for_each_child(n, [&](uint32_t child) { stack.push_back(child); });
+    }
+    arena_ = std::move(fresh);
+    dead_bytes_ = 0;
+}
+
+void RadixTrie::collect(uint32_t v, std::string& current,
+                        std::vector<std::string>& result) const {
+    const Node& n = nodes_[v];
+    if (n.is_end) {
+        result.push_back(current);
+    }
+    for_each_child(n, [&](uint32_t child) {
+        const std::string_view edge = label(nodes_[child]);
+        current.append(edge);
+        collect(child, current, result);
+        current.erase(current.size() - edge.size());
+    });
+}
+
+} // namespace ds::trie
@@ -1,8 +1,49 @@
 #include <algorithm>
+#include <bit>
 #include <data_structures/trie/trie.h>
+#include <utility>
 
 namespace ds::trie {
 
+namespace {
+// Mask of the low i bits, 0 <= i <= 64.
+uint64_t low_bits(int i) {
+    return i >= 64 ? ~uint64_t{0} : (uint64_t{1} << i) - 1;
+}
+
+// Entry i of an edit-distance column whose top entry is j and whose bit r
+// (r < i) holds the +1 / -1 step from entry r to entry r + 1.
+int column_entry(uint64_t vp, uint64_t vn, int j, int i) {
+    return j + std::popcount(vp & low_bits(i)) - std::popcount(vn & low_bits(i));
+}
+
+// Minimum of the column entries that can be <= k. Entry i is at least |i - j|,
+// so only the band i in [j - k, j + k] needs to be scanned.
+int band_min(uint64_t vp, uint64_t vn, int j, int m, int k) {
+    const int lo = std::max(0, j - k);
+    const int hi = std::min(m, j + k);
+    if (lo > hi) {
+        return k + 1;
+    }
+    int d = column_entry(vp, vn, j, lo);
+    int best = d;
+    for (int i = lo; i < hi; ++i) {
+        d += static_cast<int>((vp >> i) & 1) - static_cast<int>((vn >> i) & 1);
+        best = std::min(best, d);
+    }
+    return best;
+}
+} // namespace
+
+struct Trie::FuzzyQuery {
+    std::string_view word;
+    int k;
+    uint64_t peq[ALPHABET_SIZE]; // bit i set iff word[i] is that letter
+    std::vector<int> rows;       // fuzzy_rows: one row of |word| + 1 entries per depth
+    std::string current;
+    std::vector<std::pair<std::string, int>> result;
+};
+
 // --- Node -------------------------------------------------------------------
 
 Trie::Node::Node() : prefix_count(0), is_end(false) {
@@ -17,38 +58,19 @@ Trie::Trie() : word_count_(0) {
 }
 
 void Trie::insert(std::string_view word) {
-    // Check for invalid characters before modifying the trie.
-    for (char c : word) {
-        if (char_to_idx(c) < 0) {
-            return; // invalid character — reject silently
-        }
-    }
-
-    int cur = 0; // root
-    nodes_[cur].prefix_count++;
+    insert_word(word, std::nullopt);
+}
 
-    for (char c : word) {
-        int idx = char_to_idx(c);
-        if (nodes_[cur].children[idx] == -1) {
-            nodes_[cur].children[idx] = new_node();
-        }
-        cur = nodes_[cur].children[idx];
-        nodes_[cur].prefix_count++;
-    }
+void Trie::insert(std::string_view word, int64_t score) {
+    insert_word(word, score);
+}
 
-    if (!nodes_[cur].is_end) {
-        nodes_[cur].is_end = true;
-        ++word_count_;
-    } else {
-        // Word already exists — undo the prefix_count increments.
-        cur = 0;
-        nodes_[cur].prefix_count--;
-        for (char c : word) {
-            int idx = char_to_idx(c);
-            cur = nodes_[cur].children[idx];
-            nodes_[cur].prefix_count--;
-        }
+std::optional<int64_t> Trie::score(std::string_view word) const {
+    int node = traverse(word);
+    if (node == -1 || !nodes_[node].is_end) {
+        return std::nullopt;
     }
+    return weights_[node].score;
 }
 
 bool Trie::search(std::string_view word) const {
@@ -75,7 +97,9 @@ bool Trie::erase(std::string_view word) {
         nodes_[cur].prefix_count--;
     }
     nodes_[cur].is_end = false;
+    weights_[cur].score = NO_SCORE;
     --word_count_;
+    refresh_best(word);
     return true;
 }
 
@@ -99,6 +123,97 @@ std::vector<std::string> Trie::words_with_prefix(std::string_view prefix) const
     return result;
 }
 
+std::span<const Trie::Completion> Trie::CompletionBuffer::results() const {
+    return results_;
+}
+
+void Trie::top_k_with_prefix(std::string_view prefix, int k, CompletionBuffer& buffer) const {
+    buffer.results_.clear();
+    buffer.spans_.clear();
+    buffer.words_.clear();
+    buffer.records_.clear();
+    buffer.heap_.clear();
+
+    const int start = traverse(prefix);
+    if (k <= 0 || start == -1 || weights_[start].best == NO_SCORE) {
+        return;
+    }
+
+    // Max-heap on score. At equal scores a finished word pops before a
+    // subtree, so ties do not expand more nodes than needed.
+    using Entry = CompletionBuffer::Entry;
+    auto lower = [](const Entry& a, const Entry& b) {
+        if (a.score != b.score) {
+            return a.score < b.score;
+        }
+        if (a.word != b.word) {
+            return !a.word;
+        }
+        return a.record > b.record;
+    };
+    auto push = [&](Entry e) {
+        buffer.heap_.push_back(e);
+        std::push_heap(buffer.heap_.begin(), buffer.heap_.end(), lower);
+    };
+
+    // An entry's best score bounds every word below it, so the words come out
+    // in score order and a subtree is opened only if it holds one of the k best.
+    buffer.records_.push_back({start, -1, '\0'});
+    push({weights_[start].best, 0, false});
+    while (!buffer.heap_.empty() && static_cast<int>(buffer.spans_.size()) < k) {
+        std::pop_heap(buffer.heap_.begin(), buffer.heap_.end(), lower);
+        const Entry e = buffer.heap_.back();
+        buffer.heap_.pop_back();
+
+        if (e.word) {
+            // Spell the word: prefix, then the edge characters up from the node.
+            size_t depth = 0;
+            for (int r = e.record; buffer.records_[r].parent != -1; r = buffer.records_[r].parent) {
+                ++depth;
+            }
+            const size_t offset = buffer.words_.size();
+            buffer.words_.append(prefix);
+            buffer.words_.append(depth, '\0');
+            size_t pos = buffer.words_.size();
+            for (int r = e.record; buffer.records_[r].parent != -1; r = buffer.records_[r].parent) {
+                buffer.words_[--pos] = buffer.records_[r].ch;
+            }
+            buffer.spans_.push_back({offset, prefix.size() + depth, e.score});
+            continue;
+        }
+
+        const int node = buffer.records_[e.record].node;
+        if (nodes_[node].is_end) {
+            push({weights_[node].score, e.record, true});
+        }
+        for (int i = 0; i < ALPHABET_SIZE; ++i) {
+            const int child = nodes_[node].children[i];
+            if (child != -1 && weights_[child].best != NO_SCORE) {
+                buffer.records_.push_back({child, e.record, static_cast<char>('a' + i)});
+                push({weights_[child].best, static_cast<int>(buffer.records_.size()) - 1, false});
+            }
+        }
+    }
+
+    // words_ no longer grows: the views can be taken now.
+    const std::string_view words(buffer.words_);
+    for (const auto& span : buffer.spans_) {
+        buffer.results_.push_back({words.substr(span.offset, span.length), span.score});
+    }
+}
+
+std::vector<std::pair<std::string, int64_t>> Trie::top_k_with_prefix(std::string_view prefix,
+                                                                     int k) const {
+    CompletionBuffer buffer;
+    top_k_with_prefix(prefix, k, buffer);
+    std::vector<std::pair<std::string, int64_t>> result;
+    result.reserve(buffer.results().size());
+    for (const auto& c : buffer.results()) {
+        result.emplace_back(std::string(c.word), c.score);
+    }
+    return result;
+}
+
 std::string Trie::longest_prefix_of(std::string_view word) const {
     int cur = 0;
     int last_end = -1; // length of the longest prefix that is a word
@@ -120,6 +235,32 @@ std::string Trie::longest_prefix_of(std::string_view word) const {
     return std::string(word.substr(0, last_end));
 }
 
+std::vector<std::pair<std::string, int>> Trie::search_within_distance(std::string_view word,
+                                                                      int k) const {
+    if (k < 0) {
+        return {};
+    }
+    FuzzyQuery q{word, k, {}, {}, {}, {}};
+    const int m = static_cast<int>(word.size());
+    if (m >= 1 && m <= 64) {
+        for (int i = 0; i < m; ++i) {
+            const int idx = char_to_idx(word[static_cast<size_t>(i)]);
+            if (idx >= 0) {
+                q.peq[idx] |= uint64_t{1} << i;
+            }
+        }
+        // Column 0 is 0, 1, ..., m: every step is +1.
+        fuzzy_bit_parallel(q, 0, low_bits(m), 0);
+    } else {
+        q.rows.resize(word.size() + 1);
+        for (int i = 0; i <= m; ++i) {
+            q.rows[static_cast<size_t>(i)] = i;
+        }
+        fuzzy_rows(q, 0);
+    }
+    return std::move(q.result);
+}
+
 int Trie::size() const {
     return word_count_;
 }
@@ -130,18 +271,220 @@ bool Trie::empty() const {
 
 void Trie::clear() {
     nodes_.clear();
+    weights_.clear();
     word_count_ = 0;
     nodes_.reserve(256);
     new_node(); // recreate root
 }
 
+size_t Trie::memory_bytes() const {
+    return nodes_.capacity() * sizeof(Node) + weights_.capacity() * sizeof(Weight);
+}
+
+DoubleArrayTrie Trie::freeze() const {
+    using Unit = DoubleArrayTrie::Unit;
+    constexpr uint32_t kFree = DoubleArrayTrie::kFree;
+
+    // Free slots form a doubly linked list in ascending order, so placing a
+    // state only visits slots that are still free.
+    std::vector<Unit> units;
+    std::vector<int> next_free, prev_free;
+    int free_head = -1;
+    auto grow = [&](size_t size) {
+        const size_t old = units.size();
+        if (size <= old) {
+            return;
+        }
+        units.resize(size, Unit{0, kFree});
+        next_free.resize(size);
+        prev_free.resize(size);
+        int tail = free_head < 0 ? -1 : prev_free[static_cast<size_t>(free_head)];
+        for (size_t i = old; i < size; ++i) {
+            const int slot = static_cast<int>(i);
+            if (tail < 0) {
+                free_head = slot;
+            } else {
+                next_free[static_cast<size_t>(tail)] = slot;
+            }
+            prev_free[i] = tail;
+            tail = slot;
+        }
+        // Close the circle: head.prev = tail, tail.next = head.
+        next_free[static_cast<size_t>(tail)] = free_head;
+        prev_free[static_cast<size_t>(free_head)] = tail;
+    };
+    auto take = [&](int slot) {
+        const auto i = static_cast<size_t>(slot);
+        if (next_free[i] == slot) {
+            free_head = -1;
+            return;
+        }
+        next_free[static_cast<size_t>(prev_free[i])] = next_free[i];
+        prev_free[static_cast<size_t>(next_free[i])] = prev_free[i];
+        if (free_head == slot) {
+            free_head = next_free[i];
+        }
+    };
+
+    grow(ALPHABET_SIZE + 1);
+    take(0); // the root
+    units[0].check = 0;
+
+    // Depth-first, so that a chain of single-child states lands in consecutive slots.
+    std::vector<std::pair<int, uint32_t>> stack{{0, 0}}; // (trie node, state)
+    std::vector<std::pair<uint32_t, int>> kids;          // (code, trie node)
+    while (!stack.empty()) {
+        const auto [node, state] = stack.back();
+        stack.pop_back();
+        const Node& n = nodes_[node];
+        if (n.is_end) {
+            units[state].base |= DoubleArrayTrie::kEnd;
+        }
+
+        kids.clear();
+        for (int i = 0; i < ALPHABET_SIZE; ++i) {
+            const int child = n.children[i];
+            if (child != -1 && nodes_[child].prefix_count > 0) {
+                kids.emplace_back(static_cast<uint32_t>(i) + 1, child);
+            }
+        }
+        if (kids.empty()) {
+            continue;
+        }
+
+        // A base whose slots base + code are all free: next to the parent if
+        // possible, else the first child goes into the lowest free slot that
+        // works, else fresh slots are opened at the end.
+        const uint32_t first = kids.front().first;
+        auto fits = [&](uint32_t base) {
+            for (const auto& kid : kids) {
+                const size_t t = base + kid.first;
+                if (t < units.size() && units[t].check != kFree) {
+                    return false;
+                }
+            }
+            return true;
+        };
+        auto base = static_cast<uint32_t>(units.size()) - first;
+        if (state + 1 >= first && fits(state + 1 - first)) {
+            // Right after the parent: chains of single-child states (the tails of
+            // long keys) then sit in consecutive units and share cache lines.
+            base = state + 1 - first;
+        } else if (free_head >= 0) {
+            int slot = free_head;
+            do {
+                const auto at = static_cast<uint32_t>(slot);
+                if (at >= first && fits(at - first)) {
+                    base = at - first;
+                    break;
+                }
+                slot = next_free[static_cast<size_t>(slot)];
+            } while (slot != free_head);
+        }
+        grow(base + kids.back().first + 1);
+
+        units[state].base |= base;
+        for (const auto& [c, child] : kids) {
+            const uint32_t t = base + c;
+            take(static_cast<int>(t));
+            units[t].check = state;
+            stack.emplace_back(child, t);
+        }
+    }
+
+    // Trim free slots after the last state; transitions are bounds-checked.
+    size_t used = units.size();
+    while (used > 1 && units[used - 1].check == kFree) {
+        --used;
+    }
+    units.resize(used);
+    units.shrink_to_fit();
+    return DoubleArrayTrie(std::move(units), word_count_);
+}
+
 // --- Trie private helpers ---------------------------------------------------
 
 int Trie::new_node() {
     nodes_.emplace_back();
+    weights_.push_back({NO_SCORE, NO_SCORE});
     return static_cast<int>(nodes_.size()) - 1;
 }
 
+void Trie::insert_word(std::string_view word, std::optional<int64_t> score) {
+    // Check for invalid characters before modifying the trie.
+    for (char c : word) {
+        if (char_to_idx(c) < 0) {
+            return; // invalid character — reject silently
+        }
+    }
+
+    int cur = 0; // root
+    nodes_[cur].prefix_count++;
+
+    for (char c : word) {
+        int idx = char_to_idx(c);
+        if (nodes_[cur].children[idx] == -1) {
+            int child = new_node();
+            nodes_[cur].children[idx] = child;
+        }
+        cur = nodes_[cur].children[idx];
+        nodes_[cur].prefix_count++;
+    }
+
+    const bool is_new = !nodes_[cur].is_end;
+    if (is_new) {
+        nodes_[cur].is_end = true;
+        ++word_count_;
+    } else {
+        // Word already exists — undo the prefix_count increments.
+        cur = 0;
+        nodes_[cur].prefix_count--;
+        for (char c : word) {
+            int idx = char_to_idx(c);
+            cur = nodes_[cur].children[idx];
+            nodes_[cur].prefix_count--;
+        }
+        if (!score) {
+            return;
+        }
+    }
+
+    const int64_t old_score = weights_[cur].score;
+    // INT64_MIN is reserved for NO_SCORE.
+    const int64_t new_score = std::max(score.value_or(0), NO_SCORE + 1);
+    weights_[cur].score = new_score;
+    if (!is_new && new_score < old_score) {
+        refresh_best(word); // the old score may have been some ancestor's best
+        return;
+    }
+
+    // A higher score can only raise the bests along the path.
+    cur = 0;
+    weights_[cur].best = std::max(weights_[cur].best, new_score);
+    for (char c : word) {
+        cur = nodes_[cur].children[char_to_idx(c)];
+        weights_[cur].best = std::max(weights_[cur].best, new_score);
+    }
+}
+
+void Trie::refresh_best(std::string_view word) {
+    std::vector<int> path{0};
+    path.reserve(word.size() + 1);
+    for (char c : word) {
+        path.push_back(nodes_[path.back()].children[char_to_idx(c)]);
+    }
+    for (auto it = path.rbegin(); it != path.rend(); ++it) {
+        const Node& n = nodes_[*it];
+        int64_t best = n.is_end ? weights_[*it].score : NO_SCORE;
+        for (int child : n.children) {
+            if (child != -1) {
+                best = std::max(best, weights_[child].best);
+            }
+        }
+        weights_[*it].best = best;
+    }
+}
+
 int Trie::char_to_idx(char c) {
     if (c >= 'a' && c <= 'z') {
         return c - 'a';
@@ -175,4 +518,72 @@ void Trie::collect(int node_idx, std::string& current, std::vector<std::string>&
     }
 }
 
+void Trie::fuzzy_bit_parallel(FuzzyQuery& q, int node, uint64_t vp, uint64_t vn) const {
+    const int m = static_cast<int>(q.word.size());
+    const int j = static_cast<int>(q.current.size());
+    if (nodes_[node].is_end) {
+        const int d = column_entry(vp, vn, j, m);
+        if (d <= q.k) {
+            q.result.emplace_back(q.current, d);
+        }
+    }
+
+    for (int i = 0; i < ALPHABET_SIZE; ++i) {
+        const int child = nodes_[node].children[i];
+        if (child == -1) {
+            continue;
+        }
+        // Hyyrö's column step for edit distance. Bits above m hold garbage,
+        // but carries and shifts only move upwards, so they never reach the
+        // low m bits.
+        const uint64_t eq = q.peq[i];
+        const uint64_t xv = eq | vn;
+        const uint64_t xh = (((eq & vp) + vp) ^ vp) | eq;
+        uint64_t hp = vn | ~(xh | vp);
+        uint64_t hn = vp & xh;
+        hp = (hp << 1) | 1; // the top entry of every column grows by one
+        hn <<= 1;
+        const uint64_t next_vp = hn | ~(xv | hp);
+        const uint64_t next_vn = hp & xv;
+
+        if (band_min(next_vp, next_vn, j + 1, m, q.k) <= q.k) {
+            q.current.push_back(static_cast<char>('a' + i));
+            fuzzy_bit_parallel(q, child, next_vp, next_vn);
+            q.current.pop_back();
+        }
+    }
+}
+
+void Trie::fuzzy_rows(FuzzyQuery& q, int node) const {
+    const size_t width = q.word.size() + 1;
+    const size_t prev = q.rows.size() - width;
+    if (nodes_[node].is_end && q.rows[prev + width - 1] <= q.k) {
+        q.result.emplace_back(q.current, q.rows[prev + width - 1]);
+    }
+
+    for (int i = 0; i < ALPHABET_SIZE; ++i) {
+        const int child = nodes_[node].children[i];
+        if (child == -1) {
+            continue;
+        }
+        const char c = static_cast<char>('a' + i);
+        q.rows.resize(prev + 2 * width);
+        const size_t next = prev + width;
+        q.rows[next] = q.rows[prev] + 1;
+        int best = q.rows[next];
+        for (size_t r = 1; r < width; ++r) {
+            const int substitute = q.rows[prev + r - 1] + (q.word[r - 1] == c ? 0 : 1);
+            q.rows[next + r] =
+                std::min({q.rows[prev + r] + 1, q.rows[next + r - 1] + 1, substitute});
+            best = std::min(best, q.rows[next + r]);
+        }
+        if (best <= q.k) {
+            q.current.push_back(c);
+            fuzzy_rows(q, child);
+            q.current.pop_back();
+        }
+        q.rows.resize(next);
+    }
+}
+
 } // namespace ds::trie
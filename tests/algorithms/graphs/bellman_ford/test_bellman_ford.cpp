@@ -1,6 +1,7 @@
 #include "algorithms/graphs/bellman_ford/bellman_ford.h"
 
 #include <gtest/gtest.h>
+#include <random>
 
 using namespace algorithms::graphs::bellman_ford;
 
@@ -70,3 +71,24 @@ TEST(BellmanFord, OutOfRangeSourceReturnsEmpty) {
     EXPECT_TRUE(res.parent.empty());
     EXPECT_FALSE(res.has_negative_cycle);
 }
+
+TEST(BellmanFord, CsrGraphMatchesAdjacencyList) {
+    std::mt19937 rng(8);
+    std::uniform_int_distribution<int32_t> weight(-20, 100);
+    for (int round = 0; round < 6; ++round) {
+        const int32_t n = 80;
+        Graph g(n);
+        for (int i = 0; i < 300; ++i) {
+            g[rng() % n].push_back({static_cast<int32_t>(rng() % n), weight(rng)});
+        }
+        const CsrGraph csr = algorithms::graphs::csr_graph::csr_from_adjacency(g);
+
+        for (int32_t s : {0, 40, 80}) {
+            const auto a = bellman_ford(g, s);
+            const auto b = bellman_ford(csr, s);
+            EXPECT_EQ(a.has_negative_cycle, b.has_negative_cycle);
+            EXPECT_EQ(a.dist, b.dist);
+            EXPECT_EQ(a.parent, b.parent);
+        }
+    }
+}
@@ -0,0 +1,185 @@
+#include <algorithm>
+#include <algorithms/graphs/bfs/bfs.h>
+#include <algorithms/graphs/csr_graph/csr_graph.h>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+namespace {
+using algorithms::graphs::bfs::AdjList;
+using algorithms::graphs::bfs::bfs_direction_optimizing;
+using algorithms::graphs::bfs::bfs_forest;
+using algorithms::graphs::bfs::bfs_from;
+using algorithms::graphs::bfs::bfs_order_from;
+using algorithms::graphs::bfs::BfsResult;
+using algorithms::graphs::bfs::DirectionParams;
+using algorithms::graphs::csr_graph::csr_from_adjacency;
+using algorithms::graphs::csr_graph::transpose;
+
+AdjList random_graph(int32_t n, int32_t m, unsigned seed) {
+    std::mt19937 rng(seed);
+    AdjList g(static_cast<size_t>(n));
+    for (int32_t i = 0; i < m; ++i) {
+        const auto u = static_cast<int32_t>(rng() % static_cast<unsigned>(n));
+        const auto v = static_cast<int32_t>(rng() % static_cast<unsigned>(n));
+        g[static_cast<size_t>(u)].push_back(v);
+    }
+    return g;
+}
+
+// Check a direction-optimizing result against plain BFS: same distances, parents
+// one level up with an arc to the child, order grouped by level.
+void expect_valid_bfs(const AdjList& g, const BfsResult& ref, const BfsResult& res) {
+    ASSERT_EQ(res.dist, ref.dist);
+    ASSERT_EQ(res.order.size(), ref.order.size());
+    EXPECT_EQ(res.order.front(), ref.order.front());
+    EXPECT_EQ(res.parent[static_cast<size_t>(res.order.front())], -1);
+    for (size_t i = 1; i < res.order.size(); ++i) {
+        const int32_t v = res.order[i];
+        const auto sv = static_cast<size_t>(v);
+        EXPECT_GE(res.dist[sv], res.dist[static_cast<size_t>(res.order[i - 1])]);
+        const int32_t p = res.parent[sv];
+        ASSERT_GE(p, 0);
+        EXPECT_EQ(res.dist[static_cast<size_t>(p)], res.dist[sv] - 1);
+        const auto& arcs = g[static_cast<size_t>(p)];
+        EXPECT_NE(std::find(arcs.begin(), arcs.end(), v), arcs.end());
+    }
+    for (size_t v = 0; v < res.dist.size(); ++v) {
+        if (res.dist[v] == -1) {
+            EXPECT_EQ(res.parent[v], -1);
+        }
+    }
+}
+
+AdjList symmetrize(const AdjList& g) {
+    AdjList s = g;
+    for (size_t u = 0; u < g.size(); ++u) {
+        for (int32_t v : g[u]) {
+            s[static_cast<size_t>(v)].push_back(static_cast<int32_t>(u));
+        }
+    }
+    return s;
+}
+} // namespace
+
+TEST(BFS, DistancesParentsAndOrder) {
+    AdjList g(6);
+    g[0] = {1, 2};
+    g[1] = {3};
+    g[2] = {3, 4};
+    g[4] = {0};
+
+    const auto res = bfs_from(g, 0);
+    EXPECT_EQ(res.order, (std::vector<int32_t>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(res.dist, (std::vector<int32_t>{0, 1, 1, 2, 2, -1}));
+    EXPECT_EQ(res.parent, (std::vector<int32_t>{-1, 0, 0, 1, 2, -1}));
+    EXPECT_EQ(bfs_order_from(g, 0), res.order);
+}
+
+TEST(BFS, OutOfRangeStartAndInvalidEdges) {
+    AdjList g = {{1, 7, -1}, {}};
+    EXPECT_TRUE(bfs_from(g, 2).order.empty());
+    EXPECT_TRUE(bfs_from(g, -1).dist.empty());
+    EXPECT_EQ(bfs_from(g, 0).order, (std::vector<int32_t>{0, 1}));
+}
+
+TEST(BFS, ForestCoversDisconnectedGraph) {
+    AdjList g(5);
+    g[0] = {1};
+    g[3] = {2, 4};
+
+    const auto f = bfs_forest(g);
+    EXPECT_EQ(f.order, (std::vector<int32_t>{0, 1, 2, 3, 4}));
+    EXPECT_EQ(f.parent, (std::vector<int32_t>{-1, 0, -1, -1, 3}));
+    EXPECT_EQ(f.dist, (std::vector<int32_t>{0, 1, 0, 0, 1}));
+}
+
+TEST(BFS, CsrGraphMatchesAdjList) {
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        const AdjList g = random_graph(300, 600, seed);
+        const auto csr = csr_from_adjacency(g);
+
+        for (int32_t s : {0, 17, 299, 300}) {
+            const auto a = bfs_from(g, s);
+            const auto b = bfs_from(csr, s);
+            EXPECT_EQ(a.order, b.order);
+            EXPECT_EQ(a.dist, b.dist);
+            EXPECT_EQ(a.parent, b.parent);
+            EXPECT_EQ(bfs_order_from(g, s), bfs_order_from(csr, s));
+        }
+        const auto fa = bfs_forest(g);
+        const auto fb = bfs_forest(csr);
+        EXPECT_EQ(fa.order, fb.order);
+        EXPECT_EQ(fa.dist, fb.dist);
+        EXPECT_EQ(fa.parent, fb.parent);
+    }
+}
+
+TEST(BFS, DirectionOptimizingMatchesPlainBfs) {
+    // alpha 1 stays top-down almost always; 1000 goes bottom-up at once; beta 1000
+    // then stays bottom-up, beta 1 switches back as soon as the frontier shrinks.
+    const DirectionParams params[] = {{}, {1, 18}, {1000, 1}, {1000, 1000}};
+    for (unsigned seed = 1; seed <= 6; ++seed) {
+        for (int32_t m : {300, 1500, 6000}) {
+            const AdjList directed = random_graph(400, m, seed);
+            const AdjList undirected = symmetrize(directed);
+            const auto csr = csr_from_adjacency(directed);
+            const auto csr_t = transpose(csr);
+            const auto csr_u = csr_from_adjacency(undirected);
+
+            for (int32_t s : {0, 123, 399}) {
+                const auto ref = bfs_from(directed, s);
+                const auto ref_u = bfs_from(undirected, s);
+                for (const auto& p : params) {
+                    const auto res = bfs_direction_optimizing(directed, s, p);
+                    expect_valid_bfs(directed, ref, res);
+
+                    // All overloads agree exactly.
+                    const auto res_csr = bfs_direction_optimizing(csr, csr_t, s, p);
+                    EXPECT_EQ(res_csr.order, res.order);
+                    EXPECT_EQ(res_csr.parent, res.parent);
+                    EXPECT_EQ(bfs_direction_optimizing(csr, s, p).parent, res.parent);
+
+                    // Undirected: the graph is its own transpose.
+                    const auto res_u = bfs_direction_optimizing(csr_u, csr_u, s, p);
+                    expect_valid_bfs(undirected, ref_u, res_u);
+                    EXPECT_EQ(bfs_direction_optimizing(undirected, undirected, s, p).order,
+                              res_u.order);
+                }
+            }
+        }
+    }
+}
+
+TEST(BFS, DirectionOptimizingBottomUpOrder) {
+    // A star: from the hub, the bottom-up step finds the leaves in id order
+    // whatever the order of the hub's arcs.
+    AdjList g(6);
+    g[0] = {5, 3, 1, 4, 2};
+    for (int32_t v = 1; v < 6; ++v) {
+        g[static_cast<size_t>(v)] = {0};
+    }
+    const auto top_down = bfs_direction_optimizing(g, g, 0, {1, 18});
+    EXPECT_EQ(top_down.order, (std::vector<int32_t>{0, 5, 3, 1, 4, 2}));
+    const auto bottom_up = bfs_direction_optimizing(g, g, 0, {1000, 18});
+    EXPECT_EQ(bottom_up.order, (std::vector<int32_t>{0, 1, 2, 3, 4, 5}));
+    EXPECT_EQ(bottom_up.dist, (std::vector<int32_t>{0, 1, 1, 1, 1, 1}));
+    EXPECT_EQ(bottom_up.parent, (std::vector<int32_t>{-1, 0, 0, 0, 0, 0}));
+}
+
+TEST(BFS, DirectionOptimizingInvalidInput) {
+    AdjList g = {{1, 7, -1}, {0}, {}};
+    EXPECT_TRUE(bfs_direction_optimizing(g, 3).order.empty());
+    EXPECT_TRUE(bfs_direction_optimizing(g, -1).dist.empty());
+    EXPECT_TRUE(bfs_direction_optimizing(g, AdjList(2), 0).order.empty()); // wrong gt size
+    EXPECT_TRUE(bfs_direction_optimizing(csr_from_adjacency(g), 5).order.empty());
+
+    // Invalid arcs are ignored in both directions.
+    const AdjList gt = {{1, -4}, {0, 9}, {}};
+    for (int32_t alpha : {1, 1000}) {
+        const auto res = bfs_direction_optimizing(g, gt, 0, {alpha, 18});
+        EXPECT_EQ(res.order, (std::vector<int32_t>{0, 1}));
+        EXPECT_EQ(res.dist, (std::vector<int32_t>{0, 1, -1}));
+    }
+}
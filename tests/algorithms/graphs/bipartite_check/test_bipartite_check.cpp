@@ -1,6 +1,8 @@
 #include "algorithms/graphs/bipartite_check/bipartite.h"
 
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <gtest/gtest.h>
+#include <random>
 
 using namespace algorithms::graphs::bipartite_check;
 
@@ -112,3 +114,24 @@ TEST(BipartiteCheck, RandomBipartiteAndNonBipartite) {
     EXPECT_FALSE(bipartite_bfs(g).has_value());
     EXPECT_FALSE(bipartite_dfs(g).has_value());
 }
+
+TEST(BipartiteCheck, CsrGraphMatchesAdjList) {
+    std::mt19937 rng(3);
+    for (int round = 0; round < 8; ++round) {
+        // Even rounds: edges only between even and odd vertices (bipartite).
+        const int n = 150;
+        AdjList g(n);
+        for (int i = 0; i < 300; ++i) {
+            int u = static_cast<int>(rng() % n);
+            int v = static_cast<int>(rng() % n);
+            if (round % 2 == 0 && (u + v) % 2 == 0) {
+                v = (v + 1) % n;
+            }
+            g[u].push_back(v);
+            g[v].push_back(u);
+        }
+        const auto csr = algorithms::graphs::csr_graph::csr_from_adjacency(g);
+        EXPECT_EQ(bipartite_bfs(g), bipartite_bfs(csr));
+        EXPECT_EQ(bipartite_dfs(g), bipartite_dfs(csr));
+    }
+}
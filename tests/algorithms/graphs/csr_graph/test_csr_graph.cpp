@@ -0,0 +1,306 @@
+#include <algorithm>
+#include <algorithms/graphs/csr_graph/csr_file.h>
+#include <algorithms/graphs/csr_graph/csr_graph.h>
+#include <cstdint>
+#include <cstdio>
+#include <gtest/gtest.h>
+#include <random>
+#include <span>
+#include <string>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace {
+using algorithms::graphs::csr_graph::csr_from_adjacency;
+using algorithms::graphs::csr_graph::csr_from_edges;
+using algorithms::graphs::csr_graph::CsrEdge;
+using algorithms::graphs::csr_graph::CsrGraph;
+using algorithms::graphs::csr_graph::CsrVerify;
+using algorithms::graphs::csr_graph::convert_edge_list;
+using algorithms::graphs::csr_graph::EdgeListOptions;
+using algorithms::graphs::csr_graph::load_csr;
+using algorithms::graphs::csr_graph::save_csr;
+using algorithms::graphs::csr_graph::transpose;
+
+struct WeightedEdge {
+    int32_t to;
+    int32_t w;
+};
+
+std::vector<int32_t> to_vector(std::span<const int32_t> s) {
+    return {s.begin(), s.end()};
+}
+
+template <typename EdgeData>
+void expect_same_graph(const CsrGraph<EdgeData>& a, const CsrGraph<EdgeData>& b) {
+    EXPECT_TRUE(std::ranges::equal(a.offsets(), b.offsets()));
+    EXPECT_TRUE(std::ranges::equal(a.targets(), b.targets()));
+    EXPECT_TRUE(std::ranges::equal(a.data(), b.data()));
+}
+
+void write_text(const std::string& path, const std::string& text) {
+    std::FILE* f = std::fopen(path.c_str(), "wb");
+    ASSERT_NE(f, nullptr);
+    ASSERT_EQ(std::fwrite(text.data(), 1, text.size(), f), text.size());
+    ASSERT_EQ(std::fclose(f), 0);
+}
+} // namespace
+
+TEST(CsrGraph, EmptyGraph) {
+    CsrGraph<> g;
+    EXPECT_EQ(g.size(), 0u);
+    EXPECT_EQ(g.vertices(), 0);
+    EXPECT_EQ(g.edges(), 0);
+    EXPECT_TRUE(g.neighbors(0).empty());
+    EXPECT_EQ(g.degree(-1), 0);
+
+    auto built = csr_from_edges<void>(-3, {{0, 1}});
+    EXPECT_EQ(built.vertices(), 0);
+    EXPECT_EQ(built.edges(), 0);
+}
+
+TEST(CsrGraph, FromEdgesKeepsInputOrderPerVertex) {
+    // Arcs given out of vertex order; invalid endpoints are dropped.
+    const std::vector<CsrEdge<>> edges = {{2, 0}, {0, 3}, {0, 1}, {2, 2}, {5, 1},
+                                          {1, -1}, {0, 3}, {3, 0}};
+    const auto g = csr_from_edges(4, edges);
+
+    ASSERT_EQ(g.vertices(), 4);
+    EXPECT_EQ(g.edges(), 6);
+    EXPECT_EQ(to_vector(g.neighbors(0)), (std::vector<int32_t>{3, 1, 3}));
+    EXPECT_EQ(to_vector(g.neighbors(1)), (std::vector<int32_t>{}));
+    EXPECT_EQ(to_vector(g.neighbors(2)), (std::vector<int32_t>{0, 2}));
+    EXPECT_EQ(to_vector(g.neighbors(3)), (std::vector<int32_t>{0}));
+    EXPECT_EQ(g.degree(0), 3);
+    EXPECT_TRUE(g.neighbors(4).empty());
+
+    const std::vector<int64_t> offsets = {0, 3, 3, 5, 6};
+    EXPECT_TRUE(std::ranges::equal(g.offsets(), offsets));
+    EXPECT_TRUE(g.data().empty());
+}
+
+TEST(CsrGraph, WeightedArcsSupportStructuredBindings) {
+    const std::vector<CsrEdge<int32_t>> edges = {{0, 1, 7}, {1, 2, -4}, {0, 2, 3}};
+    const auto g = csr_from_edges(3, edges);
+
+    std::vector<std::pair<int32_t, int32_t>> arcs;
+    for (const auto& [to, w] : g[0]) {
+        arcs.emplace_back(to, w);
+    }
+    EXPECT_EQ(arcs, (std::vector<std::pair<int32_t, int32_t>>{{1, 7}, {2, 3}}));
+    EXPECT_EQ(g[1].size(), 1u);
+    EXPECT_EQ(g[1][0].to, 2);
+    EXPECT_EQ(g[1][0].data, -4);
+    EXPECT_EQ(to_vector(g.edge_data(0)), (std::vector<int32_t>{7, 3}));
+    EXPECT_TRUE(g.edge_data(7).empty());
+    EXPECT_EQ(g.memory_bytes(), 4 * sizeof(int64_t) + 3 * sizeof(int32_t) * 2);
+}
+
+TEST(CsrGraph, FromAdjacencyMatchesAdjacencyList) {
+    const std::vector<std::vector<int32_t>> adj = {{1, 2, 9}, {}, {0, 0, 1}, {3}};
+    const auto g = csr_from_adjacency(adj);
+    ASSERT_EQ(g.size(), adj.size());
+    EXPECT_EQ(to_vector(g[0]), (std::vector<int32_t>{1, 2})); // 9 is out of range
+    EXPECT_EQ(to_vector(g[2]), (std::vector<int32_t>{0, 0, 1}));
+    EXPECT_EQ(to_vector(g[3]), (std::vector<int32_t>{3}));
+
+    const std::vector<std::vector<WeightedEdge>> wadj = {{{1, 5}, {2, 6}}, {{0, -1}}, {}};
+    const auto wg = csr_from_adjacency(wadj);
+    static_assert(std::is_same_v<decltype(wg), const CsrGraph<int32_t>>);
+    EXPECT_EQ(to_vector(wg.neighbors(0)), (std::vector<int32_t>{1, 2}));
+    EXPECT_EQ(to_vector(wg.edge_data(0)), (std::vector<int32_t>{5, 6}));
+    EXPECT_EQ(to_vector(wg.edge_data(1)), (std::vector<int32_t>{-1}));
+}
+
+TEST(CsrGraph, FromArraysValidates) {
+    EXPECT_TRUE(CsrGraph<>::from_arrays({0, 1, 2}, {1, 0}).has_value());
+    EXPECT_FALSE(CsrGraph<>::from_arrays({}, {}).has_value());           // no offsets
+    EXPECT_FALSE(CsrGraph<>::from_arrays({1, 2}, {0}).has_value());      // does not start at 0
+    EXPECT_FALSE(CsrGraph<>::from_arrays({0, 2, 1}, {0}).has_value());   // decreasing
+    EXPECT_FALSE(CsrGraph<>::from_arrays({0, 1, 3}, {0, 1}).has_value()); // wrong arc count
+    EXPECT_FALSE(CsrGraph<>::from_arrays({0, 1, 2}, {1, 2}).has_value()); // target out of range
+    EXPECT_FALSE(CsrGraph<int32_t>::from_arrays({0, 1}, {0}, {}).has_value()); // missing data
+    EXPECT_TRUE(CsrGraph<int32_t>::from_arrays({0, 1}, {0}, {4}).has_value());
+}
+
+TEST(CsrGraph, CopiesShareArrays) {
+    const auto g = csr_from_edges<void>(3, {{0, 1}, {1, 2}});
+    const CsrGraph<> copy = g;
+    EXPECT_EQ(copy.targets().data(), g.targets().data());
+    EXPECT_EQ(to_vector(copy.neighbors(1)), (std::vector<int32_t>{2}));
+}
+
+TEST(CsrGraph, TransposeMatchesAdjacencyTranspose) {
+    std::mt19937 rng(7);
+    const int32_t n = 200;
+    std::vector<std::vector<int32_t>> adj(n);
+    std::vector<CsrEdge<int32_t>> edges;
+    for (int i = 0; i < 1500; ++i) {
+        const int32_t u = static_cast<int32_t>(rng() % n);
+        const int32_t v = static_cast<int32_t>(rng() % n);
+        adj[static_cast<size_t>(u)].push_back(v);
+        edges.push_back({u, v, i});
+    }
+
+    // Reference: scan u = 0..n-1 and push u onto gt[v].
+    std::vector<std::vector<int32_t>> adj_t(n);
+    for (int32_t u = 0; u < n; ++u) {
+        for (int32_t v : adj[static_cast<size_t>(u)]) {
+            adj_t[static_cast<size_t>(v)].push_back(u);
+        }
+    }
+
+    const auto gt = transpose(csr_from_adjacency(adj));
+    const auto wgt = transpose(csr_from_edges(n, edges));
+    for (int32_t v = 0; v < n; ++v) {
+        EXPECT_EQ(to_vector(gt.neighbors(v)), adj_t[static_cast<size_t>(v)]);
+        EXPECT_EQ(to_vector(wgt.neighbors(v)), adj_t[static_cast<size_t>(v)]);
+        // The payload travels with its arc.
+        for (const auto& [u, id] : wgt[static_cast<size_t>(v)]) {
+            EXPECT_EQ(edges[static_cast<size_t>(id)].from, u);
+            EXPECT_EQ(edges[static_cast<size_t>(id)].to, v);
+        }
+    }
+}
+
+TEST(CsrFile, SaveAndLoad) {
+    const std::string path = testing::TempDir() + "csr_save_and_load.bin";
+    const auto g = csr_from_edges<int64_t>(5, {{0, 1, 10}, {3, 4, -2}, {0, 3, 7}, {4, 0, 1}});
+    ASSERT_TRUE(save_csr(g, path));
+
+    auto loaded = load_csr<int64_t>(path);
+    ASSERT_TRUE(loaded.has_value());
+    EXPECT_TRUE(loaded->mapped());
+    EXPECT_EQ(loaded->vertices(), 5);
+    EXPECT_EQ(loaded->edges(), 4);
+    expect_same_graph(*loaded, g);
+    EXPECT_EQ(loaded->edge_data(0)[1], 7);
+
+    // The mapping outlives the optional through copies of the graph.
+    const CsrGraph<int64_t> copy = *loaded;
+    loaded.reset();
+    EXPECT_EQ(to_vector(copy.neighbors(3)), (std::vector<int32_t>{4}));
+
+    // Unweighted, and empty, graphs round-trip too.
+    const auto u = csr_from_edges<void>(3, {{2, 1}, {2, 0}});
+    ASSERT_TRUE(save_csr(u, path));
+    auto lu = load_csr<void>(path, CsrVerify::kHeaderOnly);
+    ASSERT_TRUE(lu.has_value());
+    expect_same_graph(*lu, u);
+    ASSERT_TRUE(save_csr(CsrGraph<>{}, path));
+    ASSERT_TRUE(load_csr<void>(path).has_value());
+    EXPECT_EQ(load_csr<void>(path)->vertices(), 0);
+}
+
+TEST(CsrFile, LoadRejectsBadFiles) {
+    const std::string path = testing::TempDir() + "csr_load_rejects.bin";
+    const auto g = csr_from_edges<int32_t>(3, {{0, 1, 5}, {1, 2, 6}});
+    ASSERT_TRUE(save_csr(g, path));
+
+    EXPECT_FALSE(load_csr<int32_t>(path + ".missing").has_value());
+    EXPECT_FALSE(load_csr<void>(path).has_value());    // payload type differs
+    EXPECT_FALSE(load_csr<int64_t>(path).has_value()); // payload type differs
+    EXPECT_TRUE(load_csr<int32_t>(path).has_value());
+
+    // Point the first target (right after the header and 4 offsets) past the
+    // last vertex: only full verification reads it.
+    {
+        std::FILE* f = std::fopen(path.c_str(), "r+b");
+        ASSERT_NE(f, nullptr);
+        const int32_t bad = 3;
+        ASSERT_EQ(std::fseek(f, 64 + 4 * 8, SEEK_SET), 0);
+        ASSERT_EQ(std::fwrite(&bad, sizeof(bad), 1, f), 1u);
+        std::fclose(f);
+    }
+    EXPECT_FALSE(load_csr<int32_t>(path).has_value());
+    EXPECT_TRUE(load_csr<int32_t>(path, CsrVerify::kHeaderOnly).has_value());
+
+    // Bad magic, and trailing bytes.
+    ASSERT_TRUE(save_csr(g, path));
+    {
+        std::FILE* f = std::fopen(path.c_str(), "r+b");
+        ASSERT_NE(f, nullptr);
+        std::fputc('X', f);
+        std::fclose(f);
+    }
+    EXPECT_FALSE(load_csr<int32_t>(path, CsrVerify::kHeaderOnly).has_value());
+    ASSERT_TRUE(save_csr(g, path));
+    {
+        std::FILE* f = std::fopen(path.c_str(), "ab");
+        ASSERT_NE(f, nullptr);
+        std::fputc(0, f);
+        std::fclose(f);
+    }
+    EXPECT_FALSE(load_csr<int32_t>(path, CsrVerify::kHeaderOnly).has_value());
+    write_text(path, "short");
+    EXPECT_FALSE(load_csr<int32_t>(path).has_value());
+}
+
+TEST(CsrFile, ConvertEdgeListParsesAndSkips) {
+    const std::string text_path = testing::TempDir() + "csr_convert_small.txt";
+    const std::string csr_path = testing::TempDir() + "csr_convert_small.bin";
+    write_text(text_path, "# comment\n"
+                          "% another\n"
+                          "\n"
+                          "0 1 2.5\n"
+                          "2\t0\t-1\textra fields\r\n"
+                          "0 2\n"     // no weight
+                          "x 1 3\n"   // not a number
+                          "1 -4 1\n"  // negative id
+                          "  0 3 4e2\n"
+                          "1 2 0.5"); // no final newline
+
+    const auto stats = convert_edge_list<double>(text_path, csr_path);
+    ASSERT_TRUE(stats.has_value());
+    EXPECT_EQ(stats->vertices, 4);
+    EXPECT_EQ(stats->edges, 4);
+    EXPECT_EQ(stats->skipped, 3);
+
+    const auto g = load_csr<double>(csr_path);
+    ASSERT_TRUE(g.has_value());
+    const auto expected =
+        csr_from_edges<double>(4, {{0, 1, 2.5}, {2, 0, -1}, {0, 3, 400}, {1, 2, 0.5}});
+    expect_same_graph(*g, expected);
+
+    // A given vertex count drops arcs beyond it; unweighted ignores the weights.
+    const auto fixed = convert_edge_list<void>(text_path, csr_path, EdgeListOptions{3, 1});
+    ASSERT_TRUE(fixed.has_value());
+    EXPECT_EQ(fixed->vertices, 3);
+    EXPECT_EQ(fixed->edges, 4); // 0 1, 2 0, 0 2, 1 2
+    EXPECT_EQ(fixed->skipped, 3);
+    const auto u = load_csr<void>(csr_path);
+    ASSERT_TRUE(u.has_value());
+    expect_same_graph(*u, csr_from_edges<void>(3, {{0, 1}, {2, 0}, {0, 2}, {1, 2}}));
+
+    EXPECT_FALSE(convert_edge_list<void>(text_path + ".missing", csr_path).has_value());
+}
+
+TEST(CsrFile, ParallelConvertMatchesCsrFromEdges) {
+    // Enough text (a few MiB) that the input splits into several byte ranges.
+    const std::string text_path = testing::TempDir() + "csr_convert_large.txt";
+    const std::string csr_path = testing::TempDir() + "csr_convert_large.bin";
+    std::mt19937 rng(11);
+    const int32_t n = 20000;
+    std::vector<CsrEdge<int32_t>> edges;
+    std::string text;
+    for (int32_t i = 0; i < 300000; ++i) {
+        const auto u = static_cast<int32_t>(rng() % n);
+        const auto v = static_cast<int32_t>(rng() % n);
+        edges.push_back({u, v, i});
+        text += std::to_string(u) + ' ' + std::to_string(v) + ' ' + std::to_string(i) + '\n';
+    }
+    write_text(text_path, text);
+    const auto expected = csr_from_edges(n, edges);
+
+    for (int threads : {1, 3, 8}) {
+        const auto stats = convert_edge_list<int32_t>(text_path, csr_path, {-1, threads});
+        ASSERT_TRUE(stats.has_value());
+        EXPECT_EQ(stats->edges, 300000);
+        EXPECT_EQ(stats->skipped, 0);
+        const auto g = load_csr<int32_t>(csr_path);
+        ASSERT_TRUE(g.has_value());
+        EXPECT_EQ(g->vertices(), expected.vertices());
+        expect_same_graph(*g, expected);
+    }
+}
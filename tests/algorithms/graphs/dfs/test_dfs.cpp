@@ -1,17 +1,31 @@
 #include <algorithm>
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <algorithms/graphs/dfs/dfs.h>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <random>
 #include <unordered_set>
 #include <vector>
 
 namespace {
+using algorithms::graphs::csr_graph::csr_from_adjacency;
 using algorithms::graphs::dfs::AdjList;
 using algorithms::graphs::dfs::dfs_forest;
 using algorithms::graphs::dfs::dfs_forest_recursive;
 using algorithms::graphs::dfs::dfs_order_from;
 using algorithms::graphs::dfs::dfs_order_from_recursive;
 
+AdjList random_graph(int32_t n, int32_t m, unsigned seed) {
+    std::mt19937 rng(seed);
+    AdjList g(static_cast<size_t>(n));
+    for (int32_t i = 0; i < m; ++i) {
+        const auto u = static_cast<int32_t>(rng() % static_cast<unsigned>(n));
+        const auto v = static_cast<int32_t>(rng() % static_cast<unsigned>(n));
+        g[static_cast<size_t>(u)].push_back(v);
+    }
+    return g;
+}
+
 static bool is_permutation_0n1(const std::vector<int32_t>& order, int32_t n) {
     if ((int32_t)order.size() != n) {
         return false;
@@ -212,3 +226,22 @@ TEST(DFS, RecursiveAndIterativeReachSameSetFromStart) {
 }
 
 } // namespace
+
+TEST(DFS, CsrGraphMatchesAdjList) {
+    for (unsigned seed = 1; seed <= 5; ++seed) {
+        const AdjList g = random_graph(300, 600, seed);
+        const auto csr = csr_from_adjacency(g);
+
+        for (const auto& [a, b] : {std::pair{dfs_forest(g), dfs_forest(csr)},
+                                   std::pair{dfs_forest_recursive(g), dfs_forest_recursive(csr)}}) {
+            EXPECT_EQ(a.order, b.order);
+            EXPECT_EQ(a.parent, b.parent);
+            EXPECT_EQ(a.tin, b.tin);
+            EXPECT_EQ(a.tout, b.tout);
+        }
+        for (int32_t s : {0, 150, 299, -1}) {
+            EXPECT_EQ(dfs_order_from(g, s), dfs_order_from(csr, s));
+            EXPECT_EQ(dfs_order_from_recursive(g, s), dfs_order_from_recursive(csr, s));
+        }
+    }
+}
@@ -28,4 +28,22 @@ TEST(Dijkstra, Demo) {
     auto d_queue = dijkstra_queue(g, 0);
     EXPECT_EQ(d_queue[0], 0);
     EXPECT_EQ(d_queue[3], 3);
-}
\ No newline at end of file
+}
+
+TEST(Dijkstra, CsrGraphMatchesAdjacencyList) {
+    std::mt19937 rng(21);
+    std::uniform_int_distribution<int32_t> weight(0, 1000);
+    const int32_t n = 300;
+    Graph g(n);
+    for (int i = 0; i < 1500; ++i) {
+        g[rng() % n].push_back({static_cast<int32_t>(rng() % n), weight(rng)});
+    }
+    const CsrGraph csr = algorithms::graphs::csr_graph::csr_from_adjacency(g);
+
+    for (int32_t s : {0, 1, 150, 299}) {
+        const auto expected = dijkstra_queue(g, s);
+        EXPECT_EQ(dijkstra_queue(csr, s), expected);
+        EXPECT_EQ(dijkstra_set(csr, s), expected);
+        EXPECT_EQ(dijkstra(csr, s), expected);
+    }
+}
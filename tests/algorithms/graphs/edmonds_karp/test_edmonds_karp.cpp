@@ -320,3 +320,22 @@ TEST(EdmondsKarp, MaxFlowMinCut) {
     // Min cut = {(s,a), (s,b)} or {(a,t), (b,t)} = 10
     EXPECT_EQ(network.max_flow(0, 3), 10);
 }
+
+TEST(EdmondsKarp, CsrGraphMatchesEdgeList) {
+    std::mt19937 gen(9);
+    std::uniform_int_distribution<int32_t> cap_dist(0, 50);
+    for (int round = 0; round < 5; ++round) {
+        const int32_t n = 40;
+        std::vector<std::tuple<int32_t, int32_t, int32_t>> edges;
+        std::vector<algorithms::graphs::csr_graph::CsrEdge<int32_t>> arcs;
+        for (int i = 0; i < 200; ++i) {
+            const auto u = static_cast<int32_t>(gen() % n);
+            const auto v = static_cast<int32_t>(gen() % n);
+            const int32_t c = cap_dist(gen);
+            edges.emplace_back(u, v, c);
+            arcs.push_back({u, v, c});
+        }
+        const auto g = algorithms::graphs::csr_graph::csr_from_edges(n, arcs);
+        EXPECT_EQ(compute_max_flow(g, 0, n - 1), compute_max_flow(n, edges, 0, n - 1));
+    }
+}
@@ -85,3 +85,26 @@ TEST(FloydWarshall, NonSquareMatrixReturnsEmpty) {
     EXPECT_TRUE(res.next.empty());
     EXPECT_FALSE(res.has_negative_cycle);
 }
+
+TEST(FloydWarshall, CsrGraphMatchesMatrix) {
+    const int32_t INF = fw::FloydWarshallResult::INF;
+    // Parallel arcs 0 -> 1 (7) and (4): the lighter one is used.
+    const std::vector<algorithms::graphs::csr_graph::CsrEdge<int32_t>> arcs = {
+        {0, 1, 7}, {0, 1, 4}, {1, 2, -2}, {2, 0, 3}, {3, 3, 5}};
+    const auto g = algorithms::graphs::csr_graph::csr_from_edges(4, arcs);
+    std::vector<std::vector<int32_t>> w = {
+        {0, 4, INF, INF},
+        {INF, 0, -2, INF},
+        {3, INF, 0, INF},
+        {INF, INF, INF, 0},
+    };
+
+    const auto a = fw::floyd_warshall(w);
+    const auto b = fw::floyd_warshall(g);
+    EXPECT_EQ(a.dist, b.dist);
+    EXPECT_EQ(a.next, b.next);
+    EXPECT_FALSE(b.has_negative_cycle);
+
+    const auto cyc = algorithms::graphs::csr_graph::csr_from_edges<int32_t>(2, {{1, 1, -1}});
+    EXPECT_TRUE(fw::floyd_warshall(cyc).has_negative_cycle);
+}
@@ -1,10 +1,13 @@
 #include <algorithm>
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <algorithms/graphs/kosaraju_scc/kosaraju_scc.h>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <random>
 #include <vector>
 
 namespace {
+using algorithms::graphs::csr_graph::csr_from_adjacency;
 using algorithms::graphs::kosaraju_scc::AdjList;
 using algorithms::graphs::kosaraju_scc::build_components;
 using algorithms::graphs::kosaraju_scc::build_condensation_graph;
@@ -175,3 +178,28 @@ TEST(KosarajuScc, CondensationGraphIsDAGAndHasNoSelfLoops) {
 }
 
 } // namespace
+
+TEST(KosarajuSCC, CsrGraphMatchesAdjList) {
+    std::mt19937 rng(5);
+    for (int round = 0; round < 5; ++round) {
+        const int32_t n = 400;
+        AdjList g(static_cast<size_t>(n));
+        for (int i = 0; i < 700; ++i) {
+            g[rng() % n].push_back(static_cast<int32_t>(rng() % n));
+        }
+        const auto csr = csr_from_adjacency(g);
+
+        const auto a = kosaraju_scc(g);
+        const auto b = kosaraju_scc(csr);
+        EXPECT_EQ(a.component_of, b.component_of);
+        EXPECT_EQ(a.components_count, b.components_count);
+
+        const auto dag_a = build_condensation_graph(g, a);
+        const auto dag_b = build_condensation_graph(csr, b);
+        ASSERT_EQ(dag_a.size(), dag_b.size());
+        for (size_t c = 0; c < dag_a.size(); ++c) {
+            const auto arcs = dag_b[c];
+            EXPECT_EQ(dag_a[c], std::vector<int32_t>(arcs.begin(), arcs.end()));
+        }
+    }
+}
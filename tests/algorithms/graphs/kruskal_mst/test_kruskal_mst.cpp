@@ -2,6 +2,7 @@
 
 #include <algorithm>
 #include <gtest/gtest.h>
+#include <random>
 #include <numeric>
 #include <tuple>
 #include <vector>
@@ -160,3 +161,30 @@ TEST(KruskalMst, NegativeWeightsAreHandled) {
     EXPECT_EQ(res.total_weight, -6);
     EXPECT_TRUE(is_forest(3, res.edges));
 }
+
+TEST(KruskalMst, CsrGraphMatchesEdgeList) {
+    std::mt19937 rng(17);
+    std::uniform_int_distribution<int64_t> weight(1, 50);
+    for (int round = 0; round < 5; ++round) {
+        const int32_t n = 120;
+        std::vector<Edge> edges;
+        std::vector<algorithms::graphs::csr_graph::CsrEdge<int64_t>> arcs;
+        for (int i = 0; i < 400; ++i) {
+            const auto u = static_cast<int32_t>(rng() % n);
+            const auto v = static_cast<int32_t>(rng() % n);
+            const int64_t w = weight(rng);
+            edges.push_back(Edge{.u = u, .v = v, .w = w});
+            // Store each undirected edge in both directions.
+            arcs.push_back({u, v, w});
+            arcs.push_back({v, u, w});
+        }
+        const CsrGraph csr = algorithms::graphs::csr_graph::csr_from_edges(n, arcs);
+
+        const auto a = kruskal_mst(n, edges);
+        const auto b = kruskal_mst(csr);
+        EXPECT_EQ(a.vertices, b.vertices);
+        EXPECT_EQ(a.components, b.components);
+        EXPECT_EQ(a.total_weight, b.total_weight);
+        EXPECT_EQ(a.edges.size(), b.edges.size());
+    }
+}
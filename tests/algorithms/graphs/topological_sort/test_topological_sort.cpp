@@ -1,10 +1,13 @@
 #include <algorithm>
+#include <algorithms/graphs/csr_graph/csr_graph.h>
 #include <algorithms/graphs/topological_sort/topological_sort.h>
 #include <cstdint>
 #include <gtest/gtest.h>
+#include <random>
 #include <vector>
 
 namespace {
+using algorithms::graphs::csr_graph::csr_from_adjacency;
 using algorithms::graphs::topological_sort::AdjList;
 using algorithms::graphs::topological_sort::topological_order_or_empty;
 using algorithms::graphs::topological_sort::topological_order_or_empty_dfs;
@@ -201,3 +204,32 @@ TEST(TopologicalSort, KahnAndDfsAgreeOnDagValidity) {
 }
 
 } // namespace
+
+TEST(TopologicalSort, CsrGraphMatchesAdjList) {
+    std::mt19937 rng(11);
+    for (int round = 0; round < 6; ++round) {
+        // Forward arcs only (a DAG) on even rounds, arbitrary arcs on odd ones.
+        const int32_t n = 200;
+        AdjList g(static_cast<size_t>(n));
+        for (int i = 0; i < 500; ++i) {
+            auto u = static_cast<int32_t>(rng() % n);
+            auto v = static_cast<int32_t>(rng() % n);
+            if (round % 2 == 0 && u >= v) {
+                continue;
+            }
+            g[static_cast<size_t>(u)].push_back(v);
+        }
+        const auto csr = csr_from_adjacency(g);
+
+        const auto kahn_a = topological_sort(g);
+        const auto kahn_b = topological_sort(csr);
+        EXPECT_EQ(kahn_a.order, kahn_b.order);
+        EXPECT_EQ(kahn_a.has_cycle, kahn_b.has_cycle);
+        const auto dfs_a = topological_sort_dfs(g);
+        const auto dfs_b = topological_sort_dfs(csr);
+        EXPECT_EQ(dfs_a.order, dfs_b.order);
+        EXPECT_EQ(dfs_a.has_cycle, dfs_b.has_cycle);
+        EXPECT_EQ(topological_order_or_empty(g), topological_order_or_empty(csr));
+        EXPECT_EQ(topological_order_or_empty_dfs(g), topological_order_or_empty_dfs(csr));
+    }
+}
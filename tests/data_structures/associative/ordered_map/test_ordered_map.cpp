@@ -1,9 +1,14 @@
 #include <data_structures/associative/ordered_map/ordered_map.h>
+#include <data_structures/associative/ordered_map/persistent_ordered_map.h>
 
+#include <algorithm>
 #include <gtest/gtest.h>
+#include <limits>
 #include <map>
 #include <random>
 #include <string>
+#include <thread>
+#include <vector>
 
 namespace om = ds::ordered_map;
 using Map    = om::OrderedMap<int, std::string>;
@@ -240,3 +245,266 @@ TEST(OrderedMap, AgainstStdMap) {
     }
     EXPECT_EQ(our.size(), ref.size());
 }
+
+// ==================== order statistics ====================
+
+using RankedMap = om::OrderedMap<int, int, std::less<int>, om::SubtreeSize>;
+
+TEST(OrderedMapAugmented, SelectAndRank) {
+    RankedMap m;
+    for (int k : {50, 10, 40, 20, 30}) m.insert(k, k);
+    for (std::size_t i = 0; i < 5; ++i) {
+        ASSERT_NE(m.select(i), nullptr);
+        EXPECT_EQ(*m.select(i), static_cast<int>(10 * (i + 1)));
+    }
+    EXPECT_EQ(m.select(5), nullptr);
+    EXPECT_EQ(m.rank(10), 0u);
+    EXPECT_EQ(m.rank(35), 3u);
+    EXPECT_EQ(m.rank(99), 5u);
+    EXPECT_EQ(m.aggregate(), 5u);
+}
+
+TEST(OrderedMapAugmented, CountInRangeHalfOpen) {
+    RankedMap m;
+    for (int k = 0; k < 100; ++k) m.insert(k, k);
+    EXPECT_EQ(m.count_in_range(10, 20), 10u);
+    EXPECT_EQ(m.count_in_range(-5, 3), 3u);
+    EXPECT_EQ(m.count_in_range(20, 10), 0u);
+    EXPECT_EQ(m.count_in_range(42, 42), 0u);
+}
+
+TEST(OrderedMapAugmented, RangeSumMinMax) {
+    om::OrderedMap<int, long long, std::less<int>, om::Counted<om::ValueSum<long long>>> sum;
+    om::OrderedMap<int, int, std::less<int>, om::ValueMin<int>> mn;
+    om::OrderedMap<int, int, std::less<int>, om::ValueMax<int>> mx;
+    for (int k = 1; k <= 50; ++k) {
+        sum.insert(k, k);
+        mn.insert(k, (k * 37) % 101);
+        mx.insert(k, (k * 37) % 101);
+    }
+    EXPECT_EQ(sum.aggregate_range(1, 11).agg, 55);
+    EXPECT_EQ(sum.aggregate_range(1, 11).count, 10u);
+    EXPECT_EQ(sum.aggregate().agg, 50 * 51 / 2);
+
+    int lo = 1000, hi = -1;
+    for (int k = 7; k < 23; ++k) {
+        lo = std::min(lo, (k * 37) % 101);
+        hi = std::max(hi, (k * 37) % 101);
+    }
+    EXPECT_EQ(mn.aggregate_range(7, 23), lo);
+    EXPECT_EQ(mx.aggregate_range(7, 23), hi);
+    EXPECT_EQ(mn.aggregate_range(60, 70), std::numeric_limits<int>::max());
+}
+
+TEST(OrderedMapAugmented, OverwriteUpdatesAggregate) {
+    om::OrderedMap<int, int, std::less<int>, om::ValueSum<int>> m;
+    for (int k = 0; k < 10; ++k) m.insert(k, 1);
+    m.insert(5, 100);
+    EXPECT_EQ(m.aggregate(), 109);
+    m.insert(3, 0);
+    EXPECT_EQ(m.aggregate(), 108);
+}
+
+TEST(OrderedMapAugmented, AgainstSortedVector) {
+    // Random insert/erase against a sorted-vector reference, checking every
+    // augmented query after each step. Also exercises copy.
+    std::mt19937 rng(7);
+    std::uniform_int_distribution<int> key_dist(0, 299);
+
+    om::OrderedMap<int, int, std::less<int>, om::Counted<om::ValueSum<int>>> m;
+    std::map<int, int> ref;
+
+    for (int round = 0; round < 3000; ++round) {
+        int k = key_dist(rng);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(m.erase(k), ref.erase(k) > 0);
+        } else {
+            int v = key_dist(rng);
+            m.insert(k, v);
+            ref[k] = v;
+        }
+        if (round % 97 != 0) continue;
+
+        std::vector<int> keys;
+        for (const auto& kv : ref) keys.push_back(kv.first);
+        auto copy = m;
+        for (std::size_t i = 0; i < keys.size(); ++i) ASSERT_EQ(*copy.select(i), keys[i]);
+
+        int a = key_dist(rng), b = key_dist(rng);
+        if (a > b) std::swap(a, b);
+        auto first = std::lower_bound(keys.begin(), keys.end(), a);
+        auto last  = std::lower_bound(keys.begin(), keys.end(), b);
+        EXPECT_EQ(m.rank(a), static_cast<std::size_t>(first - keys.begin()));
+        EXPECT_EQ(m.count_in_range(a, b), static_cast<std::size_t>(last - first));
+
+        int expect = 0;
+        for (auto it = ref.lower_bound(a); it != ref.lower_bound(b); ++it) expect += it->second;
+        EXPECT_EQ(m.aggregate_range(a, b).agg, expect);
+    }
+}
+
+// ==================== arena allocator ====================
+
+using ArenaMap =
+    om::OrderedMap<int, std::string, std::less<int>, om::NoAugment, om::ArenaAllocator>;
+
+TEST(OrderedMapArena, BasicOperations) {
+    ArenaMap m;
+    for (int k = 0; k < 500; ++k) m.insert(k, std::to_string(k));
+    EXPECT_EQ(m.size(), 500u);
+    for (int k = 0; k < 500; k += 2) EXPECT_TRUE(m.erase(k));
+    for (int k = 0; k < 500; ++k) EXPECT_EQ(m.contains(k), k % 2 == 1);
+    EXPECT_EQ(*m.find(123), "123");
+}
+
+TEST(OrderedMapArena, ClearAndReuse) {
+    ArenaMap m;
+    for (int k = 0; k < 1000; ++k) m.insert(k, std::string(40, 'x')); // heap-allocated strings
+    m.clear();
+    EXPECT_TRUE(m.empty());
+    EXPECT_EQ(m.find(1), nullptr);
+    m.insert(7, "seven");
+    EXPECT_EQ(*m.find(7), "seven");
+    EXPECT_EQ(m.size(), 1u);
+}
+
+TEST(OrderedMapArena, CopyIsIndependent) {
+    ArenaMap m;
+    for (int k = 0; k < 200; ++k) m.insert(k, std::to_string(k));
+    ArenaMap copy(m);
+    m.clear();
+    EXPECT_EQ(copy.size(), 200u);
+    for (int k = 0; k < 200; ++k) EXPECT_EQ(*copy.find(k), std::to_string(k));
+
+    ArenaMap assigned;
+    assigned.insert(-1, "gone");
+    assigned = copy;
+    EXPECT_FALSE(assigned.contains(-1));
+    EXPECT_EQ(assigned.size(), 200u);
+}
+
+TEST(OrderedMapArena, MoveKeepsNodes) {
+    ArenaMap m;
+    for (int k = 0; k < 100; ++k) m.insert(k, "v");
+    ArenaMap moved(std::move(m));
+    EXPECT_EQ(moved.size(), 100u);
+    EXPECT_TRUE(moved.contains(99));
+    m.insert(1, "fresh"); // moved-from map stays usable
+    EXPECT_EQ(m.size(), 1u);
+}
+
+TEST(OrderedMapArena, AugmentedAgainstStdMap) {
+    om::OrderedMap<int, int, std::less<int>, om::SubtreeSize, om::ArenaAllocator> our;
+    std::map<int, int> ref;
+    std::mt19937 rng(11);
+    for (int round = 0; round < 5000; ++round) {
+        int k = static_cast<int>(rng() % 500);
+        if (rng() % 2) {
+            our.insert(k, k);
+            ref[k] = k;
+        } else {
+            EXPECT_EQ(our.erase(k), ref.erase(k) > 0);
+        }
+    }
+    ASSERT_EQ(our.size(), ref.size());
+    std::size_t i = 0;
+    for (const auto& kv : ref) EXPECT_EQ(*our.select(i++), kv.first);
+}
+
+// ==================== persistent map ====================
+
+using PMap = om::PersistentOrderedMap<int, std::string>;
+
+TEST(PersistentOrderedMap, BasicOperations) {
+    PMap m;
+    EXPECT_TRUE(m.empty());
+    for (int k : {5, 3, 8, 1, 4}) m.insert(k, std::to_string(k));
+    EXPECT_EQ(m.size(), 5u);
+    EXPECT_EQ(*m.find(4), "4");
+    EXPECT_EQ(m.find(7), nullptr);
+    EXPECT_EQ(*m.min_key(), 1);
+    EXPECT_EQ(*m.max_key(), 8);
+    m.insert(4, "four");
+    EXPECT_EQ(*m.find(4), "four");
+    EXPECT_EQ(m.size(), 5u);
+    EXPECT_TRUE(m.erase(5));
+    EXPECT_FALSE(m.erase(5));
+    EXPECT_FALSE(m.contains(5));
+    EXPECT_EQ(m.size(), 4u);
+}
+
+TEST(PersistentOrderedMap, SnapshotIsIsolated) {
+    PMap m;
+    for (int k = 0; k < 100; ++k) m.insert(k, "old");
+    PMap snap = m.snapshot();
+
+    for (int k = 0; k < 100; k += 2) m.erase(k);
+    for (int k = 1; k < 100; k += 2) m.insert(k, "new");
+    m.insert(1000, "new");
+
+    EXPECT_EQ(snap.size(), 100u);
+    for (int k = 0; k < 100; ++k) EXPECT_EQ(*snap.find(k), "old");
+    EXPECT_FALSE(snap.contains(1000));
+
+    EXPECT_EQ(m.size(), 51u);
+    for (int k = 1; k < 100; k += 2) EXPECT_EQ(*m.find(k), "new");
+
+    // Mutating the snapshot does not leak back either.
+    snap.clear();
+    EXPECT_EQ(m.size(), 51u);
+}
+
+TEST(PersistentOrderedMap, ManyVersionsAgainstStdMap) {
+    // Keep a snapshot after every 50 operations and check each one against
+    // the std::map state captured at the same moment.
+    std::mt19937 rng(123);
+    om::PersistentOrderedMap<int, int> m;
+    std::map<int, int> ref;
+    std::vector<std::pair<om::PersistentOrderedMap<int, int>, std::map<int, int>>> versions;
+
+    for (int round = 0; round < 4000; ++round) {
+        int k = static_cast<int>(rng() % 300);
+        if (rng() % 3 == 0) {
+            EXPECT_EQ(m.erase(k), ref.erase(k) > 0);
+        } else {
+            m.insert(k, round);
+            ref[k] = round;
+        }
+        if (round % 50 == 0) versions.emplace_back(m.snapshot(), ref);
+    }
+    for (const auto& [snap, expect] : versions) {
+        ASSERT_EQ(snap.size(), expect.size());
+        for (int k = 0; k < 300; ++k) {
+            auto it = expect.find(k);
+            const int* v = snap.find(k);
+            ASSERT_EQ(v != nullptr, it != expect.end());
+            if (v) {
+                EXPECT_EQ(*v, it->second);
+            }
+        }
+    }
+}
+
+TEST(PersistentOrderedMap, ConcurrentReadersOnSnapshots) {
+    om::PersistentOrderedMap<int, int> m;
+    for (int k = 0; k < 2000; ++k) m.insert(k, 0);
+
+    std::vector<std::thread> readers;
+    std::vector<int> ok(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        readers.emplace_back([snap = m.snapshot(), &flag = ok[t]] {
+            bool good = snap.size() == 2000;
+            for (int pass = 0; pass < 20; ++pass)
+                for (int k = 0; k < 2000; ++k) good = good && snap.find(k) && *snap.find(k) == 0;
+            flag = good;
+        });
+    }
+    for (int round = 1; round <= 20; ++round)
+        for (int k = 0; k < 2000; ++k) {
+            m.erase(k);
+            m.insert(k, round);
+        }
+    for (auto& r : readers) r.join();
+    for (int flag : ok) EXPECT_TRUE(flag);
+    EXPECT_EQ(*m.find(1999), 20);
+}
@@ -1,14 +1,23 @@
 #include <algorithm>
+#include <atomic>
+#include <data_structures/dsu/concurrent_dsu.h>
 #include <data_structures/dsu/dsu.h>
 #include <data_structures/dsu/dsu_rank.h>
+#include <data_structures/dsu/dynamic_connectivity.h>
+#include <data_structures/dsu/rollback_dsu.h>
 #include <gtest/gtest.h>
 #include <random>
 #include <set>
+#include <thread>
+#include <utility>
 #include <vector>
 
 namespace {
+using ds::dsu::ConcurrentDisjointSetUnion;
 using ds::dsu::DisjointSetUnion;
 using ds::dsu::DisjointSetUnionRank;
+using ds::dsu::OfflineDynamicConnectivity;
+using ds::dsu::RollbackDisjointSetUnion;
 
 TEST(DisjointSetUnion, Empty) {
     DisjointSetUnion dsu;
@@ -148,6 +157,32 @@ TEST(DisjointSetUnion, RandomAgainstNaive) {
     }
 }
 
+TEST(DisjointSetUnion, UniteBatchMatchesPerEdge) {
+    for (int n : {0, 1, 10, 1000, 200000}) {
+        std::mt19937 rng(48);
+        std::vector<std::pair<int, int>> edges(static_cast<size_t>(n) + 300000);
+        for (auto& [a, b] : edges) {
+            // A few invalid endpoints, skipped by both paths.
+            a = static_cast<int>(rng() % static_cast<unsigned>(n + 2)) - 1;
+            b = static_cast<int>(rng() % static_cast<unsigned>(n + 2)) - 1;
+        }
+        DisjointSetUnion single(n), batch(n);
+        int merges = 0;
+        for (auto [a, b] : edges) {
+            merges += single.unite(a, b) ? 1 : 0;
+        }
+        EXPECT_EQ(batch.unite_batch(edges), merges);
+        EXPECT_EQ(batch.components(), single.components());
+        for (int v = 0; v < n; v += std::max(1, n / 500)) {
+            const int w = static_cast<int>(rng() % static_cast<unsigned>(n));
+            ASSERT_EQ(batch.same(v, w), single.same(v, w));
+            ASSERT_EQ(batch.component_size(v), single.component_size(v));
+        }
+    }
+    DisjointSetUnion dsu(3);
+    EXPECT_EQ(dsu.unite_batch({}), 0);
+}
+
 TEST(DisjointSetUnionRank, Empty) {
     DisjointSetUnionRank dsu;
 
@@ -236,4 +271,227 @@ TEST(DisjointSetUnionRank, RandomAgainstNaive) {
     }
 }
 
+TEST(ConcurrentDisjointSetUnion, EmptyAndDefensive) {
+    ConcurrentDisjointSetUnion dsu;
+    EXPECT_EQ(dsu.size(), 0);
+    EXPECT_EQ(dsu.components(), 0);
+    EXPECT_EQ(dsu.find(0), -1);
+    EXPECT_FALSE(dsu.same(0, 0));
+    EXPECT_FALSE(dsu.unite(0, 1));
+
+    dsu.assign(3);
+    EXPECT_EQ(dsu.components(), 3);
+    EXPECT_EQ(dsu.find(-1), -1);
+    EXPECT_EQ(dsu.find(3), -1);
+    EXPECT_FALSE(dsu.unite(0, 3));
+    EXPECT_FALSE(dsu.same(-1, 0));
+    EXPECT_TRUE(dsu.unite(0, 2));
+    EXPECT_FALSE(dsu.unite(2, 0));
+    EXPECT_TRUE(dsu.same(2, 0));
+    EXPECT_FALSE(dsu.same(1, 0));
+    EXPECT_EQ(dsu.find(0), dsu.find(2));
+    EXPECT_EQ(dsu.components(), 2);
+}
+
+TEST(ConcurrentDisjointSetUnion, SingleThreadAgainstNaive) {
+    constexpr int N = 200;
+    std::mt19937_64 rng(44);
+    std::uniform_int_distribution<int> idxDist(-20, N + 20);
+
+    ConcurrentDisjointSetUnion dsu(N);
+    std::vector<int> comp(N);
+    for (int i = 0; i < N; ++i) {
+        comp[i] = i;
+    }
+    for (int op = 0; op < 5000; ++op) {
+        const int a = idxDist(rng);
+        const int b = idxDist(rng);
+        const bool valid = 0 <= a && a < N && 0 <= b && b < N;
+        if (rng() % 2 == 0) {
+            const bool ok = dsu.unite(a, b);
+            if (valid) {
+                const bool beforeSame = naive_find(comp, a) == naive_find(comp, b);
+                naive_unite(comp, a, b);
+                EXPECT_EQ(ok, !beforeSame);
+            } else {
+                EXPECT_FALSE(ok);
+            }
+        } else {
+            EXPECT_EQ(dsu.same(a, b), valid && naive_find(comp, a) == naive_find(comp, b));
+        }
+        EXPECT_EQ(dsu.components(), naive_components(comp));
+    }
+}
+
+TEST(ConcurrentDisjointSetUnion, ParallelUnitesMatchSequential) {
+    constexpr int N = 1 << 14;
+    constexpr int M = 1 << 16;
+    constexpr int T = 8;
+
+    std::mt19937 rng(45);
+    std::vector<std::pair<int, int>> edges(M);
+    for (auto& [a, b] : edges) {
+        a = static_cast<int>(rng() % N);
+        b = static_cast<int>(rng() % N);
+    }
+
+    ConcurrentDisjointSetUnion dsu(N);
+    std::atomic<int> merges{0};
+    std::vector<std::thread> pool;
+    for (int t = 0; t < T; ++t) {
+        pool.emplace_back([&, t] {
+            for (int i = t; i < M; i += T) {
+                // Interleave queries with the unites of the other threads.
+                dsu.same(edges[i].first, edges[(i * 7) % M].second);
+                if (dsu.unite(edges[i].first, edges[i].second)) {
+                    merges.fetch_add(1);
+                }
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+
+    DisjointSetUnion ref(N);
+    for (auto [a, b] : edges) {
+        ref.unite(a, b);
+    }
+    EXPECT_EQ(dsu.components(), ref.components());
+    EXPECT_EQ(merges.load(), N - ref.components()); // every merge counted exactly once
+    for (int v = 0; v < N; ++v) {
+        const int w = static_cast<int>(rng() % N);
+        ASSERT_EQ(dsu.same(v, w), ref.same(v, w)) << v << " " << w;
+        ASSERT_EQ(dsu.same(v, ref.find(v)), true);
+    }
+}
+
+TEST(RollbackDisjointSetUnion, EmptyAndDefensive) {
+    RollbackDisjointSetUnion dsu;
+    EXPECT_EQ(dsu.size(), 0);
+    EXPECT_EQ(dsu.find(0), -1);
+    EXPECT_FALSE(dsu.unite(0, 1));
+    EXPECT_EQ(dsu.snapshot(), 0);
+    dsu.rollback(-5); // nothing to undo
+
+    dsu.assign(4);
+    EXPECT_FALSE(dsu.unite(0, 4));
+    EXPECT_TRUE(dsu.unite(0, 1));
+    EXPECT_FALSE(dsu.unite(1, 0)); // not recorded
+    EXPECT_EQ(dsu.snapshot(), 1);
+    dsu.rollback(7); // ahead of the history: no-op
+    EXPECT_TRUE(dsu.same(0, 1));
+    EXPECT_EQ(dsu.component_size(-1), 0);
+}
+
+TEST(RollbackDisjointSetUnion, RollbackRestoresEveryEarlierState) {
+    constexpr int N = 100;
+    std::mt19937_64 rng(46);
+    RollbackDisjointSetUnion dsu(N);
+
+    // Stack of (snapshot, partition) pairs, compared after every rollback.
+    std::vector<std::pair<int, std::vector<int>>> saved;
+    auto partition = [&] {
+        std::vector<int> leaders(N);
+        for (int v = 0; v < N; ++v) {
+            leaders[v] = dsu.find(v);
+        }
+        return leaders;
+    };
+    for (int op = 0; op < 3000; ++op) {
+        const int type = static_cast<int>(rng() % 3);
+        if (type == 0 || saved.empty()) {
+            saved.emplace_back(dsu.snapshot(), partition());
+            const int k = static_cast<int>(rng() % 8);
+            for (int i = 0; i < k; ++i) {
+                dsu.unite(static_cast<int>(rng() % N), static_cast<int>(rng() % N));
+            }
+        } else {
+            // Undo to a random saved point, dropping the later ones.
+            const size_t back = rng() % saved.size();
+            saved.resize(back + 1);
+            dsu.rollback(saved.back().first);
+            ASSERT_EQ(dsu.snapshot(), saved.back().first);
+            ASSERT_EQ(partition(), saved.back().second);
+            saved.pop_back();
+        }
+        int comps = 0, total = 0;
+        for (int v = 0; v < N; ++v) {
+            if (dsu.find(v) == v) {
+                ++comps;
+                total += dsu.component_size(v);
+            }
+        }
+        ASSERT_EQ(dsu.components(), comps);
+        ASSERT_EQ(total, N);
+    }
+    dsu.rollback(0);
+    EXPECT_EQ(dsu.components(), N);
+}
+
+TEST(OfflineDynamicConnectivity, RandomAgainstRecompute) {
+    for (int n : {1, 5, 30}) {
+        std::mt19937_64 rng(47 + static_cast<unsigned>(n));
+        OfflineDynamicConnectivity dc(n);
+        std::vector<std::pair<int, int>> edges; // multiset of live edges
+        std::vector<int> expected;
+
+        auto recompute = [&] {
+            DisjointSetUnion dsu(n);
+            for (auto [a, b] : edges) {
+                dsu.unite(a, b);
+            }
+            return dsu;
+        };
+        for (int op = 0; op < 2000; ++op) {
+            const int type = static_cast<int>(rng() % 5);
+            const int a = static_cast<int>(rng() % static_cast<unsigned>(n + 2)) - 1;
+            const int b = static_cast<int>(rng() % static_cast<unsigned>(n + 2)) - 1;
+            const bool valid = 0 <= a && a < n && 0 <= b && b < n;
+            if (type <= 1) {
+                dc.add_edge(a, b);
+                if (valid) {
+                    edges.emplace_back(a, b);
+                }
+            } else if (type == 2) {
+                dc.remove_edge(b, a); // either orientation
+                for (size_t i = edges.size(); valid && i-- > 0;) {
+                    const auto [x, y] = edges[i];
+                    if ((x == a && y == b) || (x == b && y == a)) {
+                        edges.erase(edges.begin() + static_cast<std::ptrdiff_t>(i));
+                        break;
+                    }
+                }
+            } else if (type == 3) {
+                ASSERT_EQ(dc.query_connected(a, b), static_cast<int>(expected.size()));
+                expected.push_back(valid && recompute().same(a, b) ? 1 : 0);
+            } else {
+                dc.query_components();
+                expected.push_back(recompute().components());
+            }
+        }
+        EXPECT_EQ(dc.queries(), static_cast<int>(expected.size()));
+        EXPECT_EQ(dc.solve(), expected) << n;
+    }
+}
+
+TEST(OfflineDynamicConnectivity, Basics) {
+    OfflineDynamicConnectivity dc(4);
+    EXPECT_TRUE(dc.solve().empty());
+
+    dc.add_edge(0, 1);
+    dc.add_edge(1, 2);
+    dc.query_connected(0, 2); // 1
+    dc.add_edge(0, 1);        // parallel copy
+    dc.remove_edge(1, 0);
+    dc.query_connected(0, 2); // 1: the other copy is still there
+    dc.remove_edge(0, 1);
+    dc.query_connected(0, 2); // 0
+    dc.query_components();    // {0} {1, 2} {3}
+    dc.remove_edge(2, 3);     // absent: no-op
+    dc.query_connected(3, 3); // 1
+    dc.query_connected(-1, 0);
+    EXPECT_EQ(dc.solve(), (std::vector<int>{1, 1, 0, 3, 1, 0}));
+}
+
 } // namespace
@@ -1,11 +1,22 @@
 #include <cstdint>
+#include <data_structures/range_query/fenwick/basic_fenwick.h>
+#include <data_structures/range_query/fenwick/blocked_fenwick.h>
+#include <data_structures/range_query/fenwick/concurrent_fenwick.h>
 #include <data_structures/range_query/fenwick/fenwick.h>
+#include <data_structures/range_query/fenwick/fenwick_2d.h>
 #include <gtest/gtest.h>
 #include <random>
+#include <thread>
 #include <vector>
 
 namespace {
+using ds::range_query::fenwick::BasicFenwickTree;
+using ds::range_query::fenwick::BlockedFenwickTree;
+using ds::range_query::fenwick::ConcurrentFenwickTree;
 using ds::range_query::fenwick::FenwickTree;
+using ds::range_query::fenwick::FenwickTree2D;
+using ds::range_query::fenwick::RangeFenwickTree;
+using ds::range_query::fenwick::ShardedFenwickTree;
 
 TEST(FenwickTree, Empty) {
     FenwickTree ft;
@@ -107,4 +118,307 @@ TEST(FenwickTree, RandomAgainstNaive) {
     }
 }
 
+// ==================== BasicFenwickTree ====================
+
+TEST(BasicFenwickTree, LinearBuildMatchesIncremental) {
+    std::mt19937_64 rng(7);
+    for (int n : {0, 1, 2, 7, 64, 100, 1000}) {
+        std::vector<int64_t> a(static_cast<size_t>(n));
+        for (auto& x : a) {
+            x = static_cast<int64_t>(rng() % 2001) - 1000;
+        }
+        BasicFenwickTree<int64_t> built(a);
+        FenwickTree reference(a);
+        ASSERT_EQ(built.size(), n);
+        for (int r = -1; r <= n; ++r) {
+            EXPECT_EQ(built.prefix_sum(r), reference.prefix_sum(r));
+        }
+    }
+}
+
+TEST(BasicFenwickTree, OtherGroups) {
+    using ds::range_query::fenwick::XorGroup;
+    BasicFenwickTree<uint32_t, XorGroup<uint32_t>> x(std::vector<uint32_t>{1, 2, 4, 8, 16});
+    EXPECT_EQ(x.prefix_sum(4), 31u);
+    EXPECT_EQ(x.range_sum(1, 3), 14u);
+    x.add(2, 4); // 4 ^ 4 = 0
+    EXPECT_EQ(x.range_sum(1, 3), 10u);
+
+    BasicFenwickTree<double> d(std::vector<double>{0.5, 0.25, 0.125});
+    EXPECT_DOUBLE_EQ(d.range_sum(1, 2), 0.375);
+    EXPECT_DOUBLE_EQ(d.range_sum(-3, 1), 0.75);
+    EXPECT_DOUBLE_EQ(d.range_sum(5, 9), 0.0);
+}
+
+TEST(BasicFenwickTree, LowerBound) {
+    BasicFenwickTree<int64_t> ft(std::vector<int64_t>{3, 0, 2, 5, 0, 1});
+    // prefix sums: 3 3 5 10 10 11
+    EXPECT_EQ(ft.lower_bound(0), 0);
+    EXPECT_EQ(ft.lower_bound(1), 0);
+    EXPECT_EQ(ft.lower_bound(3), 0);
+    EXPECT_EQ(ft.lower_bound(4), 2);
+    EXPECT_EQ(ft.lower_bound(10), 3);
+    EXPECT_EQ(ft.lower_bound(11), 5);
+    EXPECT_EQ(ft.lower_bound(12), 6);
+    EXPECT_EQ(BasicFenwickTree<int64_t>().lower_bound(1), 0);
+
+    std::mt19937_64 rng(3);
+    std::vector<int64_t> w(333);
+    for (auto& x : w) {
+        x = static_cast<int64_t>(rng() % 10);
+    }
+    BasicFenwickTree<int64_t> big(w);
+    for (int64_t t = 0; t <= big.prefix_sum(332) + 1; ++t) {
+        int expected = 0;
+        while (expected < 333 && big.prefix_sum(expected) < t) {
+            ++expected;
+        }
+        ASSERT_EQ(big.lower_bound(t), expected) << "target " << t;
+    }
+}
+
+// ==================== RangeFenwickTree ====================
+
+TEST(RangeFenwickTree, RandomAgainstNaive) {
+    constexpr int N = 150;
+    std::mt19937_64 rng(99);
+    std::uniform_int_distribution<int> idxDist(-20, N + 20);
+    std::uniform_int_distribution<int64_t> deltaDist(-1000, 1000);
+
+    std::vector<int64_t> a(N);
+    for (auto& x : a) {
+        x = deltaDist(rng);
+    }
+    RangeFenwickTree<int64_t> ft(a);
+
+    for (int op = 0; op < 3000; ++op) {
+        int l = idxDist(rng);
+        int r = idxDist(rng);
+        if (l > r) {
+            std::swap(l, r);
+        }
+        const int cl = std::max(l, 0);
+        const int cr = std::min(r, N - 1);
+        if (rng() % 2 == 0) {
+            const int64_t delta = deltaDist(rng);
+            for (int i = cl; i <= cr; ++i) {
+                a[i] += delta;
+            }
+            ft.range_add(l, r, delta);
+        } else {
+            int64_t expected = 0;
+            for (int i = cl; i <= cr; ++i) {
+                expected += a[i];
+            }
+            EXPECT_EQ(ft.range_sum(l, r), expected);
+            if (0 <= l && l < N) {
+                EXPECT_EQ(ft.value_at(l), a[l]);
+            }
+        }
+    }
+}
+
+TEST(RangeFenwickTree, PointAddAndEmpty) {
+    RangeFenwickTree<int64_t> ft(4);
+    ft.add(1, 5);
+    ft.range_add(0, 3, 1);
+    EXPECT_EQ(ft.range_sum(0, 3), 9);
+    EXPECT_EQ(ft.value_at(1), 6);
+    EXPECT_EQ(ft.value_at(4), 0);
+
+    RangeFenwickTree<int64_t> empty;
+    empty.range_add(0, 5, 1); // no-op
+    EXPECT_EQ(empty.range_sum(0, 5), 0);
+    EXPECT_EQ(empty.prefix_sum(3), 0);
+}
+
+// ==================== BlockedFenwickTree ====================
+
+TEST(BlockedFenwickTree, BuildMatchesFenwickTree) {
+    std::mt19937_64 rng(5);
+    // Sizes around line (8) and level (64, 512) boundaries.
+    for (int n : {0, 1, 7, 8, 9, 63, 64, 65, 511, 512, 513, 5000}) {
+        std::vector<int64_t> a(static_cast<size_t>(n));
+        for (auto& x : a) {
+            x = static_cast<int64_t>(rng() % 2001) - 1000;
+        }
+        BlockedFenwickTree<int64_t> blocked(a);
+        FenwickTree reference(a);
+        ASSERT_EQ(blocked.size(), n);
+        for (int r = -1; r <= n; ++r) {
+            ASSERT_EQ(blocked.prefix_sum(r), reference.prefix_sum(r)) << "n=" << n << " r=" << r;
+        }
+    }
+}
+
+TEST(BlockedFenwickTree, RandomAgainstFenwickTree) {
+    constexpr int N = 3000;
+    std::mt19937_64 rng(17);
+    std::uniform_int_distribution<int> idxDist(-10, N + 10);
+    std::uniform_int_distribution<int64_t> deltaDist(-1000, 1000);
+
+    BlockedFenwickTree<int64_t> blocked(N);
+    FenwickTree reference(N);
+    for (int op = 0; op < 5000; ++op) {
+        const int l = idxDist(rng);
+        const int r = idxDist(rng);
+        if (rng() % 2 == 0) {
+            const int64_t delta = deltaDist(rng);
+            blocked.add(l, delta);
+            reference.add(l, delta);
+        } else {
+            EXPECT_EQ(blocked.range_sum(l, r), reference.range_sum(l, r));
+        }
+    }
+}
+
+TEST(BlockedFenwickTree, NarrowElements) {
+    // 16 int32 per line.
+    BlockedFenwickTree<int32_t> t(std::vector<int32_t>(1000, 1));
+    EXPECT_EQ(t.prefix_sum(999), 1000);
+    t.add(500, 5);
+    EXPECT_EQ(t.range_sum(400, 599), 205);
+}
+
+// ==================== FenwickTree2D ====================
+
+TEST(FenwickTree2D, RandomAgainstNaive) {
+    constexpr int R = 23, C = 37;
+    std::mt19937_64 rng(31);
+    std::vector<std::vector<int64_t>> a(R, std::vector<int64_t>(C, 0));
+    FenwickTree2D<int64_t> t(R, C);
+    EXPECT_EQ(t.rows(), R);
+    EXPECT_EQ(t.cols(), C);
+
+    for (int op = 0; op < 3000; ++op) {
+        int r1 = static_cast<int>(rng() % (R + 4)) - 2;
+        int c1 = static_cast<int>(rng() % (C + 4)) - 2;
+        if (rng() % 2 == 0) {
+            const int64_t delta = static_cast<int64_t>(rng() % 201) - 100;
+            if (0 <= r1 && r1 < R && 0 <= c1 && c1 < C) {
+                a[r1][c1] += delta;
+            }
+            t.add(r1, c1, delta);
+        } else {
+            int r2 = static_cast<int>(rng() % (R + 4)) - 2;
+            int c2 = static_cast<int>(rng() % (C + 4)) - 2;
+            int64_t expected = 0;
+            for (int i = std::max(r1, 0); i <= std::min(r2, R - 1); ++i) {
+                for (int j = std::max(c1, 0); j <= std::min(c2, C - 1); ++j) {
+                    expected += a[i][j];
+                }
+            }
+            EXPECT_EQ(t.rect_sum(r1, c1, r2, c2), expected);
+        }
+    }
+}
+
+TEST(FenwickTree2D, Empty) {
+    FenwickTree2D<int64_t> t;
+    t.add(0, 0, 5); // no-op
+    EXPECT_EQ(t.prefix_sum(3, 3), 0);
+    EXPECT_EQ(t.rect_sum(0, 0, 3, 3), 0);
+}
+
+TEST(ConcurrentFenwickTree, SingleThreadAgainstFenwickTree) {
+    std::mt19937 rng(21);
+    for (int n : {0, 1, 7, 64, 1000}) {
+        std::vector<int64_t> a(static_cast<size_t>(n));
+        for (auto& x : a) {
+            x = static_cast<int64_t>(rng() % 100) - 50;
+        }
+        FenwickTree ref(a);
+        ConcurrentFenwickTree c(a);
+        ShardedFenwickTree s(n, 3);
+        for (int i = 0; i < n; ++i) {
+            s.add(i % 3, i, a[static_cast<size_t>(i)]);
+        }
+        ASSERT_EQ(c.size(), n);
+        ASSERT_EQ(s.size(), n);
+        for (int step = 0; step < 2000; ++step) {
+            const int idx = static_cast<int>(rng() % static_cast<unsigned>(n + 4)) - 2;
+            const int64_t d = static_cast<int64_t>(rng() % 100) - 50;
+            ref.add(idx, d);
+            c.add(idx, d);
+            s.add(idx, d);
+            const int l = static_cast<int>(rng() % static_cast<unsigned>(n + 4)) - 2;
+            const int r = static_cast<int>(rng() % static_cast<unsigned>(n + 4)) - 2;
+            ASSERT_EQ(c.prefix_sum(r), ref.prefix_sum(r));
+            ASSERT_EQ(c.range_sum(l, r), ref.range_sum(l, r));
+            ASSERT_EQ(s.prefix_sum(r), ref.prefix_sum(r));
+            ASSERT_EQ(s.range_sum(l, r), ref.range_sum(l, r));
+        }
+    }
+}
+
+TEST(ConcurrentFenwickTree, ParallelAddsAreExactAndMonotone) {
+    const int n = 1 << 12, threads = 8, per_thread = 20000;
+    ConcurrentFenwickTree c(n);
+    ShardedFenwickTree s(n, 4); // fewer shards than threads: shards are shared
+    std::atomic<bool> done{false};
+    std::atomic<bool> monotone{true};
+    std::thread reader([&] {
+        // Non-negative deltas: each total is at least the one before.
+        int64_t last_c = 0, last_s = 0;
+        while (!done.load()) {
+            const int64_t tc = c.prefix_sum(n - 1), ts = s.prefix_sum(n - 1);
+            if (tc < last_c || ts < last_s) {
+                monotone = false;
+            }
+            last_c = tc;
+            last_s = ts;
+        }
+    });
+    std::vector<std::thread> pool;
+    for (int t = 0; t < threads; ++t) {
+        pool.emplace_back([&, t] {
+            std::mt19937 rng(static_cast<unsigned>(t));
+            for (int i = 0; i < per_thread; ++i) {
+                const int idx = static_cast<int>(rng() % n);
+                c.add(idx, idx % 3);
+                s.add(idx, idx % 3);
+            }
+        });
+    }
+    for (auto& th : pool) {
+        th.join();
+    }
+    done = true;
+    reader.join();
+    EXPECT_TRUE(monotone.load());
+
+    FenwickTree ref(n);
+    for (int t = 0; t < threads; ++t) {
+        std::mt19937 rng(static_cast<unsigned>(t));
+        for (int i = 0; i < per_thread; ++i) {
+            const int idx = static_cast<int>(rng() % n);
+            ref.add(idx, idx % 3);
+        }
+    }
+    for (int r = 0; r < n; r += 97) {
+        ASSERT_EQ(c.prefix_sum(r), ref.prefix_sum(r));
+        ASSERT_EQ(s.prefix_sum(r), ref.prefix_sum(r));
+        ASSERT_EQ(s.range_sum(r / 2, r), ref.range_sum(r / 2, r));
+    }
+}
+
+TEST(ShardedFenwickTree, ShardsAndEmpty) {
+    ShardedFenwickTree empty;
+    empty.add(0, 1); // no-op
+    EXPECT_EQ(empty.prefix_sum(5), 0);
+
+    ShardedFenwickTree def(10);
+    EXPECT_GE(def.shards(), 1);
+
+    ShardedFenwickTree s(5, 2);
+    s.add(0, 1, 10);
+    s.add(1, 1, 5);
+    s.add(7, 4, 1);   // shard 7 % 2
+    s.add(-1, 2, 3);  // any shard id maps to some shard
+    s.add(0, 5, 100); // out of range
+    EXPECT_EQ(s.range_sum(1, 1), 15);
+    EXPECT_EQ(s.prefix_sum(100), 19);
+    EXPECT_EQ(s.range_sum(3, 1), 0);
+}
+
 } // namespace
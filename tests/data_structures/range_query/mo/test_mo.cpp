@@ -1,6 +1,16 @@
 #include "data_structures/range_query/mo/mo.h"
+#include "data_structures/range_query/mo/mo_engine.h"
 
+#include <algorithm>
+#include <cstdint>
+#include <cstdlib>
 #include <gtest/gtest.h>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <set>
+#include <stdexcept>
+#include <utility>
 #include <vector>
 
 using namespace ds::range_query::mo;
@@ -21,3 +31,224 @@ TEST(MoTest, EmptyQueries) {
     auto ans = mo_solve_distinct(A, queries);
     EXPECT_TRUE(ans.empty());
 }
+
+namespace {
+std::vector<Query> random_queries(int n, int q, unsigned seed) {
+    std::mt19937 rng(seed);
+    std::vector<Query> out;
+    for (int i = 0; i < q; ++i) {
+        int l = static_cast<int>(rng() % n), r = static_cast<int>(rng() % n);
+        if (l > r)
+            std::swap(l, r);
+        out.push_back({l, r, i});
+    }
+    return out;
+}
+
+int naive_distinct(const std::vector<int>& a, int l, int r) {
+    std::set<int> s(a.begin() + l, a.begin() + r + 1);
+    return static_cast<int>(s.size());
+}
+
+struct RangeSum {
+    const std::vector<int64_t>& a;
+    int64_t sum = 0;
+    void add(int p) { sum += a[static_cast<size_t>(p)]; }
+    void remove(int p) { sum -= a[static_cast<size_t>(p)]; }
+    int64_t answer() const { return sum; }
+};
+} // namespace
+
+TEST(MoTest, BothOrdersMatchNaiveDistinct) {
+    std::mt19937 rng(34);
+    std::vector<int> A(300);
+    for (auto& x : A)
+        x = static_cast<int>(rng() % 40) - 20;
+    const auto queries = random_queries(300, 500, 1);
+    const auto hilbert = mo_solve_distinct(A, queries, MoOrder::kHilbert);
+    const auto odd_even = mo_solve_distinct(A, queries, MoOrder::kBlockOddEven);
+    for (const auto& q : queries) {
+        ASSERT_EQ(hilbert[q.idx], naive_distinct(A, q.l, q.r));
+        ASSERT_EQ(odd_even[q.idx], naive_distinct(A, q.l, q.r));
+    }
+}
+
+TEST(MoTest, GenericEngineRangeSum) {
+    std::vector<int64_t> a(200);
+    std::iota(a.begin(), a.end(), -50);
+    const auto queries = random_queries(200, 300, 2);
+    RangeSum state{a};
+    const auto ans = Mo<RangeSum>(200).solve(state, queries);
+    for (const auto& q : queries) {
+        ASSERT_EQ(ans[q.idx], std::accumulate(a.begin() + q.l, a.begin() + q.r + 1, int64_t{0}));
+    }
+}
+
+TEST(MoTest, HilbertOrderIsABijectionWithUnitSteps) {
+    const int log_side = 4;
+    const int side = 1 << log_side;
+    std::vector<std::pair<int, int>> by_d(side * side, {-1, -1});
+    for (int x = 0; x < side; ++x) {
+        for (int y = 0; y < side; ++y) {
+            const auto d = hilbert_order(x, y, log_side);
+            ASSERT_LT(d, by_d.size());
+            ASSERT_EQ(by_d[d].first, -1);
+            by_d[d] = {x, y};
+        }
+    }
+    for (size_t d = 1; d < by_d.size(); ++d) {
+        ASSERT_EQ(std::abs(by_d[d].first - by_d[d - 1].first) +
+                      std::abs(by_d[d].second - by_d[d - 1].second),
+                  1);
+    }
+}
+
+TEST(MoTest, HilbertMovesFewerThanOddEven) {
+    auto hilbert = random_queries(1 << 14, 1 << 16, 3);
+    auto odd_even = hilbert;
+    sort_queries(hilbert, 1 << 14, MoOrder::kHilbert);
+    sort_queries(odd_even, 1 << 14, MoOrder::kBlockOddEven);
+    EXPECT_LT(count_moves(hilbert), count_moves(odd_even));
+}
+
+namespace {
+// Distinct count over an array with point assignments.
+struct DistinctWithUpdates {
+    std::vector<int> a;
+    std::vector<std::pair<int, int>> updates; // (pos, value), swapped in place
+    std::vector<int> freq = std::vector<int>(64);
+    int distinct = 0;
+
+    void add(int p) { distinct += ++freq[static_cast<size_t>(a[static_cast<size_t>(p)])] == 1; }
+    void remove(int p) { distinct -= --freq[static_cast<size_t>(a[static_cast<size_t>(p)])] == 0; }
+    int answer() const { return distinct; }
+    int update_position(int t) const { return updates[static_cast<size_t>(t)].first; }
+    void swap_update(int t) {
+        auto& [pos, v] = updates[static_cast<size_t>(t)];
+        std::swap(a[static_cast<size_t>(pos)], v);
+    }
+};
+
+// Max with an undo log: no remove.
+struct RollbackMax {
+    const std::vector<int>& a;
+    int best = std::numeric_limits<int>::min();
+    std::vector<int> log;
+
+    void add(int p) {
+        log.push_back(best);
+        best = std::max(best, a[static_cast<size_t>(p)]);
+    }
+    int answer() const { return best; }
+    size_t checkpoint() const { return log.size(); }
+    void rollback(size_t mark) {
+        while (log.size() > mark) {
+            best = log.back();
+            log.pop_back();
+        }
+    }
+};
+} // namespace
+
+TEST(MoTest, MoWithUpdatesMatchesReplay) {
+    std::mt19937 rng(35);
+    const int n = 120;
+    std::vector<int> a(n);
+    for (auto& x : a)
+        x = static_cast<int>(rng() % 64);
+    std::vector<std::pair<int, int>> updates;
+    std::vector<TimedQuery> queries;
+    std::vector<int> expected;
+    std::vector<int> replay = a;
+    for (int step = 0; step < 600; ++step) {
+        if (rng() % 3 == 0) {
+            updates.emplace_back(static_cast<int>(rng() % n), static_cast<int>(rng() % 64));
+            replay[static_cast<size_t>(updates.back().first)] = updates.back().second;
+        } else {
+            int l = static_cast<int>(rng() % n), r = static_cast<int>(rng() % n);
+            if (l > r)
+                std::swap(l, r);
+            queries.push_back({l, r, static_cast<int32_t>(updates.size()),
+                               static_cast<int32_t>(queries.size())});
+            expected.push_back(naive_distinct(replay, l, r));
+        }
+    }
+    DistinctWithUpdates state{a, updates};
+    const auto ans = MoWithUpdates<DistinctWithUpdates>(n).solve(state, queries);
+    EXPECT_EQ(ans, expected);
+}
+
+TEST(MoTest, RollbackMoRangeMax) {
+    std::mt19937 rng(36);
+    std::vector<int> a(257);
+    for (auto& x : a)
+        x = static_cast<int>(rng() % 10'000);
+    const auto queries = random_queries(257, 800, 4);
+    RollbackMax state{a, std::numeric_limits<int>::min(), {}};
+    const auto ans = RollbackMo<RollbackMax>(257).solve(state, queries);
+    for (const auto& q : queries) {
+        ASSERT_EQ(ans[q.idx], *std::max_element(a.begin() + q.l, a.begin() + q.r + 1));
+    }
+    EXPECT_TRUE(state.log.empty());
+}
+
+TEST(MoTest, ParallelMatchesSequential) {
+    std::mt19937 rng(37);
+    std::vector<int> A(2000);
+    for (auto& x : A)
+        x = static_cast<int>(rng() % 300);
+    const auto queries = random_queries(2000, 5000, 5);
+    const auto expected = mo_solve_distinct(A, queries);
+    for (int threads : {1, 2, 3, 8}) {
+        for (auto order : {MoOrder::kHilbert, MoOrder::kBlockOddEven}) {
+            EXPECT_EQ(mo_solve_distinct(A, queries, order, threads), expected) << threads;
+        }
+    }
+    EXPECT_TRUE(mo_solve_distinct(A, {}, MoOrder::kHilbert, 4).empty());
+}
+
+TEST(MoTest, ThreadedSortMatchesSequential) {
+    // Large enough that every thread gets its own slice and merge rounds run.
+    for (MoOrder order : {MoOrder::kHilbert, MoOrder::kBlockOddEven}) {
+        auto seq = random_queries(1 << 12, 50'000, 8);
+        auto par = seq;
+        sort_queries(seq, 1 << 12, order);
+        sort_queries(par, 1 << 12, order, 5);
+        ASSERT_EQ(seq.size(), par.size());
+        for (size_t i = 0; i < seq.size(); ++i) {
+            ASSERT_EQ(seq[i].idx, par[i].idx) << i;
+        }
+    }
+}
+
+TEST(MoTest, PartitionBalancesMoves) {
+    auto queries = random_queries(1 << 12, 1 << 14, 6);
+    sort_queries(queries, 1 << 12, MoOrder::kHilbert);
+    const auto bounds = partition_queries(queries, 4);
+    ASSERT_EQ(bounds.size(), 5u);
+    EXPECT_EQ(bounds.front(), 0u);
+    EXPECT_EQ(bounds.back(), queries.size());
+    std::vector<int64_t> cost;
+    for (size_t c = 0; c + 1 < bounds.size(); ++c) {
+        ASSERT_LT(bounds[c], bounds[c + 1]);
+        cost.push_back(count_moves({queries.begin() + static_cast<std::ptrdiff_t>(bounds[c]),
+                                    queries.begin() + static_cast<std::ptrdiff_t>(bounds[c + 1])}));
+    }
+    const auto [lo, hi] = std::minmax_element(cost.begin(), cost.end());
+    EXPECT_LT(*hi, *lo * 3 / 2); // within 50 % of each other
+
+    // More parts than queries: one query per chunk.
+    const std::vector<Query> two = {{0, 1, 0}, {1, 2, 1}};
+    EXPECT_EQ(partition_queries(two, 8), (std::vector<size_t>{0, 1, 2}));
+}
+
+TEST(MoTest, ParallelWorkerExceptionPropagates) {
+    struct Throwing {
+        void add(int) { throw std::runtime_error("boom"); }
+        void remove(int) {}
+        int answer() const { return 0; }
+    };
+    const auto queries = random_queries(100, 50, 7);
+    EXPECT_THROW(Mo<Throwing>(100).solve_parallel([] { return Throwing{}; }, queries, 3),
+                 std::runtime_error);
+}
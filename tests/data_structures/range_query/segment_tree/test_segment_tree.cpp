@@ -0,0 +1,307 @@
+#include <algorithm>
+#include <cstdint>
+#include <data_structures/range_query/segment_tree/lazy_segment_tree.h>
+#include <data_structures/range_query/segment_tree/persistent_segment_tree.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <random>
+#include <vector>
+
+namespace {
+using namespace ds::range_query::segment_tree;
+
+template <typename Tree> class LazySegmentTreeLayout : public ::testing::Test {};
+using MinAssignTrees =
+    ::testing::Types<LazySegmentTree<MinMonoid<int64_t>, AssignAction<int64_t>, Layout::kAoS>,
+                     LazySegmentTree<MinMonoid<int64_t>, AssignAction<int64_t>, Layout::kSoA>>;
+TYPED_TEST_SUITE(LazySegmentTreeLayout, MinAssignTrees);
+
+TYPED_TEST(LazySegmentTreeLayout, RangeAssignRangeMinAgainstNaive) {
+    std::mt19937 rng(33);
+    for (int n : {1, 2, 5, 16, 17, 100}) {
+        std::vector<int64_t> a(static_cast<size_t>(n));
+        for (auto& x : a) {
+            x = rng() % 1000;
+        }
+        TypeParam t(a);
+        ASSERT_EQ(t.size(), n);
+        std::uniform_int_distribution<int> pos(0, n - 1);
+        for (int step = 0; step < 2000; ++step) {
+            int l = pos(rng), r = pos(rng);
+            if (l > r) {
+                std::swap(l, r);
+            }
+            if (step % 3 == 0) {
+                const int64_t v = rng() % 1000;
+                t.apply(l, r, {v, true});
+                std::fill(a.begin() + l, a.begin() + r + 1, v);
+            } else if (step % 3 == 1) {
+                const int64_t v = rng() % 1000;
+                t.set(l, v);
+                a[static_cast<size_t>(l)] = v;
+            } else {
+                ASSERT_EQ(t.query(l, r), *std::min_element(a.begin() + l, a.begin() + r + 1));
+                ASSERT_EQ(t.get(r), a[static_cast<size_t>(r)]);
+            }
+        }
+        EXPECT_EQ(t.all(), *std::min_element(a.begin(), a.end()));
+    }
+}
+
+TEST(LazySegmentTree, EmptyAndClamping) {
+    LazySegmentTree<MinMonoid<int>, AddAction<int>> empty(0);
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(empty.query(0, 3), std::numeric_limits<int>::max());
+    empty.apply(0, 3, 1); // no-op
+    EXPECT_EQ(empty.max_right(0, [](int) { return true; }), -1);
+
+    LazySegmentTree<MinMonoid<int>, AddAction<int>> t(std::vector<int>{5, 3, 7});
+    EXPECT_EQ(t.query(-10, 10), 3);
+    EXPECT_EQ(t.query(2, 1), std::numeric_limits<int>::max());
+    t.apply(-5, 0, 10); // clamped to [0..0]
+    EXPECT_EQ(t.get(0), 15);
+    t.set(3, 0); // out of range: no-op
+    EXPECT_EQ(t.get(3), std::numeric_limits<int>::max());
+    EXPECT_EQ(t.query(0, 2), 3);
+}
+
+TEST(LazySegmentTree, RangeAddOnExtremeValues) {
+    // Elements equal to lowest() / max() are ordinary data, not sentinels.
+    const int lo = std::numeric_limits<int>::lowest();
+    const int hi = std::numeric_limits<int>::max();
+    LazySegmentTree<MinMonoid<int>, AddAction<int>> mn(std::vector<int>{lo, 0, 7, 9});
+    mn.apply(0, 3, 5);
+    EXPECT_EQ(mn.get(0), lo + 5);
+    EXPECT_EQ(mn.query(0, 3), lo + 5);
+    EXPECT_EQ(mn.all(), lo + 5);
+    EXPECT_EQ(mn.query(1, 3), 5);
+
+    LazySegmentTree<MaxMonoid<int>, AddAction<int>> mx(std::vector<int>{-4, hi, 2});
+    mx.apply(1, 2, -3);
+    EXPECT_EQ(mx.get(1), hi - 3);
+    EXPECT_EQ(mx.query(0, 2), hi - 3);
+    EXPECT_EQ(mx.all(), hi - 3);
+    EXPECT_EQ(mx.query(2, 2), -1);
+}
+
+TEST(LazySegmentTree, RangeAddRangeSumAndMax) {
+    std::mt19937_64 rng(34);
+    const int n = 77;
+    std::vector<int64_t> a(n);
+    std::vector<SumLen<int64_t>> leaves;
+    for (auto& x : a) {
+        x = static_cast<int64_t>(rng() % 2001) - 1000;
+        leaves.push_back(SumMonoid<int64_t>::leaf(x));
+    }
+    LazySegmentTree<SumMonoid<int64_t>, AddAction<int64_t>, Layout::kAoS> sum(leaves);
+    LazySegmentTree<MaxMonoid<int64_t>, AddAction<int64_t>> mx(a);
+    for (int step = 0; step < 3000; ++step) {
+        int l = static_cast<int>(rng() % n), r = static_cast<int>(rng() % n);
+        if (l > r) {
+            std::swap(l, r);
+        }
+        if (step % 2 == 0) {
+            const int64_t f = static_cast<int64_t>(rng() % 201) - 100;
+            sum.apply(l, r, f);
+            mx.apply(l, r, f);
+            for (int i = l; i <= r; ++i) {
+                a[static_cast<size_t>(i)] += f;
+            }
+        } else {
+            int64_t s = 0;
+            for (int i = l; i <= r; ++i) {
+                s += a[static_cast<size_t>(i)];
+            }
+            const auto got = sum.query(l, r);
+            ASSERT_EQ(got.sum, s);
+            ASSERT_EQ(got.len, r - l + 1);
+            ASSERT_EQ(mx.query(l, r), *std::max_element(a.begin() + l, a.begin() + r + 1));
+        }
+    }
+}
+
+TEST(LazySegmentTree, RangeAssignRangeSum) {
+    std::vector<SumLen<int64_t>> leaves(10, SumMonoid<int64_t>::leaf(1));
+    LazySegmentTree<SumMonoid<int64_t>, AssignAction<int64_t>> t(leaves);
+    t.apply(2, 5, {7, true});
+    EXPECT_EQ(t.query(0, 9).sum, 6 + 4 * 7);
+    t.apply(4, 9, {0, true});
+    EXPECT_EQ(t.query(0, 9).sum, 2 + 2 * 7);
+    EXPECT_EQ(t.query(3, 3).sum, 7);
+}
+
+TEST(LazySegmentTree, MaxRightMinLeftAgainstNaive) {
+    std::mt19937 rng(35);
+    const int n = 60;
+    std::vector<SumLen<int64_t>> leaves;
+    std::vector<int64_t> a(n);
+    for (auto& x : a) {
+        x = rng() % 10;
+        leaves.push_back(SumMonoid<int64_t>::leaf(x));
+    }
+    LazySegmentTree<SumMonoid<int64_t>, AddAction<int64_t>> t(leaves);
+    for (int step = 0; step < 500; ++step) {
+        const int l = static_cast<int>(rng() % n), r = static_cast<int>(rng() % n);
+        t.apply(std::min(l, r), std::max(l, r), 1); // keep weights non-negative
+        for (int i = std::min(l, r); i <= std::max(l, r); ++i) {
+            a[static_cast<size_t>(i)] += 1;
+        }
+
+        const int64_t limit = rng() % 400;
+        auto pred = [&](const SumLen<int64_t>& x) { return x.sum <= limit; };
+
+        int expect_r = l - 1;
+        for (int64_t s = 0; expect_r + 1 < n;) {
+            s += a[static_cast<size_t>(expect_r + 1)];
+            if (s > limit) {
+                break;
+            }
+            ++expect_r;
+        }
+        ASSERT_EQ(t.max_right(l, pred), expect_r) << l << " " << limit;
+
+        int expect_l = r + 1;
+        for (int64_t s = 0; expect_l > 0;) {
+            s += a[static_cast<size_t>(expect_l - 1)];
+            if (s > limit) {
+                break;
+            }
+            --expect_l;
+        }
+        ASSERT_EQ(t.min_left(r, pred), expect_l) << r << " " << limit;
+    }
+    auto always = [](const SumLen<int64_t>&) { return true; };
+    EXPECT_EQ(t.max_right(0, always), n - 1);
+    EXPECT_EQ(t.max_right(n, always), n - 1);
+    EXPECT_EQ(t.min_left(n - 1, always), 0);
+    EXPECT_EQ(t.min_left(-1, always), 0);
+}
+
+TEST(PersistentSegmentTree, EveryVersionAgainstSnapshots) {
+    std::mt19937 rng(7);
+    for (int n : {1, 2, 3, 17, 64, 100}) {
+        std::vector<int64_t> a(static_cast<size_t>(n));
+        for (auto& x : a) {
+            x = static_cast<int64_t>(rng() % 100);
+        }
+        PersistentSegmentTree<int64_t> t(a);
+        std::vector<std::vector<int64_t>> snap{a};
+        for (int step = 0; step < 300; ++step) {
+            // Branch from a random earlier version now and then.
+            const int base = rng() % 4 == 0 ? static_cast<int>(rng() % snap.size())
+                                            : static_cast<int>(snap.size()) - 1;
+            const int idx = static_cast<int>(rng() % static_cast<unsigned>(n));
+            const int64_t v = static_cast<int64_t>(rng() % 100);
+            std::vector<int64_t> next = snap[static_cast<size_t>(base)];
+            int id;
+            if (rng() % 2 == 0) {
+                id = t.add(base, idx, v);
+                next[static_cast<size_t>(idx)] += v;
+            } else {
+                id = t.set(base, idx, v);
+                next[static_cast<size_t>(idx)] = v;
+            }
+            ASSERT_EQ(id, static_cast<int>(snap.size()));
+            snap.push_back(std::move(next));
+        }
+        ASSERT_EQ(t.versions(), static_cast<int>(snap.size()));
+        for (int ver = 0; ver < t.versions(); ++ver) {
+            const auto& s = snap[static_cast<size_t>(ver)];
+            for (int q = 0; q < 20; ++q) {
+                int l = static_cast<int>(rng() % static_cast<unsigned>(n));
+                int r = static_cast<int>(rng() % static_cast<unsigned>(n));
+                if (l > r) {
+                    std::swap(l, r);
+                }
+                int64_t expect = 0;
+                for (int i = l; i <= r; ++i) {
+                    expect += s[static_cast<size_t>(i)];
+                }
+                ASSERT_EQ(t.range_sum(ver, l, r), expect) << n << " v" << ver;
+                ASSERT_EQ(t.get(ver, l), s[static_cast<size_t>(l)]);
+
+                const int64_t target = static_cast<int64_t>(rng() % 2000);
+                int expect_lb = 0;
+                for (int64_t acc = 0; expect_lb < n; ++expect_lb) {
+                    acc += s[static_cast<size_t>(expect_lb)];
+                    if (acc >= target) {
+                        break;
+                    }
+                }
+                ASSERT_EQ(t.lower_bound(ver, target), expect_lb) << n << " v" << ver;
+            }
+        }
+    }
+}
+
+TEST(PersistentSegmentTree, PathCopyingMemory) {
+    const int n = 1024; // every leaf at depth 10
+    PersistentSegmentTree<int64_t> t(n);
+    EXPECT_EQ(t.nodes(), 1u); // the shared zero subtree
+    t.reserve(100);
+    for (int i = 0; i < 100; ++i) {
+        t.add(i, i * 7 % n, 1);
+    }
+    EXPECT_EQ(t.nodes(), 1u + 100u * 11u); // one root-to-leaf path per update
+    EXPECT_GE(t.memory_bytes(), t.nodes() * 16);
+    EXPECT_EQ(t.range_sum(100, 0, n - 1), 100);
+    EXPECT_EQ(t.range_sum(0, 0, n - 1), 0);
+
+    PersistentSegmentTree<int64_t> built(std::vector<int64_t>(n, 1));
+    EXPECT_EQ(built.nodes(), 1u + 2u * n - 1u);
+}
+
+TEST(PersistentSegmentTree, KthSmallestInRange) {
+    // Version t holds the value counts of a[0..t-1].
+    std::mt19937 rng(11);
+    const int n = 200, sigma = 50;
+    std::vector<int> a(n);
+    for (auto& x : a) {
+        x = static_cast<int>(rng() % sigma);
+    }
+    PersistentSegmentTree<int> t(sigma);
+    for (int i = 0; i < n; ++i) {
+        ASSERT_EQ(t.add(i, a[static_cast<size_t>(i)], 1), i + 1);
+    }
+    for (int q = 0; q < 500; ++q) {
+        int l = static_cast<int>(rng() % n), r = static_cast<int>(rng() % n);
+        if (l > r) {
+            std::swap(l, r);
+        }
+        std::vector<int> sorted(a.begin() + l, a.begin() + r + 1);
+        std::sort(sorted.begin(), sorted.end());
+        const int k = static_cast<int>(rng() % sorted.size());
+        ASSERT_EQ(t.lower_bound_diff(r + 1, l, k + 1), sorted[static_cast<size_t>(k)]);
+        ASSERT_EQ(t.lower_bound_diff(r + 1, l, r - l + 2), sigma); // past the end
+    }
+}
+
+TEST(PersistentSegmentTree, EmptyAndInvalid) {
+    PersistentSegmentTree<int64_t> empty;
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(empty.versions(), 1);
+    EXPECT_EQ(empty.range_sum(0, 0, 0), 0);
+    EXPECT_EQ(empty.lower_bound(0, 1), 0);
+    EXPECT_EQ(empty.add(0, 0, 5), 1); // out of range: shares the old root
+    EXPECT_EQ(empty.nodes(), 1u);
+
+    PersistentSegmentTree<int64_t> t({1, 2, 3, 4});
+    EXPECT_EQ(t.add(5, 0, 1), -1);
+    EXPECT_EQ(t.add(-1, 0, 1), -1);
+    EXPECT_EQ(t.set(1, 0, 1), -1);
+    EXPECT_EQ(t.versions(), 1);
+
+    const size_t nodes = t.nodes();
+    EXPECT_EQ(t.add(0, 4, 100), 1);
+    EXPECT_EQ(t.add(0, -1, 100), 2);
+    EXPECT_EQ(t.nodes(), nodes);
+    EXPECT_EQ(t.range_sum(2, -5, 50), 10);
+    EXPECT_EQ(t.range_sum(0, 3, 1), 0);
+    EXPECT_EQ(t.range_sum(7, 0, 3), 0);
+    EXPECT_EQ(t.get(0, 4), 0);
+    EXPECT_EQ(t.lower_bound(0, 11), 4);
+    EXPECT_EQ(t.lower_bound(0, 0), 0);
+    EXPECT_EQ(t.lower_bound(0, 4), 2);
+}
+
+} // namespace
@@ -0,0 +1,259 @@
+#include <algorithm>
+#include <cstdint>
+#include <data_structures/range_query/sparse_table/lca.h>
+#include <data_structures/range_query/sparse_table/linear_rmq.h>
+#include <data_structures/range_query/sparse_table/sparse_table.h>
+#include <gtest/gtest.h>
+#include <limits>
+#include <numeric>
+#include <random>
+#include <utility>
+#include <vector>
+
+namespace {
+using ds::range_query::sparse_table::AndOp;
+using ds::range_query::sparse_table::DisjointSparseTable;
+using ds::range_query::sparse_table::EulerTourLca;
+using ds::range_query::sparse_table::GcdOp;
+using ds::range_query::sparse_table::LinearRmq;
+using ds::range_query::sparse_table::MaxOp;
+using ds::range_query::sparse_table::MinOp;
+using ds::range_query::sparse_table::OrOp;
+using ds::range_query::sparse_table::SparseTable;
+using ds::range_query::sparse_table::SumOp;
+
+TEST(SparseTable, Empty) {
+    SparseTable<int64_t> st;
+    EXPECT_EQ(st.size(), 0);
+    EXPECT_EQ(st.query(0, 0), std::numeric_limits<int64_t>::max());
+
+    DisjointSparseTable<int64_t> dst(std::vector<int64_t>{});
+    EXPECT_EQ(dst.size(), 0);
+    EXPECT_EQ(dst.query(0, 5), 0);
+}
+
+TEST(SparseTable, SimpleAndClamping) {
+    SparseTable<int> st({5, 2, 8, 1, 9, 3});
+
+    EXPECT_EQ(st.query(0, 5), 1);
+    EXPECT_EQ(st.query(0, 2), 2);
+    EXPECT_EQ(st.query(4, 5), 3);
+    EXPECT_EQ(st.query(2, 2), 8);
+    EXPECT_EQ(st.query(-10, 1), 2);                          // clamped
+    EXPECT_EQ(st.query(4, 100), 3);                          // clamped
+    EXPECT_EQ(st.query(3, 2), std::numeric_limits<int>::max()); // empty
+}
+
+TEST(SparseTable, IdempotentOpsAgainstNaive) {
+    std::mt19937 rng(31);
+    std::uniform_int_distribution<uint32_t> dist(1, 1u << 20);
+    for (int n : {1, 2, 3, 7, 64, 65, 200}) {
+        std::vector<uint32_t> a(static_cast<size_t>(n));
+        for (auto& x : a) {
+            x = dist(rng) * 6; // common factors so gcd is not always 1
+        }
+        SparseTable<uint32_t, MinOp<uint32_t>> mn(a);
+        SparseTable<uint32_t, MaxOp<uint32_t>> mx(a);
+        SparseTable<uint32_t, GcdOp<uint32_t>> g(a);
+        SparseTable<uint32_t, AndOp<uint32_t>> an(a);
+        SparseTable<uint32_t, OrOp<uint32_t>> o(a);
+        for (int l = 0; l < n; ++l) {
+            uint32_t emn = a[static_cast<size_t>(l)], emx = emn, eg = emn, ean = emn, eo = emn;
+            for (int r = l; r < n; ++r) {
+                const uint32_t x = a[static_cast<size_t>(r)];
+                emn = std::min(emn, x);
+                emx = std::max(emx, x);
+                eg = std::gcd(eg, x);
+                ean &= x;
+                eo |= x;
+                ASSERT_EQ(mn.query(l, r), emn) << n << " " << l << " " << r;
+                ASSERT_EQ(mx.query(l, r), emx);
+                ASSERT_EQ(g.query(l, r), eg);
+                ASSERT_EQ(an.query(l, r), ean);
+                ASSERT_EQ(o.query(l, r), eo);
+            }
+        }
+    }
+}
+
+TEST(DisjointSparseTable, SumAgainstPrefixSums) {
+    std::mt19937_64 rng(5);
+    std::uniform_int_distribution<int64_t> dist(-1000, 1000);
+    for (int n : {1, 2, 3, 5, 8, 9, 100, 257}) {
+        std::vector<int64_t> a(static_cast<size_t>(n));
+        for (auto& x : a) {
+            x = dist(rng);
+        }
+        std::vector<int64_t> pre(a.size() + 1, 0);
+        std::partial_sum(a.begin(), a.end(), pre.begin() + 1);
+        DisjointSparseTable<int64_t, SumOp<int64_t>> dst(a);
+        ASSERT_EQ(dst.size(), n);
+        for (int l = 0; l < n; ++l) {
+            for (int r = l; r < n; ++r) {
+                ASSERT_EQ(dst.query(l, r),
+                          pre[static_cast<size_t>(r) + 1] - pre[static_cast<size_t>(l)])
+                    << n << " " << l << " " << r;
+            }
+        }
+        EXPECT_EQ(dst.query(-5, n + 5), pre.back());
+        EXPECT_EQ(dst.query(n, n + 1), 0);
+    }
+}
+
+// 2x2 matrix product mod p: associative, not commutative, not idempotent.
+struct Mat {
+    uint64_t a = 1, b = 0, c = 0, d = 1;
+    bool operator==(const Mat&) const = default;
+};
+
+struct MatMulOp {
+    static constexpr bool kIdempotent = false;
+    static constexpr uint64_t kMod = 1'000'000'007;
+    static Mat identity() { return {}; }
+    static Mat op(const Mat& x, const Mat& y) {
+        return {(x.a * y.a + x.b * y.c) % kMod, (x.a * y.b + x.b * y.d) % kMod,
+                (x.c * y.a + x.d * y.c) % kMod, (x.c * y.b + x.d * y.d) % kMod};
+    }
+};
+
+TEST(DisjointSparseTable, NonCommutativeOpKeepsOrder) {
+    std::mt19937_64 rng(9);
+    std::vector<Mat> a(50);
+    for (auto& m : a) {
+        m = {rng() % 100, rng() % 100, rng() % 100, rng() % 100};
+    }
+    DisjointSparseTable<Mat, MatMulOp> dst(a);
+    for (int l = 0; l < 50; ++l) {
+        Mat expected = MatMulOp::identity();
+        for (int r = l; r < 50; ++r) {
+            expected = MatMulOp::op(expected, a[static_cast<size_t>(r)]);
+            ASSERT_EQ(dst.query(l, r), expected) << l << " " << r;
+        }
+    }
+}
+
+int naive_argmin(const std::vector<int>& a, int l, int r) {
+    int best = l;
+    for (int i = l + 1; i <= r; ++i) {
+        if (a[static_cast<size_t>(i)] < a[static_cast<size_t>(best)]) {
+            best = i;
+        }
+    }
+    return best;
+}
+
+TEST(LinearRmq, EmptyAndClamping) {
+    LinearRmq<int> empty(std::vector<int>{});
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(empty.argmin(0, 10), -1);
+
+    LinearRmq<int> rmq({4, 1, 3, 1, 2});
+    EXPECT_EQ(rmq.argmin(0, 4), 1); // leftmost of the tied minima
+    EXPECT_EQ(rmq.argmin(2, 4), 3);
+    EXPECT_EQ(rmq.argmin(-3, 0), 0);
+    EXPECT_EQ(rmq.argmin(4, 99), 4);
+    EXPECT_EQ(rmq.argmin(3, 2), -1);
+    EXPECT_EQ(rmq.value_at(rmq.argmin(0, 4)), 1);
+}
+
+TEST(LinearRmq, RandomAgainstNaive) {
+    std::mt19937 rng(32);
+    for (int n : {1, 63, 64, 65, 130, 1000}) {
+        for (int range : {3, 1'000'000}) { // many ties, then few
+            std::uniform_int_distribution<int> dist(0, range);
+            std::vector<int> a(static_cast<size_t>(n));
+            for (auto& x : a) {
+                x = dist(rng);
+            }
+            LinearRmq<int> rmq(a);
+            std::uniform_int_distribution<int> pos(0, n - 1);
+            std::vector<std::pair<int, int>> qs;
+            for (int q = 0; q < 2000; ++q) {
+                int l = pos(rng), r = pos(rng);
+                if (l > r) {
+                    std::swap(l, r);
+                }
+                qs.emplace_back(l, r);
+                ASSERT_EQ(rmq.argmin(l, r), naive_argmin(a, l, r)) << n << " " << l << " " << r;
+            }
+            std::vector<int> out;
+            rmq.argmin_batch(qs, out);
+            ASSERT_EQ(out.size(), qs.size());
+            for (size_t q = 0; q < qs.size(); ++q) {
+                ASSERT_EQ(out[q], naive_argmin(a, qs[q].first, qs[q].second));
+            }
+        }
+    }
+}
+
+TEST(LinearRmq, CustomCompareGivesArgmax) {
+    LinearRmq<int, std::greater<int>> rmq({1, 5, 2, 5, 0});
+    EXPECT_EQ(rmq.argmin(0, 4), 1);
+    EXPECT_EQ(rmq.argmin(2, 4), 3);
+}
+
+TEST(LinearRmq, UsesLessMemoryThanSparseTable) {
+    std::vector<int64_t> a(1 << 16, 7);
+    LinearRmq<int64_t> rmq(a);
+    SparseTable<int64_t> st(a);
+    EXPECT_LT(rmq.memory_bytes() * 4, st.memory_bytes());
+}
+
+TEST(EulerTourLca, RandomTreeAgainstParentWalk) {
+    std::mt19937 rng(33);
+    const int n = 500;
+    std::vector<int32_t> parent(n, -1);
+    EulerTourLca::AdjList g(n);
+    for (int v = 1; v < n; ++v) {
+        parent[static_cast<size_t>(v)] = static_cast<int32_t>(rng() % static_cast<unsigned>(v));
+        g[static_cast<size_t>(v)].push_back(parent[static_cast<size_t>(v)]);
+        g[static_cast<size_t>(parent[static_cast<size_t>(v)])].push_back(v);
+    }
+    EulerTourLca lca(g, 0);
+
+    auto naive = [&](int32_t u, int32_t v) {
+        std::vector<bool> anc(n, false);
+        for (int32_t x = u; x != -1; x = parent[static_cast<size_t>(x)]) {
+            anc[static_cast<size_t>(x)] = true;
+        }
+        int32_t x = v;
+        while (!anc[static_cast<size_t>(x)]) {
+            x = parent[static_cast<size_t>(x)];
+        }
+        return x;
+    };
+
+    std::vector<std::pair<int32_t, int32_t>> qs;
+    for (int q = 0; q < 2000; ++q) {
+        const auto u = static_cast<int32_t>(rng() % n);
+        const auto v = static_cast<int32_t>(rng() % n);
+        qs.emplace_back(u, v);
+        ASSERT_EQ(lca.lca(u, v), naive(u, v)) << u << " " << v;
+    }
+    std::vector<int32_t> out;
+    lca.lca_batch(qs, out);
+    for (size_t q = 0; q < qs.size(); ++q) {
+        ASSERT_EQ(out[q], naive(qs[q].first, qs[q].second));
+    }
+    EXPECT_EQ(lca.depth(0), 0);
+}
+
+TEST(EulerTourLca, ForestAndInvalidVertices) {
+    // 0-1-2 and an isolated 3.
+    EulerTourLca lca(EulerTourLca::AdjList{{1}, {0, 2}, {1}, {}}, 0);
+    EXPECT_EQ(lca.lca(2, 2), 2);
+    EXPECT_EQ(lca.lca(1, 2), 1);
+    EXPECT_EQ(lca.lca(0, 3), -1);
+    EXPECT_EQ(lca.lca(-1, 0), -1);
+    EXPECT_EQ(lca.depth(2), 2);
+    EXPECT_EQ(lca.depth(3), -1);
+
+    std::vector<int32_t> out;
+    lca.lca_batch({{2, 1}, {3, 0}}, out);
+    EXPECT_EQ(out, (std::vector<int32_t>{1, -1}));
+
+    EulerTourLca bad_root(EulerTourLca::AdjList{{}}, 5);
+    EXPECT_EQ(bad_root.lca(0, 0), -1);
+}
+
+} // namespace
@@ -1,6 +1,11 @@
+#include "data_structures/range_query/sqrt_decomposition/lazy_sqrt_decomposition.h"
 #include "data_structures/range_query/sqrt_decomposition/sqrt_decomposition.h"
 
+#include <algorithm>
+#include <cstdint>
 #include <gtest/gtest.h>
+#include <numeric>
+#include <random>
 #include <vector>
 
 using namespace ds::range_query::sqrt_decomposition;
@@ -33,3 +38,109 @@ TEST(SqrtDecompositionTest, EdgeCases) {
     dsSingle.update(0, 7);
     EXPECT_EQ(dsSingle.query(0, 0), 7);
 }
+
+// ---- LazySqrtDecomposition ----
+
+namespace {
+// gcd with range assignment: a custom monoid (repeat(x, k) == x).
+struct GcdMonoid {
+    using value_type = int64_t;
+    static int64_t identity() { return 0; }
+    static int64_t op(int64_t a, int64_t b) { return std::gcd(a, b); }
+    static int64_t repeat(int64_t x, int64_t) { return x; }
+};
+
+// Random range updates / queries against a plain array. Block sizes 1, 4
+// and the default cover single-element blocks, many blocks and a short
+// last block.
+template <typename M, typename A, typename Naive, typename MakeTag>
+void check_against_naive(Naive naive_apply, MakeTag make_tag, unsigned seed) {
+    std::mt19937 rng(seed);
+    for (int block : {1, 4, 0}) {
+        const int n = 1 + static_cast<int>(rng() % 150);
+        std::vector<int64_t> a(static_cast<size_t>(n));
+        for (auto& x : a)
+            x = static_cast<int64_t>(rng() % 100);
+        LazySqrtDecomposition<M, A> t(a, block);
+        ASSERT_EQ(t.size(), n);
+        for (int it = 0; it < 2000; ++it) {
+            int l = static_cast<int>(rng() % static_cast<unsigned>(n));
+            int r = static_cast<int>(rng() % static_cast<unsigned>(n));
+            if (l > r)
+                std::swap(l, r);
+            const auto v = static_cast<int64_t>(rng() % 100);
+            switch (rng() % 4) {
+            case 0:
+                t.apply(l, r, make_tag(v));
+                for (int i = l; i <= r; ++i)
+                    a[static_cast<size_t>(i)] = naive_apply(a[static_cast<size_t>(i)], v);
+                break;
+            case 1:
+                t.set(l, v);
+                a[static_cast<size_t>(l)] = v;
+                break;
+            case 2:
+                ASSERT_EQ(t.get(l), a[static_cast<size_t>(l)]);
+                break;
+            default: {
+                int64_t want = M::identity();
+                for (int i = l; i <= r; ++i)
+                    want = M::op(want, a[static_cast<size_t>(i)]);
+                ASSERT_EQ(t.query(l, r), want) << "block " << block << " [" << l << ", " << r << "]";
+            }
+            }
+        }
+    }
+}
+} // namespace
+
+TEST(LazySqrtDecompositionTest, SumAddMatchesNaive) {
+    check_against_naive<SumMonoid<int64_t>, AddAction<int64_t>>(
+        [](int64_t x, int64_t v) { return x + v; }, [](int64_t v) { return v; }, 1);
+}
+
+TEST(LazySqrtDecompositionTest, MinAssignMatchesNaive) {
+    check_against_naive<MinMonoid<int64_t>, AssignAction<int64_t>>(
+        [](int64_t, int64_t v) { return v; },
+        [](int64_t v) { return AssignAction<int64_t>::value_type{v, true}; }, 2);
+}
+
+TEST(LazySqrtDecompositionTest, MaxAddMatchesNaive) {
+    check_against_naive<MaxMonoid<int64_t>, AddAction<int64_t>>(
+        [](int64_t x, int64_t v) { return x + v - 50; }, [](int64_t v) { return v - 50; }, 3);
+}
+
+TEST(LazySqrtDecompositionTest, SumAssignMatchesNaive) {
+    check_against_naive<SumMonoid<int64_t>, AssignAction<int64_t>>(
+        [](int64_t, int64_t v) { return v; },
+        [](int64_t v) { return AssignAction<int64_t>::value_type{v, true}; }, 4);
+}
+
+TEST(LazySqrtDecompositionTest, CustomGcdAssignMatchesNaive) {
+    check_against_naive<GcdMonoid, AssignAction<int64_t>>(
+        [](int64_t, int64_t v) { return v * 6; },
+        [](int64_t v) { return AssignAction<int64_t>::value_type{v * 6, true}; }, 5);
+}
+
+TEST(LazySqrtDecompositionTest, EdgeCasesAndBlockSize) {
+    using Tree = LazySqrtDecomposition<SumMonoid<int64_t>, AddAction<int64_t>>;
+    Tree empty(std::vector<int64_t>{});
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(empty.query(0, 5), 0);
+    empty.apply(0, 5, 1); // no-op
+    empty.set(0, 1);
+
+    Tree t({1, 2, 3, 4, 5}, 3); // rounded up to 4
+    EXPECT_EQ(t.block_size(), 4);
+    t.apply(-10, 10, 1); // clamps to [0..4]
+    EXPECT_EQ(t.query(-3, 100), 20);
+    EXPECT_EQ(t.query(3, 1), 0);
+    EXPECT_EQ(t.get(5), 0);
+    t.set(7, 100); // no-op
+    EXPECT_EQ(t.query(0, 4), 20);
+
+    EXPECT_EQ(Tree::default_block_size(1), 8);
+    EXPECT_EQ(Tree::default_block_size(1 << 12), 32);
+    EXPECT_EQ(Tree::default_block_size(1 << 20), 512);
+    EXPECT_EQ(Tree::default_block_size(1 << 30), static_cast<int>(Tree::kMaxBlockBytes / 8));
+}
@@ -0,0 +1,170 @@
+#include "data_structures/range_query/wavelet/bit_vector.h"
+#include "data_structures/range_query/wavelet/wavelet_matrix.h"
+
+#include <algorithm>
+#include <cstdint>
+#include <gtest/gtest.h>
+#include <limits>
+#include <map>
+#include <random>
+#include <set>
+#include <vector>
+
+using namespace ds::range_query::wavelet;
+
+TEST(BitVectorTest, RankSelectMatchNaive) {
+    std::mt19937 rng(1);
+    for (size_t n : {0u, 1u, 63u, 64u, 255u, 256u, 257u, 1000u, 5000u}) {
+        for (int density : {0, 3, 50, 97, 100}) {
+            BitVector bv(n);
+            std::vector<bool> bits(n);
+            for (size_t i = 0; i < n; ++i) {
+                if (static_cast<int>(rng() % 100) < density) {
+                    bits[i] = true;
+                    bv.set(i);
+                }
+            }
+            bv.build();
+            ASSERT_EQ(bv.size(), n);
+            std::vector<size_t> one_pos, zero_pos;
+            size_t ones = 0;
+            for (size_t i = 0; i <= n; ++i) {
+                ASSERT_EQ(bv.rank1(i), ones) << n << " " << i;
+                ASSERT_EQ(bv.rank0(i), i - ones);
+                if (i < n) {
+                    ASSERT_EQ(bv.get(i), bits[i]);
+                    (bits[i] ? one_pos : zero_pos).push_back(i);
+                    ones += bits[i];
+                }
+            }
+            ASSERT_EQ(bv.ones(), ones);
+            for (size_t k = 0; k < one_pos.size(); ++k)
+                ASSERT_EQ(bv.select1(k), one_pos[k]);
+            for (size_t k = 0; k < zero_pos.size(); ++k)
+                ASSERT_EQ(bv.select0(k), zero_pos[k]);
+            EXPECT_EQ(bv.select1(one_pos.size()), n);
+            EXPECT_EQ(bv.select0(zero_pos.size()), n);
+            EXPECT_EQ(bv.rank1(n + 100), ones); // clamps
+        }
+    }
+}
+
+TEST(WaveletMatrixTest, ExampleQueries) {
+    //                        0  1  2  3  4  5  6  7
+    const std::vector<uint64_t> a = {5, 1, 4, 1, 5, 9, 2, 6};
+    WaveletMatrix wm(a);
+    EXPECT_EQ(wm.size(), 8);
+    EXPECT_EQ(wm.levels(), 4);
+    for (int i = 0; i < 8; ++i)
+        EXPECT_EQ(wm.access(i), a[static_cast<size_t>(i)]);
+    EXPECT_EQ(wm.kth_smallest(0, 7, 0), 1u);
+    EXPECT_EQ(wm.kth_smallest(0, 7, 7), 9u);
+    EXPECT_EQ(wm.kth_smallest(2, 5, 1), 4u); // {4, 1, 5, 9}
+    EXPECT_EQ(wm.rank_less(0, 7, 5), 4);     // 1, 4, 1, 2
+    EXPECT_EQ(wm.range_freq(0, 7, 2, 6), 4); // 5, 4, 5, 2
+    EXPECT_EQ(wm.count(0, 7, 5), 2);
+    EXPECT_EQ(wm.count(1, 3, 5), 0);
+    EXPECT_EQ(wm.select(1, 0), 1);
+    EXPECT_EQ(wm.select(1, 1), 3);
+    EXPECT_EQ(wm.select(1, 2), -1);
+    EXPECT_EQ(wm.select(7, 0), -1);
+    const auto top = wm.top_k(0, 7, 3);
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0], (std::pair<uint64_t, int>{1, 2}));
+    EXPECT_EQ(top[1], (std::pair<uint64_t, int>{5, 2}));
+    EXPECT_EQ(top[2], (std::pair<uint64_t, int>{2, 1}));
+}
+
+TEST(WaveletMatrixTest, RandomMatchesNaive) {
+    std::mt19937_64 rng(2);
+    for (uint64_t sigma : {1ull, 2ull, 17ull, 1000ull}) {
+        const int n = 300;
+        std::vector<uint64_t> a(static_cast<size_t>(n));
+        for (auto& x : a)
+            x = rng() % sigma;
+        WaveletMatrix wm(a);
+        for (int it = 0; it < 500; ++it) {
+            int l = static_cast<int>(rng() % n), r = static_cast<int>(rng() % n);
+            if (l > r)
+                std::swap(l, r);
+            std::vector<uint64_t> sub(a.begin() + l, a.begin() + r + 1);
+            std::sort(sub.begin(), sub.end());
+            const int k = static_cast<int>(rng() % sub.size());
+            ASSERT_EQ(wm.kth_smallest(l, r, k), sub[static_cast<size_t>(k)]);
+            const uint64_t x = rng() % (sigma + 2), y = rng() % (sigma + 2);
+            ASSERT_EQ(wm.rank_less(l, r, x),
+                      std::lower_bound(sub.begin(), sub.end(), x) - sub.begin());
+            ASSERT_EQ(wm.count(l, r, x), std::count(sub.begin(), sub.end(), x));
+            ASSERT_EQ(wm.range_freq(l, r, std::min(x, y), std::max(x, y)),
+                      std::lower_bound(sub.begin(), sub.end(), std::max(x, y)) -
+                          std::lower_bound(sub.begin(), sub.end(), std::min(x, y)));
+
+            // top_k: by count descending, then value ascending.
+            std::map<uint64_t, int> freq;
+            for (auto v : sub)
+                ++freq[v];
+            std::vector<std::pair<uint64_t, int>> want(freq.begin(), freq.end());
+            std::stable_sort(want.begin(), want.end(),
+                             [](const auto& p, const auto& q) { return p.second > q.second; });
+            const int tk = 1 + static_cast<int>(rng() % 5);
+            want.resize(std::min(want.size(), static_cast<size_t>(tk)));
+            ASSERT_EQ(wm.top_k(l, r, tk), want);
+        }
+        // select against the positions of each value.
+        std::map<uint64_t, std::vector<int>> pos;
+        for (int i = 0; i < n; ++i)
+            pos[a[static_cast<size_t>(i)]].push_back(i);
+        for (const auto& [v, ps] : pos) {
+            for (size_t k = 0; k < ps.size(); ++k)
+                ASSERT_EQ(wm.select(v, static_cast<int>(k)), ps[k]);
+            ASSERT_EQ(wm.select(v, static_cast<int>(ps.size())), -1);
+        }
+    }
+}
+
+TEST(WaveletMatrixTest, FullWidthValuesAndEdgeCases) {
+    const uint64_t big = std::numeric_limits<uint64_t>::max();
+    WaveletMatrix wm({big, 0, big - 1, 7});
+    EXPECT_EQ(wm.levels(), 64);
+    EXPECT_EQ(wm.access(0), big);
+    EXPECT_EQ(wm.kth_smallest(0, 3, 3), big);
+    EXPECT_EQ(wm.kth_smallest(0, 3, 2), big - 1);
+    EXPECT_EQ(wm.rank_less(0, 3, big), 3);
+    EXPECT_EQ(wm.count(0, 3, big), 1);
+    EXPECT_EQ(wm.select(big, 0), 0);
+
+    // Clamping and empty ranges.
+    EXPECT_EQ(wm.kth_smallest(-5, 100, 0), 0u);
+    EXPECT_EQ(wm.kth_smallest(2, 1, 0), std::nullopt);
+    EXPECT_EQ(wm.kth_smallest(0, 3, 4), std::nullopt);
+    EXPECT_EQ(wm.kth_smallest(0, 3, -1), std::nullopt);
+    EXPECT_EQ(wm.rank_less(3, 1, 100), 0);
+    EXPECT_EQ(wm.range_freq(0, 3, 9, 2), 0);
+    EXPECT_TRUE(wm.top_k(0, 3, 0).empty());
+    EXPECT_EQ(wm.access(4), 0u);
+
+    WaveletMatrix empty(std::vector<uint64_t>{});
+    EXPECT_EQ(empty.size(), 0);
+    EXPECT_EQ(empty.kth_smallest(0, 0, 0), std::nullopt);
+    EXPECT_EQ(empty.rank_less(0, 0, 1), 0);
+    EXPECT_EQ(empty.select(0, 0), -1);
+    EXPECT_TRUE(empty.top_k(0, 5, 3).empty());
+}
+
+TEST(RangeDistinctTest, RandomMatchesNaive) {
+    std::mt19937 rng(3);
+    std::vector<int> a(400);
+    for (auto& x : a)
+        x = static_cast<int>(rng() % 40) - 20; // negative values too
+    RangeDistinct rd(a);
+    EXPECT_EQ(rd.size(), 400);
+    for (int it = 0; it < 2000; ++it) {
+        int l = static_cast<int>(rng() % 400), r = static_cast<int>(rng() % 400);
+        if (l > r)
+            std::swap(l, r);
+        const std::set<int> s(a.begin() + l, a.begin() + r + 1);
+        ASSERT_EQ(rd.distinct(l, r), static_cast<int>(s.size()));
+    }
+    EXPECT_EQ(rd.distinct(5, 4), 0);
+    EXPECT_EQ(rd.distinct(-10, 1000), static_cast<int>(std::set<int>(a.begin(), a.end()).size()));
+}
@@ -1,10 +1,22 @@
 #include <algorithm>
+#include <atomic>
+#include <cstdio>
+#include <data_structures/trie/concurrent_trie.h>
+#include <data_structures/trie/double_array_trie.h>
+#include <data_structures/trie/radix_trie.h>
 #include <data_structures/trie/trie.h>
 #include <gtest/gtest.h>
+#include <map>
+#include <random>
+#include <set>
 #include <string>
+#include <thread>
 #include <vector>
 
 namespace {
+using ds::trie::ConcurrentTrie;
+using ds::trie::DoubleArrayTrie;
+using ds::trie::RadixTrie;
 using ds::trie::Trie;
 
 // ---- Construction & Empty State ----
@@ -420,4 +432,561 @@ TEST(Trie, LongestPrefixOfAfterErase) {
     EXPECT_EQ(t.longest_prefix_of("abcdef"), "");
 }
 
+// ---- Top-k completion ----
+
+TEST(Trie, TopKWithPrefixBasic) {
+    Trie t;
+    t.insert("car", 50);
+    t.insert("cart", 70);
+    t.insert("care", 20);
+    t.insert("cat", 90);
+    t.insert("dog", 100);
+    t.insert("ca"); // score 0
+
+    const auto top = t.top_k_with_prefix("ca", 3);
+    ASSERT_EQ(top.size(), 3u);
+    EXPECT_EQ(top[0], std::make_pair(std::string("cat"), int64_t{90}));
+    EXPECT_EQ(top[1], std::make_pair(std::string("cart"), int64_t{70}));
+    EXPECT_EQ(top[2], std::make_pair(std::string("car"), int64_t{50}));
+
+    EXPECT_EQ(t.top_k_with_prefix("ca", 10).size(), 5u);
+    EXPECT_EQ(t.top_k_with_prefix("", 1)[0].first, "dog");
+    EXPECT_TRUE(t.top_k_with_prefix("ca", 0).empty());
+    EXPECT_TRUE(t.top_k_with_prefix("ca", -1).empty());
+    EXPECT_TRUE(t.top_k_with_prefix("x", 5).empty());
+    EXPECT_TRUE(t.top_k_with_prefix("ca1", 5).empty());
+
+    EXPECT_EQ(t.score("ca"), 0);
+    EXPECT_EQ(t.score("cat"), 90);
+    EXPECT_EQ(t.score("c"), std::nullopt);
+}
+
+TEST(Trie, TopKScoreUpdatesAndErase) {
+    Trie t;
+    t.insert("alpha", 10);
+    t.insert("alps", 30);
+    t.insert("alp", 20);
+
+    // Re-inserting without a score keeps it; with a score replaces it.
+    t.insert("alps");
+    EXPECT_EQ(t.score("alps"), 30);
+    EXPECT_EQ(t.size(), 3);
+    t.insert("alps", 5);
+    EXPECT_EQ(t.top_k_with_prefix("al", 1)[0].first, "alp");
+
+    t.erase("alp");
+    EXPECT_EQ(t.score("alp"), std::nullopt);
+    EXPECT_EQ(t.top_k_with_prefix("al", 1)[0].first, "alpha");
+
+    t.erase("alpha");
+    t.erase("alps");
+    EXPECT_TRUE(t.top_k_with_prefix("", 5).empty());
+    EXPECT_EQ(t.count_with_prefix("al"), 0);
+}
+
+TEST(Trie, TopKMatchesSortOnRandomOperations) {
+    std::mt19937 rng(11);
+    auto random_word = [&] {
+        std::string w(1 + rng() % 6, 'a');
+        for (char& c : w) {
+            c = static_cast<char>('a' + rng() % 3);
+        }
+        return w;
+    };
+
+    Trie t;
+    std::map<std::string, int64_t> model;
+    Trie::CompletionBuffer buffer; // reused across all queries
+    for (int step = 0; step < 4000; ++step) {
+        const std::string w = random_word();
+        if (rng() % 4 == 0) {
+            t.erase(w);
+            model.erase(w);
+        } else {
+            // Few distinct scores, so ties are common.
+            const auto s = static_cast<int64_t>(rng() % 20) - 5;
+            t.insert(w, s);
+            model[w] = s;
+        }
+
+        const std::string prefix = random_word().substr(0, rng() % 3);
+        const int k = static_cast<int>(rng() % 8);
+        std::vector<int64_t> expected;
+        for (const auto& [word, s] : model) {
+            if (word.starts_with(prefix)) {
+                expected.push_back(s);
+            }
+        }
+        std::sort(expected.rbegin(), expected.rend());
+        expected.resize(std::min(expected.size(), static_cast<size_t>(k)));
+
+        t.top_k_with_prefix(prefix, k, buffer);
+        std::vector<int64_t> got;
+        for (const auto& c : buffer.results()) {
+            ASSERT_TRUE(c.word.starts_with(prefix)) << c.word;
+            ASSERT_EQ(model.at(std::string(c.word)), c.score) << c.word;
+            got.push_back(c.score);
+        }
+        // Ties may come out in any order, but the scores must match exactly.
+        ASSERT_EQ(got, expected) << "prefix '" << prefix << "', k " << k;
+    }
+}
+
+// ---- Fuzzy search ----
+
+TEST(Trie, SearchWithinDistanceBasic) {
+    Trie t;
+    for (const char* w : {"cat", "cart", "care", "cast", "act", "dog", "at", "c"}) {
+        t.insert(w);
+    }
+    using Match = std::pair<std::string, int>;
+
+    EXPECT_EQ(t.search_within_distance("cat", 0), (std::vector<Match>{{"cat", 0}}));
+    EXPECT_EQ(t.search_within_distance("cat", 1),
+              (std::vector<Match>{{"at", 1}, {"cart", 1}, {"cast", 1}, {"cat", 0}}));
+    EXPECT_EQ(t.search_within_distance("cta", 2),
+              (std::vector<Match>{{"act", 2}, {"at", 2}, {"c", 2}, {"cat", 2}}));
+    EXPECT_EQ(t.search_within_distance("", 1), (std::vector<Match>{{"c", 1}}));
+    EXPECT_TRUE(t.search_within_distance("cat", -1).empty());
+    EXPECT_EQ(t.search_within_distance("CAT", 3).size(), 5u); // c, at, act, cat, dog
+}
+
+TEST(Trie, SearchWithinDistanceMatchesBruteForce) {
+    auto levenshtein = [](std::string_view a, std::string_view b) {
+        std::vector<int> row(b.size() + 1);
+        for (size_t j = 0; j <= b.size(); ++j) {
+            row[j] = static_cast<int>(j);
+        }
+        for (size_t i = 1; i <= a.size(); ++i) {
+            int diag = row[0];
+            row[0] = static_cast<int>(i);
+            for (size_t j = 1; j <= b.size(); ++j) {
+                const int up = row[j];
+                row[j] = std::min({row[j] + 1, row[j - 1] + 1, diag + (a[i - 1] != b[j - 1])});
+                diag = up;
+            }
+        }
+        return row[b.size()];
+    };
+
+    std::mt19937 rng(13);
+    auto random_word = [&](size_t max_len) {
+        std::string w(rng() % (max_len + 1), 'a');
+        for (char& c : w) {
+            c = static_cast<char>('a' + rng() % 4);
+        }
+        return w;
+    };
+
+    Trie t;
+    std::set<std::string> words;
+    for (int i = 0; i < 3000; ++i) {
+        // Mostly short words, plus some around the 64-character boundary.
+        std::string w = random_word(i % 10 == 0 ? 70 : 8);
+        t.insert(w);
+        words.insert(w);
+    }
+
+    for (int q = 0; q < 300; ++q) {
+        std::string query = random_word(q % 5 == 0 ? 70 : 9);
+        if (q % 7 == 0 && !query.empty()) {
+            query[rng() % query.size()] = '#'; // matches no stored character
+        }
+        const int k = static_cast<int>(rng() % 4);
+        std::vector<std::pair<std::string, int>> expected;
+        for (const auto& w : words) {
+            const int d = levenshtein(w, query);
+            if (d <= k) {
+                expected.emplace_back(w, d);
+            }
+        }
+        ASSERT_EQ(t.search_within_distance(query, k), expected)
+            << "query '" << query << "' (" << query.size() << " chars), k " << k;
+    }
+}
+
+// ---- RadixTrie ----
+
+TEST(RadixTrie, SplitsAndMergesEdges) {
+    RadixTrie t;
+    t.insert("romane");
+    t.insert("romanus");
+    t.insert("romulus");
+    t.insert("rubens");
+    t.insert("ruber");
+    // root, r, om, an, e, us, ulus, ube, ns, r
+    EXPECT_EQ(t.nodes(), 10u);
+    EXPECT_EQ(t.size(), 5);
+    EXPECT_TRUE(t.search("romanus"));
+    EXPECT_FALSE(t.search("roman"));
+    EXPECT_FALSE(t.search("rom"));
+    EXPECT_TRUE(t.starts_with("roma"));  // ends inside an edge
+    EXPECT_EQ(t.count_with_prefix("rom"), 3);
+    EXPECT_EQ(t.count_with_prefix("rube"), 2);
+    EXPECT_EQ(t.count_with_prefix("rx"), 0);
+
+    // Erasing "romulus" leaves "om" with one child: it merges with "an" into "oman".
+    EXPECT_TRUE(t.erase("romulus"));
+    EXPECT_EQ(t.nodes(), 8u);
+    EXPECT_EQ(t.words_with_prefix("ro"), (std::vector<std::string>{"romane", "romanus"}));
+    EXPECT_TRUE(t.erase("romane"));
+    EXPECT_TRUE(t.erase("romanus"));
+    EXPECT_EQ(t.nodes(), 4u); // root, rube, ns, r
+    EXPECT_EQ(t.count_with_prefix("r"), 2);
+    EXPECT_EQ(t.words_with_prefix(""), (std::vector<std::string>{"rubens", "ruber"}));
+}
+
+TEST(RadixTrie, AcceptsArbitraryBytes) {
+    RadixTrie t;
+    const std::string with_nul("a\0b", 3);
+    t.insert("https://example.com/a?b=1");
+    t.insert("https://example.com/A");
+    t.insert(with_nul);
+    t.insert("\xff\x80");
+    t.insert("");
+
+    EXPECT_EQ(t.size(), 5);
+    EXPECT_TRUE(t.search(""));
+    EXPECT_TRUE(t.search(with_nul));
+    EXPECT_FALSE(t.search("a"));
+    EXPECT_TRUE(t.search("\xff\x80"));
+    EXPECT_EQ(t.count_with_prefix("https://example.com/"), 2);
+    EXPECT_EQ(t.longest_prefix_of("https://example.com/Abc"), "https://example.com/A");
+    EXPECT_EQ(t.longest_prefix_of("zzz"), "");
+
+    // Byte-wise order, as std::string compares: '\0' < 'A' < 'a' < '\xff'.
+    const auto all = t.words_with_prefix("");
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end()));
+    EXPECT_EQ(all.size(), 5u);
+}
+
+TEST(RadixTrie, AdaptiveFanOutGrowsAndShrinks) {
+    RadixTrie t;
+    // 256 children under one node walk it through Node4/16/48/256 ...
+    for (int b = 255; b >= 0; --b) {
+        t.insert(std::string("k") + static_cast<char>(b));
+    }
+    EXPECT_EQ(t.size(), 256);
+    for (int b = 0; b < 256; ++b) {
+        EXPECT_TRUE(t.search(std::string("k") + static_cast<char>(b)));
+    }
+    const auto all = t.words_with_prefix("k");
+    ASSERT_EQ(all.size(), 256u);
+    EXPECT_TRUE(std::is_sorted(all.begin(), all.end()));
+
+    // ... and erasing them walks it back down.
+    for (int b = 0; b < 255; ++b) {
+        EXPECT_TRUE(t.erase(std::string("k") + static_cast<char>(b)));
+        EXPECT_EQ(t.count_with_prefix("k"), 255 - b);
+    }
+    EXPECT_EQ(t.words_with_prefix(""), (std::vector<std::string>{std::string("k\xff")}));
+    EXPECT_EQ(t.nodes(), 2u); // root + the merged "k\xff" edge
+}
+
+TEST(RadixTrie, MatchesOrderedSetOnRandomOperations) {
+    std::mt19937 rng(42);
+    // Short keys over a small alphabet produce many shared prefixes, splits and merges.
+    auto random_key = [&] {
+        std::string key(rng() % 7, ' ');
+        for (char& c : key) {
+            c = static_cast<char>("ab\0\xff/"[rng() % 5]);
+        }
+        return key;
+    };
+
+    RadixTrie t;
+    std::set<std::string> ref;
+    for (int step = 0; step < 20000; ++step) {
+        const std::string key = random_key();
+        if (rng() % 3 != 0) {
+            t.insert(key);
+            ref.insert(key);
+        } else {
+            EXPECT_EQ(t.erase(key), ref.erase(key) == 1);
+        }
+        const std::string probe = random_key();
+        EXPECT_EQ(t.search(probe), ref.count(probe) == 1);
+
+        int expected = 0;
+        for (auto it = ref.lower_bound(probe); it != ref.end() && it->starts_with(probe); ++it) {
+            ++expected;
+        }
+        ASSERT_EQ(t.count_with_prefix(probe), expected);
+    }
+    EXPECT_EQ(t.size(), static_cast<int>(ref.size()));
+    EXPECT_EQ(t.words_with_prefix(""), std::vector<std::string>(ref.begin(), ref.end()));
+}
+
+TEST(RadixTrie, MemoryStaysBoundedUnderChurn) {
+    RadixTrie t;
+    std::vector<std::string> keys;
+    for (int i = 0; i < 5000; ++i) {
+        keys.push_back("/usr/share/doc/package-" + std::to_string(i * 7919 % 5000) + "/README");
+    }
+    for (const auto& k : keys) {
+        t.insert(k);
+    }
+
+    // Erase and re-insert half of the keys many times: dead arena bytes from
+    // removed and merged edges must be reclaimed, not accumulate.
+    size_t after_first_round = 0;
+    for (int round = 0; round < 20; ++round) {
+        for (size_t i = round % 2; i < keys.size(); i += 2) {
+            EXPECT_TRUE(t.erase(keys[i]));
+        }
+        for (size_t i = 0; i < keys.size(); ++i) {
+            ASSERT_EQ(t.search(keys[i]), i % 2 != static_cast<size_t>(round % 2));
+        }
+        for (size_t i = round % 2; i < keys.size(); i += 2) {
+            t.insert(keys[i]);
+        }
+        if (round == 0) {
+            after_first_round = t.memory_bytes();
+        }
+    }
+    EXPECT_EQ(t.size(), 5000);
+    EXPECT_LE(t.memory_bytes(), 2 * after_first_round);
+
+    t.clear();
+    EXPECT_TRUE(t.empty());
+    EXPECT_EQ(t.nodes(), 1u);
+    t.insert("x");
+    EXPECT_TRUE(t.search("x"));
+}
+
+// ---- Freeze (DoubleArrayTrie) ----
+
+TEST(DoubleArrayTrie, FreezeMatchesTrie) {
+    std::mt19937 rng(7);
+    auto random_word = [&](int alphabet) {
+        std::string w(1 + rng() % 8, 'a');
+        for (char& c : w) {
+            c = static_cast<char>('a' + rng() % alphabet);
+        }
+        return w;
+    };
+
+    Trie t;
+    for (int i = 0; i < 3000; ++i) {
+        t.insert(random_word(4));
+        t.insert(random_word(26));
+    }
+    for (int i = 0; i < 1000; ++i) {
+        t.erase(random_word(4));
+    }
+    const DoubleArrayTrie d = t.freeze();
+    EXPECT_EQ(d.size(), t.size());
+    EXPECT_FALSE(d.mapped());
+
+    for (int i = 0; i < 20000; ++i) {
+        std::string probe = random_word(i % 2 == 0 ? 4 : 26);
+        if (i % 7 == 0) {
+            probe.back() = '-'; // outside the alphabet
+        }
+        ASSERT_EQ(d.search(probe), t.search(probe)) << probe;
+        ASSERT_EQ(d.starts_with(probe), t.starts_with(probe)) << probe;
+        ASSERT_EQ(d.longest_prefix_of(probe), t.longest_prefix_of(probe)) << probe;
+    }
+    EXPECT_TRUE(d.starts_with(""));
+}
+
+TEST(DoubleArrayTrie, EmptyAndMovedFrom) {
+    DoubleArrayTrie empty;
+    EXPECT_TRUE(empty.empty());
+    EXPECT_FALSE(empty.search(""));
+    EXPECT_FALSE(empty.starts_with(""));
+
+    Trie t;
+    t.insert("");
+    t.insert("ab");
+    DoubleArrayTrie d = t.freeze();
+    EXPECT_TRUE(d.search(""));
+    EXPECT_EQ(d.longest_prefix_length("abc"), 2u);
+
+    DoubleArrayTrie moved = std::move(d);
+    EXPECT_TRUE(moved.search("ab"));
+    EXPECT_FALSE(d.search("ab")); // moved-from is empty
+    EXPECT_EQ(d.size(), 0);
+}
+
+TEST(DoubleArrayTrie, SaveAndLoad) {
+    Trie t;
+    for (const char* w : {"the", "then", "there", "their", "to", "tokenizer", "token"}) {
+        t.insert(w);
+    }
+    const DoubleArrayTrie d = t.freeze();
+    const std::string path = testing::TempDir() + "dat_save_and_load.bin";
+    ASSERT_TRUE(d.save(path));
+
+    auto loaded = DoubleArrayTrie::load(path);
+    ASSERT_TRUE(loaded.has_value());
+#if defined(__unix__) || defined(__APPLE__)
+    EXPECT_TRUE(loaded->mapped());
+#endif
+    EXPECT_EQ(loaded->size(), 7);
+    EXPECT_EQ(loaded->units(), d.units());
+    EXPECT_TRUE(loaded->search("token"));
+    EXPECT_FALSE(loaded->search("toke"));
+    EXPECT_EQ(loaded->longest_prefix_of("tokenizers"), "tokenizer");
+    EXPECT_EQ(loaded->longest_prefix_of("thereof"), "there");
+
+    // A mapped dictionary survives being moved.
+    DoubleArrayTrie moved = std::move(*loaded);
+    EXPECT_TRUE(moved.search("their"));
+
+    // Truncated and foreign files are rejected.
+    {
+        std::FILE* f = std::fopen(path.c_str(), "r+b");
+        ASSERT_NE(f, nullptr);
+        std::fputc('X', f); // break the magic
+        std::fclose(f);
+    }
+    EXPECT_FALSE(DoubleArrayTrie::load(path).has_value());
+    ASSERT_TRUE(d.save(path));
+    {
+        std::FILE* f = std::fopen(path.c_str(), "ab");
+        ASSERT_NE(f, nullptr);
+        std::fputc(0, f); // size no longer matches the header
+        std::fclose(f);
+    }
+    EXPECT_FALSE(DoubleArrayTrie::load(path).has_value());
+    EXPECT_FALSE(DoubleArrayTrie::load(path + ".missing").has_value());
+    std::remove(path.c_str());
+}
+
+// ---- ConcurrentTrie ----
+
+TEST(ConcurrentTrie, MatchesTrieOnRandomOperations) {
+    std::mt19937 rng(5);
+    auto random_word = [&] {
+        std::string w(rng() % 6, 'a');
+        for (char& c : w) {
+            c = static_cast<char>('a' + rng() % 3);
+        }
+        return w;
+    };
+
+    ConcurrentTrie c;
+    Trie t;
+    for (int step = 0; step < 20000; ++step) {
+        const std::string w = random_word();
+        if (rng() % 3 == 0) {
+            ASSERT_EQ(c.erase(w), t.erase(w)) << w;
+        } else {
+            c.insert(w);
+            t.insert(w);
+        }
+        if (step % 5000 == 4999) {
+            c.clear();
+            t.clear();
+        }
+
+        const std::string probe = random_word();
+        ASSERT_EQ(c.search(probe), t.search(probe)) << probe;
+        ASSERT_EQ(c.starts_with(probe), t.starts_with(probe)) << probe;
+        ASSERT_EQ(c.count_with_prefix(probe), t.count_with_prefix(probe)) << probe;
+        ASSERT_EQ(c.longest_prefix_of(probe + "ab"), t.longest_prefix_of(probe + "ab"));
+        ASSERT_EQ(c.size(), t.size());
+    }
+    EXPECT_EQ(c.words_with_prefix(""), t.words_with_prefix(""));
+    EXPECT_EQ(c.words_with_prefix("a"), t.words_with_prefix("a"));
+
+    c.insert("Abc"); // invalid character: ignored
+    EXPECT_FALSE(c.search("Abc"));
+    EXPECT_FALSE(c.erase("a-b"));
+}
+
+TEST(ConcurrentTrie, ErasedNodesAreRecycled) {
+    ConcurrentTrie c;
+    auto fill_and_erase = [&c](int round) {
+        for (int i = 0; i < 5000; ++i) {
+            std::string w = "k";
+            for (int v = i * 7 + round; v > 0; v /= 26) {
+                w += static_cast<char>('a' + v % 26);
+            }
+            c.insert(w);
+        }
+        c.clear();
+    };
+
+    // Without readers, retired nodes come back after two epoch flips, so
+    // later rounds reuse the first round's pool instead of growing it.
+    fill_and_erase(0);
+    c.insert("warm");
+    c.erase("warm");
+    const size_t settled = c.memory_bytes();
+    for (int round = 1; round < 4; ++round) {
+        fill_and_erase(round);
+        c.insert("warm");
+        c.erase("warm");
+    }
+    // A new segment would double the pool; the free lists may grow a little.
+    EXPECT_LT(c.memory_bytes(), settled + settled / 10);
+    EXPECT_TRUE(c.empty());
+}
+
+TEST(ConcurrentTrie, ReadersSeeStableWordsWhileWriterChurns) {
+    ConcurrentTrie c;
+    std::vector<std::string> stable;
+    for (int i = 0; i < 500; ++i) {
+        std::string w;
+        for (int v = i + 1; v > 0; v /= 5) {
+            w += static_cast<char>('a' + v % 5); // letters a..e
+        }
+        stable.push_back(w + "z");
+        c.insert(stable.back());
+    }
+
+    std::atomic<bool> done{false};
+    std::atomic<int> failures{0};
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&, r] {
+            size_t i = static_cast<size_t>(r);
+            while (!done.load(std::memory_order_relaxed)) {
+                const std::string& w = stable[i++ % stable.size()];
+                if (!c.search(w) || !c.starts_with(w.substr(0, 2)) ||
+                    c.longest_prefix_of(w + "zz") != w) {
+                    failures.fetch_add(1);
+                }
+                for (const auto& found : c.words_with_prefix(w.substr(0, 1))) {
+                    if (found.empty() || found[0] != w[0]) {
+                        failures.fetch_add(1);
+                    }
+                }
+            }
+        });
+    }
+
+    // Churn words that share the stable words' prefixes, so unlinked and
+    // recycled nodes sit right next to the paths the readers walk.
+    std::mt19937 rng(3);
+    std::set<std::string> churn;
+    for (int step = 0; step < 100000; ++step) {
+        std::string w = stable[rng() % stable.size()];
+        w.back() = static_cast<char>('a' + rng() % 5);
+        w += static_cast<char>('a' + rng() % 25); // never 'z': no clash with a stable word
+        if (rng() % 2 == 0) {
+            c.insert(w);
+            churn.insert(w);
+        } else {
+            c.erase(w);
+            churn.erase(w);
+        }
+        if (step % 20000 == 0) {
+            std::this_thread::yield();
+        }
+    }
+    done.store(true);
+    for (auto& t : readers) {
+        t.join();
+    }
+
+    EXPECT_EQ(failures.load(), 0);
+    EXPECT_EQ(c.size(), static_cast<int>(stable.size() + churn.size()));
+    for (const auto& w : churn) {
+        EXPECT_TRUE(c.search(w)) << w;
+    }
+}
+
 } // namespace